@@ -36,7 +36,7 @@ namespace Library
 		
 		if (parent != nullptr)
 		{
-			Entity* child = FindChild(EntityPrototypeKey);
+			Entity* child = FindChild(EntityPrototypeKeyId);
 
 			if (child != nullptr)
 			{
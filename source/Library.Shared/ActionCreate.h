@@ -22,6 +22,11 @@ namespace Library
 		/// </summary>
 		inline static const std::string EntityPrototypeKey = "Entity";
 
+		/// <summary>
+		/// Interned key for the created Attribute.
+		/// </summary>
+		inline static const NameId EntityPrototypeKeyId{ EntityPrototypeKey };
+
 	public:
 		/// <summary>
 		/// Getter for the class SignatureList, used for registration with the TypeManager.
@@ -25,18 +25,37 @@ namespace Library
 	{
 	}
 
+	const std::string& ActionDestroy::GetTarget() const
+	{
+		return mTargetName;
+	}
+
+	void ActionDestroy::SetTarget(std::string target)
+	{
+		mTargetName = std::move(target);
+		mTargetNameId = NameId(mTargetName);
+	}
+
 	gsl::owner<Scope*> ActionDestroy::Clone() const
 	{
 		return new ActionDestroy(*this);
 	}
 
+	void ActionDestroy::Initialize(WorldState& worldState)
+	{
+		mTargetNameId = NameId(mTargetName);
+		Entity::Initialize(worldState);
+	}
+
 	void ActionDestroy::Update(WorldState&)
 	{
 		Entity* parent = GetParent();
 		
 		if (parent != nullptr)
 		{
-			Entity* child = parent->FindChild(mTargetName);
+			if (mTargetNameId.IsNull()) mTargetNameId = NameId(mTargetName);
+
+			Entity* child = parent->FindChild(mTargetNameId);
 
 			if (child != nullptr)
 			{
@@ -68,6 +68,23 @@ namespace Library
 		ActionDestroy& operator=(ActionDestroy&& rhs) noexcept = default;
 #pragma endregion Special Members
 
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the name of the child Entity this Action destroys.
+		/// </summary>
+		/// <returns>Name of the Target.</returns>
+		const std::string& GetTarget() const;
+
+		/// <summary>
+		/// Sets the name of the child Entity this Action destroys, and interns it.
+		/// The Target attribute may also be written through its Datum before the first Initialize or Update,
+		/// such as by the JSON parser. Later writes through the Datum are only seen by the next Initialize.
+		/// </summary>
+		/// <param name="target">New name of the Target.</param>
+		void SetTarget(std::string target);
+#pragma endregion Accessors
+
 #pragma region Virtual Copy Constructor
 	public:
 		/// <summary>
@@ -79,8 +96,15 @@ namespace Library
 
 #pragma region Game Loop
 	public:
+		/// <summary>
+		/// Virtual initialize method called by the containing object, interns the name of the Target.
+		/// </summary>
+		/// <param name="worldState">Reference to the current WorldState.</param>
+		virtual void Initialize(WorldState& worldState) override;
+
 		/// <summary>
 		/// Virtual update method called by the containing object.
+		/// Destroys the sibling named by the Target, interning its name first if not done by Initialize or SetTarget.
 		/// </summary>
 		virtual void Update(WorldState&) override;
 #pragma endregion Game Loop
@@ -100,6 +124,11 @@ namespace Library
 		/// Name for the Attribute of the Attribute to create.
 		/// </summary>
 		std::string mTargetName;
+
+		/// <summary>
+		/// Interned name of the Target to destroy, resolved by Initialize, SetTarget, or the first Update.
+		/// </summary>
+		NameId mTargetNameId;
 #pragma endregion Data Members
 	};
 
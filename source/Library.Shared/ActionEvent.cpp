@@ -9,8 +9,6 @@
 
 // First Party
 #include "World.h"
-#include "EventMessageAttributed.h"
-#include "Event.h"
 #include "EventQueue.h"
 #pragma endregion Includes
 
@@ -43,17 +41,27 @@ namespace Library
 
 		if (worldState.World && worldState.EventQueue && gameTime)
 		{
-			EventMessageAttributed message;
-			message.SetWorld(worldState.World);
-			message.SetSubtype(mSubtype);
+			World* world = worldState.World;
 
-			ForEachAuxiliary([&](const Attribute& attribute)
+			auto event = mEventPool.Acquire([this, world](EventMessageAttributed& message)
 			{
-				message.AppendAuxiliaryAttribute(attribute.first) = attribute.second;
+				auto copyAuxiliary = [&message](const Attribute& attribute)
+				{
+					message.AppendAuxiliaryAttribute(attribute.first) = attribute.second;
+				};
+
+				message.SetWorld(world);
+				message.SetSubtype(mSubtype);
+				ForEachAuxiliary(copyAuxiliary);
+
+				if (message.AuxiliaryCount() != AuxiliaryCount())
+				{
+					message = EventMessageAttributed(world, mSubtype);
+					ForEachAuxiliary(copyAuxiliary);
+				}
 			});
 
-			worldState.EventQueue->Enqueue(std::make_shared<Event<EventMessageAttributed>>(message),
-										   gameTime->CurrentTime() + std::chrono::milliseconds(mDelay));
+			worldState.EventQueue->Enqueue(std::move(event), gameTime->CurrentTime() + std::chrono::milliseconds(mDelay));
 		}
 	}
 
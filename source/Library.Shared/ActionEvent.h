@@ -4,6 +4,8 @@
 // First Party
 #include "Entity.h"
 #include "Factory.h"
+#include "EventPool.h"
+#include "EventMessageAttributed.h"
 #pragma endregion Includes
 
 namespace Library
@@ -111,6 +113,11 @@ namespace Library
 		/// Delay for the created Event.
 		/// </summary>
 		int mDelay;
+
+		/// <summary>
+		/// Pool recycling the created Event instances, shared by copies of the ActionEvent.
+		/// </summary>
+		EventPool<EventMessageAttributed> mEventPool;
 #pragma endregion Data Members
 	};
 
@@ -26,14 +26,33 @@ namespace Library
 	{
 	}
 
+	const std::string& ActionIncrement::GetOperand() const
+	{
+		return mOperand;
+	}
+
+	void ActionIncrement::SetOperand(std::string operand)
+	{
+		mOperand = std::move(operand);
+		mOperandRef = Resolve(mOperand);
+	}
+
 	gsl::owner<Scope*> ActionIncrement::Clone() const
 	{
 		return new ActionIncrement(*this);
 	}
 
+	void ActionIncrement::Initialize(WorldState& worldState)
+	{
+		mOperandRef = Resolve(mOperand);
+		Entity::Initialize(worldState);
+	}
+
 	void ActionIncrement::Update(WorldState&)
 	{
-		Data* operand = Search(mOperand);
+		if (mOperandRef.Origin() != this) mOperandRef = Resolve(mOperand);
+
+		Data* operand = mOperandRef.Get();
 
 		if (operand && operand->Type() == Types::Integer && operand->Size() > 0)
 		{
@@ -73,6 +73,23 @@ namespace Library
 		ActionIncrement& operator=(ActionIncrement&& rhs) noexcept = default;
 #pragma endregion Special Members
 
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the name of the integer Attribute this Action increments.
+		/// </summary>
+		/// <returns>Name of the Operand.</returns>
+		const std::string& GetOperand() const;
+
+		/// <summary>
+		/// Sets the name of the integer Attribute this Action increments, and resolves it.
+		/// The Operand attribute may also be written through its Datum before the first Initialize or Update,
+		/// such as by the JSON parser. Later writes through the Datum are only seen by the next Initialize.
+		/// </summary>
+		/// <param name="operand">New name of the Operand.</param>
+		void SetOperand(std::string operand);
+#pragma endregion Accessors
+
 #pragma region Virtual Copy Constructor
 	public:
 		/// <summary>
@@ -84,8 +101,15 @@ namespace Library
 
 #pragma region Game Loop
 	public:
+		/// <summary>
+		/// Virtual initialize method called by the containing object, resolves the Operand.
+		/// </summary>
+		/// <param name="worldState">Reference to the current WorldState.</param>
+		virtual void Initialize(WorldState& worldState) override;
+
 		/// <summary>
 		/// Virtual update method called by the containing object.
+		/// Increments the Operand, resolving it first if not done by Initialize or SetOperand, or if the ActionIncrement was copied since.
 		/// </summary>
 		virtual void Update(WorldState&) override;
 #pragma endregion Game Loop
@@ -106,6 +130,11 @@ namespace Library
 		/// </summary>
 		std::string mOperand;
 
+		/// <summary>
+		/// Handle to the integer Attribute to increment, resolved by Initialize, SetOperand, or the first Update after construction or copy.
+		/// </summary>
+		AttributeRef mOperandRef;
+
 		/// <summary>
 		/// Amount to increment the integer Attribute.
 		/// </summary>
@@ -19,18 +19,22 @@
 namespace Library
 {
 #pragma region Constructors, Destructor, Assignment
-	Attributed::Attributed(const IdType typeId)
-	{	
+	Attributed::Attributed(const IdType typeId) : Attributed(FindLayout(typeId))
+	{
+	}
+
+	Attributed::Attributed(const TypeLayout& layout) : Scope(layout.Slots),
+		mLayout(&layout)
+	{
 		(*this)["this"] = static_cast<RTTI*>(this);
-		Populate(TypeManager::Instance()->Find(typeId));
-		mNumPrescribed = mPairPtrs.Size();
+		Populate();
 	}
 
 	Attributed::Attributed(const Attributed& rhs) : Scope(rhs), 
-		mNumPrescribed(rhs.mNumPrescribed)
+		mLayout(rhs.mLayout)
 	{
 		(*this)["this"] = static_cast<RTTI*>(this);
-		UpdateExternalStorage(TypeManager::Instance()->Find(rhs.TypeIdInstance()));
+		UpdateExternalStorage();
 	}
 
 	Attributed& Attributed::operator=(const Attributed& rhs)
@@ -38,19 +42,19 @@ namespace Library
 		if (this == &rhs) return *this;
 		
 		Scope::operator=(rhs);
-		mNumPrescribed = rhs.mNumPrescribed;
+		mLayout = rhs.mLayout;
 
 		(*this)["this"] = static_cast<RTTI*>(this);
-		UpdateExternalStorage(TypeManager::Instance()->Find(rhs.TypeIdInstance()));
+		UpdateExternalStorage();
 
 		return *this;
 	}
 
 	Attributed::Attributed(Attributed&& rhs) noexcept : Scope(std::move(rhs)), 
-		mNumPrescribed(rhs.mNumPrescribed)
+		mLayout(rhs.mLayout)
 	{
 		(*this)["this"] = static_cast<RTTI*>(this);
-		UpdateExternalStorage(TypeManager::Instance()->Find(rhs.TypeIdInstance()));
+		UpdateExternalStorage();
 	}
 
 	Attributed& Attributed::operator=(Attributed&& rhs) noexcept
@@ -58,10 +62,10 @@ namespace Library
 		if (this == &rhs) return *this;
 
 		Scope::operator=(std::move(rhs));
-		mNumPrescribed = rhs.mNumPrescribed;
+		mLayout = rhs.mLayout;
 
 		(*this)["this"] = static_cast<RTTI*>(this);
-		UpdateExternalStorage(TypeManager::Instance()->Find(rhs.TypeIdInstance()));
+		UpdateExternalStorage();
 
 		return *this;
 	}
@@ -70,17 +74,17 @@ namespace Library
 #pragma region Boolean Operators
 	bool Attributed::operator==(const Attributed& rhs) const noexcept
 	{
-		if (this == &rhs)								return true;
-		if (mPairPtrs.Size() != rhs.mPairPtrs.Size())	return false;
+		if (this == &rhs)				return true;
+		if (Size() != rhs.Size())		return false;
 
-		for (std::size_t i = 1; i < mPairPtrs.Size(); ++i)
+		for (std::size_t i = 1; i < Size(); ++i)
 		{
 			try
 			{
-				const auto& pairPtr = mPairPtrs[i];
+				const ConstAttribute attribute = AttributeAt(i);
 
-				const Data* rhsData = rhs.Find(pairPtr->first);
-				if (!rhsData || pairPtr->second != *rhsData) return false;
+				const Data* rhsData = rhs.Find(attribute.first);
+				if (!rhsData || attribute.second != *rhsData) return false;
 			}
 			catch (...)
 			{
@@ -105,12 +109,7 @@ namespace Library
 
 	bool Attributed::IsPrescribedAttribute(const Key& key)
 	{
-		for (std::size_t i = 0; i < mNumPrescribed; ++i)
-		{
-			if (mPairPtrs[i]->first == key) return true;
-		}
-
-		return false;
+		return FindSlot(key) != SlotIndex::NotFound;
 	}
 
 	bool Attributed::IsAuxiliaryAttribute(const Key& key)
@@ -118,35 +117,42 @@ namespace Library
 		return !IsPrescribedAttribute(key);
 	}
 
+	std::size_t Attributed::AuxiliaryCount() const
+	{
+		return Size() - SlotCount();
+	}
+
 	void Attributed::ForEachPrescribed(const std::function<void(Attribute&)>& functor)
 	{
-		for (std::size_t i = 0; i < mNumPrescribed; ++i)
+		for (std::size_t i = 0; i < SlotCount(); ++i)
 		{
-			functor(*mPairPtrs[i]);
+			Attribute attribute = AttributeAt(i);
+			functor(attribute);
 		}
 	}
 
-	void Attributed::ForEachPrescribed(const std::function<void(const Attribute&)>& functor) const
+	void Attributed::ForEachPrescribed(const std::function<void(const ConstAttribute&)>& functor) const
 	{
-		for (std::size_t i = 0; i < mNumPrescribed; ++i)
+		for (std::size_t i = 0; i < SlotCount(); ++i)
 		{
-			functor(*mPairPtrs[i]);
+			functor(AttributeAt(i));
 		}
 	}
 
 	void Attributed::ForEachAuxiliary(const std::function<void(Attribute&)>& functor)
 	{
-		for (std::size_t i = mNumPrescribed; i < mPairPtrs.Size(); ++i)
+		for (std::size_t i = SlotCount(); i < Size(); ++i)
 		{
-			functor(*mPairPtrs[i]);
+			Attribute attribute = AttributeAt(i);
+			functor(attribute);
 		}
 	}
 
-	void Attributed::ForEachAuxiliary(const std::function<void(const Attribute&)>& functor) const
+	void Attributed::ForEachAuxiliary(const std::function<void(const ConstAttribute&)>& functor) const
 	{
-		for (std::size_t i = mNumPrescribed; i < mPairPtrs.Size(); ++i)
+		for (std::size_t i = SlotCount(); i < Size(); ++i)
 		{
-			functor(*mPairPtrs[i]);
+			functor(AttributeAt(i));
 		}
 	}
 	
@@ -167,22 +173,22 @@ namespace Library
 		std::ostringstream oss;
 		oss << "Attributed(";
 
-		for (std::size_t pairIndex = 1; pairIndex < mPairPtrs.Size(); ++pairIndex)
+		for (std::size_t pairIndex = 1; pairIndex < Size(); ++pairIndex)
 		{
-			const auto& pairPtr = mPairPtrs[pairIndex];
+			const ConstAttribute attribute = AttributeAt(pairIndex);
 
-			oss << "'" << pairPtr->first << "':{";
+			oss << "'" << attribute.first << "':{";
 
-			for (std::size_t dataIndex = 0; dataIndex < pairPtr->second.Size(); ++dataIndex)
+			for (std::size_t dataIndex = 0; dataIndex < attribute.second.Size(); ++dataIndex)
 			{
-				oss << pairPtr->second.ToString(dataIndex);
+				oss << attribute.second.ToString(dataIndex);
 
-				if (dataIndex < pairPtr->second.Size() - 1) oss << ",";
+				if (dataIndex < attribute.second.Size() - 1) oss << ",";
 			}
 
 			oss << "}";
 
-			if (pairIndex < mPairPtrs.Size() - 1) oss << ",";
+			if (pairIndex < Size() - 1) oss << ",";
 		}
 
 		oss << ")";
@@ -201,16 +207,20 @@ namespace Library
 #pragma endregion RTTI Overrides
 
 #pragma region Helper Methods
-	void Attributed::Populate(const TypeInfo* typeInfo)
+	const TypeLayout& Attributed::FindLayout(const IdType typeId)
 	{
-		const auto* parentTypeInfo = TypeManager::Instance()->Find(typeInfo->ParentTypeId);
-		if (parentTypeInfo) Populate(parentTypeInfo);
+		const TypeLayout* layout = TypeManager::Instance()->FindLayout(typeId);
+		if (!layout) throw std::runtime_error("Type is not registered.");
 
-		mPairPtrs.Reserve(typeInfo->Signatures.Size() + mPairPtrs.Size());
+		return *layout;
+	}
 
-		for (const auto& signature : typeInfo->Signatures)
+	void Attributed::Populate()
+	{
+		for (std::size_t i = 0; i < mLayout->Signatures.Size(); ++i)
 		{
-			Data& data = Append(signature.Key);
+			const Signature& signature = mLayout->Signatures[i];
+			Data& data = (*this)[TypeLayout::FirstIndex + i];
 
 			if (!signature.IsInternal)
 			{
@@ -225,25 +235,15 @@ namespace Library
 		}
 	}
 
-	std::size_t Attributed::UpdateExternalStorage(const TypeInfo* typeInfo)
+	void Attributed::UpdateExternalStorage()
 	{
-		std::size_t index = 1;
-
-		const auto parentTypeInfo = TypeManager::Instance()->Find(typeInfo->ParentTypeId);
-		if (parentTypeInfo) index = UpdateExternalStorage(parentTypeInfo);
-
-		for (const auto& signature : typeInfo->Signatures)
+		for (const std::size_t position : mLayout->External)
 		{
-			if (!signature.IsInternal)
-			{
-				std::byte* address = reinterpret_cast<std::byte*>(this) + signature.Offset;
-				mPairPtrs[index]->second.SetStorage(signature.Type, gsl::span(address, signature.Size));
-			}
+			const Signature& signature = mLayout->Signatures[position];
 
-			++index;
+			std::byte* address = reinterpret_cast<std::byte*>(this) + signature.Offset;
+			(*this)[TypeLayout::FirstIndex + position].SetStorage(signature.Type, gsl::span(address, signature.Size));
 		}
-
-		return index;
 	}
 #pragma endregion Helper Methods
 }
\ No newline at end of file
@@ -25,6 +25,7 @@ namespace Library
 		/// Populates the scope with attributes associated with the passed RTTI::IdType.
 		/// </summary>
 		/// <param name="typeId">RTTI::IdType to use during Populate.</param>
+		/// <exception cref="std::runtime_error">Type is not registered.</exception>
 		explicit Attributed(const IdType typeId);
 		
 		/// <summary>
@@ -105,6 +106,7 @@ namespace Library
 
 		/// <summary>
 		/// Checks if a prescribed Attribute is associated with the given name.
+		/// Prescribed Attributes are the slots of the type, so this is a single lookup in its shared SlotIndex.
 		/// </summary>
 		/// <param name="key">Key value to search for in the instance.</param>
 		/// <returns>True if associated with an Attribute. Otherwise, false.</returns>
@@ -117,6 +119,12 @@ namespace Library
 		/// <returns>True if associated with an Attribute. Otherwise, false.</returns>
 		bool IsAuxiliaryAttribute(const Key& key);
 
+		/// <summary>
+		/// Gets the number of auxiliary Attribute values.
+		/// </summary>
+		/// <returns>Number of auxiliary Attribute values.</returns>
+		std::size_t AuxiliaryCount() const;
+
 		/// <summary>
 		/// Gets the list of prescribed Attribute values.
 		/// </summary>
@@ -127,7 +135,7 @@ namespace Library
 		/// Gets the list of prescribed Attribute values.
 		/// </summary>
 		/// <returns>List of pointers to all prescribed Attribute values.</returns>
-		void ForEachPrescribed(const std::function<void(const Attribute&)>& functor) const;
+		void ForEachPrescribed(const std::function<void(const ConstAttribute&)>& functor) const;
 
 		/// <summary>
 		/// Gets the list of auxiliary Attribute values.
@@ -139,7 +147,7 @@ namespace Library
 		/// Gets the list of prescribed Attribute values.
 		/// </summary>
 		/// <returns>List of pointers to all auxiliary Attribute values.</returns>
-		void ForEachAuxiliary(const std::function<void(const Attribute&)>& functor) const;
+		void ForEachAuxiliary(const std::function<void(const ConstAttribute&)>& functor) const;
 #pragma endregion Accessors
 		
 #pragma region Modifiers
@@ -170,27 +178,36 @@ namespace Library
 #pragma region Helper Methods
 	private:
 		/// <summary>
-		/// Helper method for populating the Scope attributes during construction.
-		/// Recursively called to append any parent attributes registered.
+		/// Constructor populating the Scope from a TypeLayout, storing the prescribed Attributes in slots of its shared SlotIndex.
+		/// </summary>
+		/// <param name="layout">TypeLayout of the Attributed class.</param>
+		explicit Attributed(const struct TypeLayout& layout);
+
+		/// <summary>
+		/// Gets the TypeLayout registered for a type.
+		/// </summary>
+		/// <param name="typeId">RTTI::IdType of the Attributed class.</param>
+		/// <returns>TypeLayout of the Attributed class.</returns>
+		/// <exception cref="std::runtime_error">Type is not registered.</exception>
+		static const struct TypeLayout& FindLayout(const IdType typeId);
+
+		/// <summary>
+		/// Helper method for populating the Scope attributes during construction, in a single pass over the flattened TypeLayout.
 		/// </summary>
-		/// <param name="typeInfo">TypeInfo associated with the Attributed class.</param>
-		void Populate(const struct TypeInfo* typeInfo);
+		void Populate();
 
 		/// <summary>
 		/// Updates storage for all Data values in the Scope with external storage.
-		/// Recursively called to update any parent attributes registered.
 		/// </summary>
-		/// <param name="typeInfo">TypeInfo associated with the Attributed class.</param>
-		/// <returns>Next prescribed Attribute index to be updated, used by recursive calls.</returns>
-		std::size_t UpdateExternalStorage(const struct TypeInfo* typeInfo);
+		void UpdateExternalStorage();
 #pragma endregion Helper Methods
 
 #pragma region Data Members
 	private:
 		/// <summary>
-		/// Number of prescribed Attributes.
+		/// Flattened attribute layout of the Attributed class, shared by all of its instances.
 		/// </summary>
-		std::size_t mNumPrescribed{ 0 };
+		const struct TypeLayout* mLayout;
 #pragma endregion Data Members
 	};
 }
\ No newline at end of file
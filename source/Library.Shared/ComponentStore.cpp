@@ -0,0 +1,281 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "ComponentStore.h"
+#pragma endregion Includes
+
+namespace Library
+{
+#pragma region Static Members
+	ComponentStore::ComponentInfo ComponentStore::sComponentInfos[MaxComponentTypes];
+
+	std::atomic<std::size_t> ComponentStore::sComponentTypeCount{ 0 };
+#pragma endregion Static Members
+
+#pragma region Special Members
+	ComponentStore::ComponentStore(IAllocator& allocator) :
+		mAllocator(&allocator)
+	{
+	}
+
+	ComponentStore::~ComponentStore()
+	{
+		ReleaseChunks();
+	}
+
+	ComponentStore::ComponentStore(ComponentStore&& rhs) noexcept :
+		mAllocator(rhs.mAllocator), mArchetypes(std::move(rhs.mArchetypes)), mArchetypeMap(std::move(rhs.mArchetypeMap)),
+		mRecords(std::move(rhs.mRecords)), mFreeIndices(std::move(rhs.mFreeIndices)), mSystems(std::move(rhs.mSystems)), mSize(rhs.mSize)
+	{
+		rhs.mSize = 0;
+	}
+
+	ComponentStore& ComponentStore::operator=(ComponentStore&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			ReleaseChunks();
+
+			mAllocator = rhs.mAllocator;
+			mArchetypes = std::move(rhs.mArchetypes);
+			mArchetypeMap = std::move(rhs.mArchetypeMap);
+			mRecords = std::move(rhs.mRecords);
+			mFreeIndices = std::move(rhs.mFreeIndices);
+			mSystems = std::move(rhs.mSystems);
+			mSize = rhs.mSize;
+
+			rhs.mSize = 0;
+		}
+
+		return *this;
+	}
+#pragma endregion Special Members
+
+#pragma region Entities
+	bool ComponentStore::Destroy(const Handle& handle)
+	{
+		if (!IsAlive(handle)) return false;
+
+		Record& record = mRecords[handle.Index];
+		RemoveRow(record.Archetype, record.Row);
+
+		record.Archetype = Handle::InvalidIndex;
+		++record.Generation;
+
+		mFreeIndices.PushBack(handle.Index);
+		--mSize;
+
+		return true;
+	}
+
+	void ComponentStore::Clear()
+	{
+		ReleaseChunks();
+		mFreeIndices.Clear();
+
+		for (std::size_t i = 0; i < mRecords.Size(); ++i)
+		{
+			Record& record = mRecords[i];
+
+			if (record.Archetype != Handle::InvalidIndex)
+			{
+				record.Archetype = Handle::InvalidIndex;
+				++record.Generation;
+			}
+
+			mFreeIndices.PushBack(static_cast<std::uint32_t>(i));
+		}
+
+		mSize = 0;
+	}
+#pragma endregion Entities
+
+#pragma region Systems
+	void ComponentStore::AddSystem(System system)
+	{
+		mSystems.PushBack(std::move(system));
+	}
+
+	void ComponentStore::Update(WorldState& worldState)
+	{
+		for (auto& system : mSystems)
+		{
+			system(*this, worldState);
+		}
+	}
+#pragma endregion Systems
+
+#pragma region Helper Methods
+	std::size_t ComponentStore::RegisterComponentType(const std::size_t size, const std::size_t alignment)
+	{
+		std::size_t typeId = sComponentTypeCount.load(std::memory_order_relaxed);
+
+		do
+		{
+			if (typeId >= MaxComponentTypes) throw std::runtime_error("Too many component types.");
+		} while (!sComponentTypeCount.compare_exchange_weak(typeId, typeId + 1, std::memory_order_relaxed));
+
+		sComponentInfos[typeId] = { size, alignment };
+		return typeId;
+	}
+
+	std::uint32_t ComponentStore::FindOrCreateArchetype(const ComponentMask mask)
+	{
+		auto it = mArchetypeMap.Find(mask);
+		if (it != mArchetypeMap.end()) return it->second;
+
+		Archetype archetype;
+		archetype.Mask = mask;
+
+		std::size_t rowSize = sizeof(Handle);
+
+		for (std::size_t typeId = 0; typeId < MaxComponentTypes; ++typeId)
+		{
+			if (mask & (ComponentMask(1) << typeId))
+			{
+				archetype.Columns.PushBack({ typeId, sComponentInfos[typeId].Size, 0 });
+				rowSize += sComponentInfos[typeId].Size;
+			}
+		}
+
+		std::size_t capacity = std::max(ChunkSize / rowSize, std::size_t(1));
+		std::size_t chunkBytes;
+
+		while (true)
+		{
+			chunkBytes = sizeof(Handle) * capacity;
+
+			for (auto& column : archetype.Columns)
+			{
+				const std::size_t alignment = sComponentInfos[column.TypeId].Alignment;
+				column.Offset = (chunkBytes + alignment - 1) / alignment * alignment;
+				chunkBytes = column.Offset + column.Size * capacity;
+			}
+
+			if (chunkBytes <= ChunkSize || capacity == 1) break;
+			--capacity;
+		}
+
+		archetype.ChunkCapacity = capacity;
+		archetype.ChunkBytes = chunkBytes;
+
+		const auto archetypeIndex = static_cast<std::uint32_t>(mArchetypes.Size());
+		mArchetypes.PushBack(std::move(archetype));
+		mArchetypeMap.Emplace(mask, archetypeIndex);
+
+		return archetypeIndex;
+	}
+
+	ComponentStore::Handle ComponentStore::AllocateHandle()
+	{
+		Handle handle;
+
+		if (mFreeIndices.IsEmpty())
+		{
+			handle.Index = static_cast<std::uint32_t>(mRecords.Size());
+			mRecords.EmplaceBack();
+		}
+		else
+		{
+			handle.Index = mFreeIndices.Back();
+			mFreeIndices.PopBack();
+		}
+
+		handle.Generation = mRecords[handle.Index].Generation;
+		++mSize;
+
+		return handle;
+	}
+
+	std::size_t ComponentStore::AllocateRow(const std::uint32_t archetypeIndex, const Handle& handle)
+	{
+		Archetype& archetype = mArchetypes[archetypeIndex];
+		const std::size_t row = archetype.Count;
+
+		if (row == archetype.Chunks.Size() * archetype.ChunkCapacity)
+		{
+			archetype.Chunks.PushBack(static_cast<std::byte*>(mAllocator->Allocate(archetype.ChunkBytes)));
+		}
+
+		ChunkHandles(archetype.Chunks[row / archetype.ChunkCapacity])[row % archetype.ChunkCapacity] = handle;
+		++archetype.Count;
+
+		return row;
+	}
+
+	void ComponentStore::RemoveRow(const std::uint32_t archetypeIndex, const std::size_t row)
+	{
+		Archetype& archetype = mArchetypes[archetypeIndex];
+		const std::size_t lastRow = archetype.Count - 1;
+
+		if (row != lastRow)
+		{
+			for (const auto& column : archetype.Columns)
+			{
+				std::memcpy(ComponentData(archetype, row, column.TypeId), ComponentData(archetype, lastRow, column.TypeId), column.Size);
+			}
+
+			const Handle movedHandle = ChunkHandles(archetype.Chunks[lastRow / archetype.ChunkCapacity])[lastRow % archetype.ChunkCapacity];
+			ChunkHandles(archetype.Chunks[row / archetype.ChunkCapacity])[row % archetype.ChunkCapacity] = movedHandle;
+			mRecords[movedHandle.Index].Row = row;
+		}
+
+		--archetype.Count;
+
+		if (archetype.Count == (archetype.Chunks.Size() - 1) * archetype.ChunkCapacity)
+		{
+			mAllocator->Deallocate(archetype.Chunks.Back(), archetype.ChunkBytes);
+			archetype.Chunks.PopBack();
+		}
+	}
+
+	void ComponentStore::MoveEntity(const Handle& handle, const ComponentMask mask)
+	{
+		const std::uint32_t destinationIndex = FindOrCreateArchetype(mask);
+
+		Record& record = mRecords[handle.Index];
+		const std::uint32_t sourceIndex = record.Archetype;
+		const std::size_t sourceRow = record.Row;
+		const std::size_t destinationRow = AllocateRow(destinationIndex, handle);
+
+		const Archetype& source = mArchetypes[sourceIndex];
+		const Archetype& destination = mArchetypes[destinationIndex];
+
+		for (const auto& column : destination.Columns)
+		{
+			if (source.Mask & (ComponentMask(1) << column.TypeId))
+			{
+				std::memcpy(ComponentData(destination, destinationRow, column.TypeId), ComponentData(source, sourceRow, column.TypeId), column.Size);
+			}
+		}
+
+		RemoveRow(sourceIndex, sourceRow);
+
+		record.Archetype = destinationIndex;
+		record.Row = destinationRow;
+	}
+
+	void ComponentStore::ReleaseChunks()
+	{
+		for (auto& archetype : mArchetypes)
+		{
+			for (std::byte* chunk : archetype.Chunks)
+			{
+				mAllocator->Deallocate(chunk, archetype.ChunkBytes);
+			}
+
+			archetype.Chunks.Clear();
+			archetype.Count = 0;
+		}
+	}
+
+	const ComponentStore::Record& ComponentStore::GetRecord(const Handle& handle) const
+	{
+		if (!IsAlive(handle)) throw std::runtime_error("Invalid handle.");
+
+		return mRecords[handle.Index];
+	}
+#pragma endregion Helper Methods
+}
\ No newline at end of file
@@ -0,0 +1,474 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+// First Party
+#include "Vector.h"
+#include "FlatHashMap.h"
+#include "HeapAllocator.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	// Forward Declarations
+	struct WorldState;
+
+	/// <summary>
+	/// Data-oriented component storage, kept alongside the Entity tree.
+	/// Entities with the same set of component types share an archetype, whose components live in fixed size chunks
+	/// with one contiguous column per component type. Queries walk those columns directly, without virtual calls.
+	/// </summary>
+	/// <remarks>
+	/// Components must be trivially copyable, since rows are relocated with a bitwise copy when an entity changes archetype.
+	/// Creating, destroying, or changing the components of an entity during a query invalidates the query.
+	/// </remarks>
+	class ComponentStore final
+	{
+#pragma region Type Definitions
+	public:
+		/// <summary>
+		/// Identifies an entity within a ComponentStore.
+		/// The generation is bumped whenever an index is recycled, so handles to destroyed entities never alias new ones.
+		/// </summary>
+		struct Handle final
+		{
+			/// <summary>
+			/// Index value of a Handle that refers to no entity.
+			/// </summary>
+			static constexpr std::uint32_t InvalidIndex = UINT32_MAX;
+
+			/// <summary>
+			/// Slot of the entity in the ComponentStore.
+			/// </summary>
+			std::uint32_t Index{ InvalidIndex };
+
+			/// <summary>
+			/// Number of times the slot had been recycled when the Handle was issued.
+			/// </summary>
+			std::uint32_t Generation{ 0 };
+
+			/// <summary>
+			/// Checks if the Handle was issued by a ComponentStore.
+			/// </summary>
+			/// <returns>True if the Handle has a valid index, otherwise false.</returns>
+			bool IsValid() const;
+
+			/// <summary>
+			/// Equals operator.
+			/// </summary>
+			/// <param name="rhs">Handle to be compared.</param>
+			/// <returns>True if both Handles refer to the same slot and generation, otherwise false.</returns>
+			bool operator==(const Handle& rhs) const;
+
+			/// <summary>
+			/// Not equal operator.
+			/// </summary>
+			/// <param name="rhs">Handle to be compared.</param>
+			/// <returns>True if the Handles differ in slot or generation, otherwise false.</returns>
+			bool operator!=(const Handle& rhs) const;
+		};
+
+		/// <summary>
+		/// Bit set of component type IDs, one bit per registered component type.
+		/// </summary>
+		using ComponentMask = std::uint64_t;
+
+		/// <summary>
+		/// Per-frame pass over the ComponentStore, run by World::Update.
+		/// </summary>
+		using System = std::function<void(ComponentStore&, WorldState&)>;
+
+		/// <summary>
+		/// Max number of distinct component types, one per bit of a ComponentMask.
+		/// </summary>
+		static constexpr std::size_t MaxComponentTypes = sizeof(ComponentMask) * 8;
+
+		/// <summary>
+		/// Target size in bytes of a single chunk of archetype rows.
+		/// </summary>
+		static constexpr std::size_t ChunkSize = 16384;
+
+	private:
+		/// <summary>
+		/// Size and alignment of a registered component type.
+		/// </summary>
+		struct ComponentInfo final
+		{
+			std::size_t Size;
+			std::size_t Alignment;
+		};
+
+		/// <summary>
+		/// Location of a component column within each chunk of an archetype.
+		/// </summary>
+		struct Column final
+		{
+			std::size_t TypeId;
+			std::size_t Size;
+			std::size_t Offset;
+		};
+
+		/// <summary>
+		/// Storage for every entity with the same set of component types.
+		/// Each chunk starts with the Handle of every row, followed by one column per component type ordered by type ID.
+		/// </summary>
+		struct Archetype final
+		{
+			ComponentMask Mask{ 0 };
+			std::size_t ChunkCapacity{ 0 };
+			std::size_t ChunkBytes{ 0 };
+			std::size_t Count{ 0 };
+			Vector<Column> Columns{ Vector<Column>::EqualityFunctor() };
+			Vector<std::byte*> Chunks;
+		};
+
+		/// <summary>
+		/// Location of an entity, indexed by Handle::Index.
+		/// </summary>
+		struct Record final
+		{
+			std::uint32_t Generation{ 0 };
+			std::uint32_t Archetype{ Handle::InvalidIndex };
+			std::size_t Row{ 0 };
+		};
+#pragma endregion Type Definitions
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Default constructor.
+		/// </summary>
+		/// <param name="allocator">Allocator that chunk memory is taken from.</param>
+		explicit ComponentStore(IAllocator& allocator=HeapAllocator::Instance());
+
+		/// <summary>
+		/// Destructor.
+		/// Releases every chunk.
+		/// </summary>
+		~ComponentStore();
+
+		/// <summary>
+		/// Deleted copy constructor, since Handles are only meaningful to the ComponentStore that issued them.
+		/// </summary>
+		ComponentStore(const ComponentStore& rhs) = delete;
+
+		/// <summary>
+		/// Deleted copy assignment operator, since Handles are only meaningful to the ComponentStore that issued them.
+		/// </summary>
+		ComponentStore& operator=(const ComponentStore& rhs) = delete;
+
+		/// <summary>
+		/// Move constructor.
+		/// </summary>
+		/// <param name="rhs">ComponentStore to be moved.</param>
+		ComponentStore(ComponentStore&& rhs) noexcept;
+
+		/// <summary>
+		/// Move assignment operator.
+		/// </summary>
+		/// <param name="rhs">ComponentStore to be moved.</param>
+		/// <returns>Modified ComponentStore with moved values.</returns>
+		ComponentStore& operator=(ComponentStore&& rhs) noexcept;
+#pragma endregion Special Members
+
+#pragma region Component Types
+	public:
+		/// <summary>
+		/// Gets the ID of a component type, registering it on first use.
+		/// </summary>
+		/// <typeparam name="T">Component type.</typeparam>
+		/// <returns>ID of the component type, less than MaxComponentTypes.</returns>
+		/// <exception cref="std::runtime_error">Thrown when more than MaxComponentTypes types are registered.</exception>
+		template<typename T>
+		static std::size_t ComponentTypeOf();
+
+		/// <summary>
+		/// Gets the ComponentMask of a set of component types.
+		/// </summary>
+		/// <typeparam name="Ts">Component types.</typeparam>
+		/// <returns>ComponentMask with the bit of each given type set.</returns>
+		template<typename... Ts>
+		static ComponentMask MaskOf();
+#pragma endregion Component Types
+
+#pragma region Entities
+	public:
+		/// <summary>
+		/// Gets the number of live entities.
+		/// </summary>
+		/// <returns>Number of live entities.</returns>
+		std::size_t Size() const;
+
+		/// <summary>
+		/// Gets the number of archetypes created so far.
+		/// </summary>
+		/// <returns>Number of archetypes.</returns>
+		std::size_t ArchetypeCount() const;
+
+		/// <summary>
+		/// Checks if a Handle refers to a live entity.
+		/// </summary>
+		/// <param name="handle">Handle to be checked.</param>
+		/// <returns>True if the entity is alive, otherwise false.</returns>
+		bool IsAlive(const Handle& handle) const;
+
+		/// <summary>
+		/// Creates an entity with the given components.
+		/// </summary>
+		/// <param name="components">Initial values of the components.</param>
+		/// <typeparam name="Ts">Component types, each appearing at most once.</typeparam>
+		/// <returns>Handle to the new entity.</returns>
+		template<typename... Ts>
+		Handle Create(const Ts&... components);
+
+		/// <summary>
+		/// Destroys an entity and its components.
+		/// </summary>
+		/// <param name="handle">Handle to the entity.</param>
+		/// <returns>True if the entity was alive, otherwise false.</returns>
+		bool Destroy(const Handle& handle);
+
+		/// <summary>
+		/// Destroys every entity and releases every chunk. Archetypes and Systems are kept.
+		/// </summary>
+		void Clear();
+#pragma endregion Entities
+
+#pragma region Components
+	public:
+		/// <summary>
+		/// Checks if an entity has a component.
+		/// </summary>
+		/// <param name="handle">Handle to the entity.</param>
+		/// <typeparam name="T">Component type.</typeparam>
+		/// <returns>True if the entity is alive and has the component, otherwise false.</returns>
+		template<typename T>
+		bool Has(const Handle& handle) const;
+
+		/// <summary>
+		/// Gets a component of an entity.
+		/// </summary>
+		/// <param name="handle">Handle to the entity.</param>
+		/// <typeparam name="T">Component type.</typeparam>
+		/// <returns>Reference to the component, valid until the next structural change.</returns>
+		/// <exception cref="std::runtime_error">Invalid handle, or missing component.</exception>
+		template<typename T>
+		T& Get(const Handle& handle);
+
+		/// <summary>
+		/// Gets a component of an entity.
+		/// </summary>
+		/// <param name="handle">Handle to the entity.</param>
+		/// <typeparam name="T">Component type.</typeparam>
+		/// <returns>Const reference to the component, valid until the next structural change.</returns>
+		/// <exception cref="std::runtime_error">Invalid handle, or missing component.</exception>
+		template<typename T>
+		const T& Get(const Handle& handle) const;
+
+		/// <summary>
+		/// Adds a component to an entity, moving it to a new archetype. Sets the value if the component already exists.
+		/// </summary>
+		/// <param name="handle">Handle to the entity.</param>
+		/// <param name="component">Value of the component.</param>
+		/// <typeparam name="T">Component type.</typeparam>
+		/// <returns>Reference to the component, valid until the next structural change.</returns>
+		/// <exception cref="std::runtime_error">Invalid handle.</exception>
+		template<typename T>
+		T& Add(const Handle& handle, const T& component=T());
+
+		/// <summary>
+		/// Removes a component from an entity, moving it to a new archetype.
+		/// </summary>
+		/// <param name="handle">Handle to the entity.</param>
+		/// <typeparam name="T">Component type.</typeparam>
+		/// <returns>True if the component was removed, otherwise false.</returns>
+		/// <exception cref="std::runtime_error">Invalid handle.</exception>
+		template<typename T>
+		bool Remove(const Handle& handle);
+#pragma endregion Components
+
+#pragma region Queries
+	public:
+		/// <summary>
+		/// Calls a functor on every chunk holding all of the given component types.
+		/// The functor receives the row count followed by a pointer to the first element of each column.
+		/// </summary>
+		/// <param name="functor">Callable as functor(std::size_t count, Ts*... columns).</param>
+		/// <typeparam name="Ts">Component types to be queried.</typeparam>
+		template<typename... Ts, typename Functor>
+		void ForEachChunk(Functor&& functor);
+
+		/// <summary>
+		/// Calls a functor on every entity holding all of the given component types.
+		/// </summary>
+		/// <param name="functor">Callable as functor(Ts&... components).</param>
+		/// <typeparam name="Ts">Component types to be queried.</typeparam>
+		template<typename... Ts, typename Functor>
+		void ForEach(Functor&& functor);
+#pragma endregion Queries
+
+#pragma region Systems
+	public:
+		/// <summary>
+		/// Adds a System to be run on every Update, in the order added.
+		/// </summary>
+		/// <param name="system">System to be added.</param>
+		void AddSystem(System system);
+
+		/// <summary>
+		/// Gets the number of Systems.
+		/// </summary>
+		/// <returns>Number of Systems.</returns>
+		std::size_t SystemCount() const;
+
+		/// <summary>
+		/// Runs every System in order.
+		/// </summary>
+		/// <param name="worldState">WorldState context for the current processing step.</param>
+		void Update(WorldState& worldState);
+#pragma endregion Systems
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Registers a component type.
+		/// </summary>
+		/// <param name="size">Size of the component type.</param>
+		/// <param name="alignment">Alignment of the component type.</param>
+		/// <returns>ID of the new component type.</returns>
+		/// <exception cref="std::runtime_error">Thrown when more than MaxComponentTypes types are registered.</exception>
+		static std::size_t RegisterComponentType(const std::size_t size, const std::size_t alignment);
+
+		/// <summary>
+		/// Gets the position of a component type among the columns of an archetype.
+		/// </summary>
+		/// <param name="mask">ComponentMask of the archetype.</param>
+		/// <param name="typeId">Component type ID, whose bit is set in the mask.</param>
+		/// <returns>Index of the column.</returns>
+		static std::size_t ColumnIndex(const ComponentMask mask, const std::size_t typeId);
+
+		/// <summary>
+		/// Finds or creates the archetype for a ComponentMask.
+		/// </summary>
+		/// <param name="mask">ComponentMask of the archetype.</param>
+		/// <returns>Index of the archetype.</returns>
+		std::uint32_t FindOrCreateArchetype(const ComponentMask mask);
+
+		/// <summary>
+		/// Issues a Handle, recycling a free slot if one exists.
+		/// </summary>
+		/// <returns>New Handle, whose Record has no archetype yet.</returns>
+		Handle AllocateHandle();
+
+		/// <summary>
+		/// Appends an uninitialized row to an archetype, allocating a chunk when the last one is full.
+		/// </summary>
+		/// <param name="archetypeIndex">Index of the archetype.</param>
+		/// <param name="handle">Handle of the entity that owns the row.</param>
+		/// <returns>Index of the new row.</returns>
+		std::size_t AllocateRow(const std::uint32_t archetypeIndex, const Handle& handle);
+
+		/// <summary>
+		/// Removes a row from an archetype by moving the last row into it.
+		/// Releases the last chunk once it is empty.
+		/// </summary>
+		/// <param name="archetypeIndex">Index of the archetype.</param>
+		/// <param name="row">Index of the row to be removed.</param>
+		void RemoveRow(const std::uint32_t archetypeIndex, const std::size_t row);
+
+		/// <summary>
+		/// Moves an entity to another archetype, copying the components both archetypes share.
+		/// </summary>
+		/// <param name="handle">Handle of a live entity.</param>
+		/// <param name="mask">ComponentMask of the destination archetype.</param>
+		void MoveEntity(const Handle& handle, const ComponentMask mask);
+
+		/// <summary>
+		/// Releases the chunks of every archetype, leaving each archetype empty.
+		/// </summary>
+		void ReleaseChunks();
+
+		/// <summary>
+		/// Gets the Record of a live entity.
+		/// </summary>
+		/// <param name="handle">Handle to the entity.</param>
+		/// <returns>Reference to the Record.</returns>
+		/// <exception cref="std::runtime_error">Invalid handle.</exception>
+		const Record& GetRecord(const Handle& handle) const;
+
+		/// <summary>
+		/// Gets the address of a component within an archetype.
+		/// </summary>
+		/// <param name="archetype">Archetype holding the component.</param>
+		/// <param name="row">Row of the entity.</param>
+		/// <param name="typeId">Component type ID, whose bit is set in the archetype mask.</param>
+		/// <returns>Pointer to the component.</returns>
+		static std::byte* ComponentData(const Archetype& archetype, const std::size_t row, const std::size_t typeId);
+
+		/// <summary>
+		/// Gets the Handle array at the start of a chunk.
+		/// </summary>
+		/// <param name="chunk">Chunk of an archetype.</param>
+		/// <returns>Pointer to the first Handle in the chunk.</returns>
+		static Handle* ChunkHandles(std::byte* chunk);
+#pragma endregion Helper Methods
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Size and alignment of every registered component type, indexed by type ID.
+		/// Fixed size, so registering a type never allocates.
+		/// </summary>
+		static ComponentInfo sComponentInfos[MaxComponentTypes];
+
+		/// <summary>
+		/// Number of registered component types.
+		/// </summary>
+		static std::atomic<std::size_t> sComponentTypeCount;
+
+		/// <summary>
+		/// Allocator that chunk memory is taken from.
+		/// </summary>
+		IAllocator* mAllocator;
+
+		/// <summary>
+		/// Every archetype created so far. Records refer to them by index.
+		/// </summary>
+		Vector<Archetype> mArchetypes{ Vector<Archetype>::EqualityFunctor() };
+
+		/// <summary>
+		/// Map from a ComponentMask to the index of its archetype.
+		/// </summary>
+		FlatHashMap<ComponentMask, std::uint32_t> mArchetypeMap;
+
+		/// <summary>
+		/// Location of every entity, indexed by Handle::Index.
+		/// </summary>
+		Vector<Record> mRecords{ Vector<Record>::EqualityFunctor() };
+
+		/// <summary>
+		/// Slots of destroyed entities, to be recycled by Create.
+		/// </summary>
+		Vector<std::uint32_t> mFreeIndices;
+
+		/// <summary>
+		/// Systems run on every Update.
+		/// </summary>
+		Vector<System> mSystems{ Vector<System>::EqualityFunctor() };
+
+		/// <summary>
+		/// Number of live entities.
+		/// </summary>
+		std::size_t mSize{ 0 };
+#pragma endregion Data Members
+	};
+}
+
+// Inline File
+#include "ComponentStore.inl"
\ No newline at end of file
@@ -0,0 +1,208 @@
+#pragma once
+
+// Header
+#include "ComponentStore.h"
+
+namespace Library
+{
+#pragma region Handle
+	inline bool ComponentStore::Handle::IsValid() const
+	{
+		return Index != InvalidIndex;
+	}
+
+	inline bool ComponentStore::Handle::operator==(const Handle& rhs) const
+	{
+		return Index == rhs.Index && Generation == rhs.Generation;
+	}
+
+	inline bool ComponentStore::Handle::operator!=(const Handle& rhs) const
+	{
+		return !(operator==(rhs));
+	}
+#pragma endregion Handle
+
+#pragma region Component Types
+	template<typename T>
+	inline std::size_t ComponentStore::ComponentTypeOf()
+	{
+		static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>, "Components must be trivially copyable.");
+		static_assert(alignof(T) <= alignof(std::max_align_t), "Components cannot be over-aligned.");
+
+		static const std::size_t typeId = RegisterComponentType(sizeof(T), alignof(T));
+		return typeId;
+	}
+
+	template<typename... Ts>
+	inline ComponentStore::ComponentMask ComponentStore::MaskOf()
+	{
+		return (ComponentMask(0) | ... | (ComponentMask(1) << ComponentTypeOf<Ts>()));
+	}
+#pragma endregion Component Types
+
+#pragma region Entities
+	inline std::size_t ComponentStore::Size() const
+	{
+		return mSize;
+	}
+
+	inline std::size_t ComponentStore::ArchetypeCount() const
+	{
+		return mArchetypes.Size();
+	}
+
+	inline bool ComponentStore::IsAlive(const Handle& handle) const
+	{
+		if (handle.Index >= mRecords.Size()) return false;
+
+		const Record& record = mRecords[handle.Index];
+		return record.Generation == handle.Generation && record.Archetype != Handle::InvalidIndex;
+	}
+
+	template<typename... Ts>
+	inline ComponentStore::Handle ComponentStore::Create(const Ts&... components)
+	{
+		const std::uint32_t archetypeIndex = FindOrCreateArchetype(MaskOf<Ts...>());
+		const Handle handle = AllocateHandle();
+
+		Record& record = mRecords[handle.Index];
+		record.Archetype = archetypeIndex;
+		record.Row = AllocateRow(archetypeIndex, handle);
+
+		[[maybe_unused]] const Archetype& archetype = mArchetypes[archetypeIndex];
+		(new(ComponentData(archetype, record.Row, ComponentTypeOf<Ts>()))Ts(components), ...);
+
+		return handle;
+	}
+#pragma endregion Entities
+
+#pragma region Components
+	template<typename T>
+	inline bool ComponentStore::Has(const Handle& handle) const
+	{
+		return IsAlive(handle) && (mArchetypes[mRecords[handle.Index].Archetype].Mask & (ComponentMask(1) << ComponentTypeOf<T>()));
+	}
+
+	template<typename T>
+	inline T& ComponentStore::Get(const Handle& handle)
+	{
+		const std::size_t typeId = ComponentTypeOf<T>();
+		const Record& record = GetRecord(handle);
+		const Archetype& archetype = mArchetypes[record.Archetype];
+
+		if (!(archetype.Mask & (ComponentMask(1) << typeId))) throw std::runtime_error("Component not found.");
+
+		return *reinterpret_cast<T*>(ComponentData(archetype, record.Row, typeId));
+	}
+
+	template<typename T>
+	inline const T& ComponentStore::Get(const Handle& handle) const
+	{
+		const std::size_t typeId = ComponentTypeOf<T>();
+		const Record& record = GetRecord(handle);
+		const Archetype& archetype = mArchetypes[record.Archetype];
+
+		if (!(archetype.Mask & (ComponentMask(1) << typeId))) throw std::runtime_error("Component not found.");
+
+		return *reinterpret_cast<const T*>(ComponentData(archetype, record.Row, typeId));
+	}
+
+	template<typename T>
+	inline T& ComponentStore::Add(const Handle& handle, const T& component)
+	{
+		const std::size_t typeId = ComponentTypeOf<T>();
+		const ComponentMask mask = mArchetypes[GetRecord(handle).Archetype].Mask;
+
+		if (!(mask & (ComponentMask(1) << typeId)))
+		{
+			MoveEntity(handle, mask | (ComponentMask(1) << typeId));
+		}
+
+		const Record& record = mRecords[handle.Index];
+		return *new(ComponentData(mArchetypes[record.Archetype], record.Row, typeId))T(component);
+	}
+
+	template<typename T>
+	inline bool ComponentStore::Remove(const Handle& handle)
+	{
+		const ComponentMask bit = ComponentMask(1) << ComponentTypeOf<T>();
+		const ComponentMask mask = mArchetypes[GetRecord(handle).Archetype].Mask;
+
+		if (!(mask & bit)) return false;
+
+		MoveEntity(handle, mask & ~bit);
+		return true;
+	}
+#pragma endregion Components
+
+#pragma region Queries
+	template<typename... Ts, typename Functor>
+	inline void ComponentStore::ForEachChunk(Functor&& functor)
+	{
+		static_assert(sizeof...(Ts) > 0, "Queries require at least one component type.");
+
+		const ComponentMask mask = MaskOf<Ts...>();
+
+		for (const Archetype& archetype : mArchetypes)
+		{
+			if ((archetype.Mask & mask) != mask) continue;
+
+			std::size_t remaining = archetype.Count;
+
+			for (std::byte* chunk : archetype.Chunks)
+			{
+				if (remaining == 0) break;
+
+				const std::size_t count = std::min(remaining, archetype.ChunkCapacity);
+				functor(count, reinterpret_cast<Ts*>(chunk + archetype.Columns[ColumnIndex(archetype.Mask, ComponentTypeOf<Ts>())].Offset)...);
+				remaining -= count;
+			}
+		}
+	}
+
+	template<typename... Ts, typename Functor>
+	inline void ComponentStore::ForEach(Functor&& functor)
+	{
+		ForEachChunk<Ts...>([&functor](const std::size_t count, Ts*... columns)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				functor(columns[i]...);
+			}
+		});
+	}
+#pragma endregion Queries
+
+#pragma region Systems
+	inline std::size_t ComponentStore::SystemCount() const
+	{
+		return mSystems.Size();
+	}
+#pragma endregion Systems
+
+#pragma region Helper Methods
+	inline std::size_t ComponentStore::ColumnIndex(const ComponentMask mask, const std::size_t typeId)
+	{
+		ComponentMask lowerBits = mask & ((ComponentMask(1) << typeId) - 1);
+		std::size_t index = 0;
+
+		for (; lowerBits != 0; lowerBits &= lowerBits - 1)
+		{
+			++index;
+		}
+
+		return index;
+	}
+
+	inline std::byte* ComponentStore::ComponentData(const Archetype& archetype, const std::size_t row, const std::size_t typeId)
+	{
+		const Column& column = archetype.Columns[ColumnIndex(archetype.Mask, typeId)];
+		return archetype.Chunks[row / archetype.ChunkCapacity] + column.Offset + (row % archetype.ChunkCapacity) * column.Size;
+	}
+
+	inline ComponentStore::Handle* ComponentStore::ChunkHandles(std::byte* chunk)
+	{
+		return reinterpret_cast<Handle*>(chunk);
+	}
+#pragma endregion Helper Methods
+}
\ No newline at end of file
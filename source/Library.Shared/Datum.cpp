@@ -11,143 +11,141 @@
 
 namespace Library
 {
-#pragma region Look Up Tables
-	const Datum::EqualityFunctor Datum::EqualityLUT[static_cast<std::size_t>(Types::End)] =
-	{
-		[](void* lhs, void* rhs, const std::size_t size) { return memcmp(lhs, rhs, size * TypeSizeLUT[static_cast<std::size_t>(Types::Integer)]) == 0; },
-		[](void* lhs, void* rhs, const std::size_t size) { return memcmp(lhs, rhs, size * TypeSizeLUT[static_cast<std::size_t>(Types::Float)]) == 0; },
-		[](void* lhs, void* rhs, const std::size_t size) { return memcmp(lhs, rhs, size * TypeSizeLUT[static_cast<std::size_t>(Types::Vector)]) == 0; },
-		[](void* lhs, void* rhs, const std::size_t size) { return memcmp(lhs, rhs, size * TypeSizeLUT[static_cast<std::size_t>(Types::Matrix)]) == 0; },
-		[](void* lhs, void* rhs, const std::size_t size) 
-		{ 
-			for (std::size_t i = 0; i < size; ++i)
-			{
-				if (static_cast<std::string*>(lhs)[i] != static_cast<std::string*>(rhs)[i])
-				{
-					return false;
-				}
-			}
+#pragma region Type Helpers
+	static_assert(std::tuple_size_v<Datum::TypeList> == static_cast<std::size_t>(Datum::Types::End), "TypeList does not match Types.");
 
-			return true;
-		},
-		[](void* lhs, void* rhs, const std::size_t size)
+	template<typename T>
+	bool Datum::RangeEquals(const T* lhs, const T* rhs, const std::size_t size)
+	{
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			return std::memcmp(lhs, rhs, size * sizeof(T)) == 0;
+		}
+		else
 		{
-			ScopePointer* lhsScope = static_cast<ScopePointer*>(lhs);
-			ScopePointer* rhsScope = static_cast<ScopePointer*>(rhs);
+			return std::equal(lhs, lhs + size, rhs);
+		}
+	}
 
-			for (std::size_t i = 0; i < size; ++i)
+	template<>
+	bool Datum::RangeEquals<Datum::ScopePointer>(const ScopePointer* lhs, const ScopePointer* rhs, const std::size_t size)
+	{
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			if (!lhs[i] && !rhs[i]) continue;
+			if (!lhs[i] || !rhs[i] || *lhs[i] != *rhs[i])
 			{
-				if (!lhsScope[i] && !rhsScope[i]) continue;
-				if (!lhsScope[i] || !rhsScope[i] || *lhsScope[i] != *rhsScope[i])
-				{
-					return false;
-				}
+				return false;
 			}
+		}
 
-			return true;
-		},
-		[](void* lhs, void* rhs, const std::size_t size) 
-		{
-			RTTIPointer* lhsRTTI = static_cast<RTTIPointer*>(lhs);
-			RTTIPointer* rhsRTTI = static_cast<RTTIPointer*>(rhs);
+		return true;
+	}
 
-			for (std::size_t i = 0; i < size; ++i)
-			{
-				if (!lhsRTTI[i] && !rhsRTTI[i]) continue;
-				if (!lhsRTTI[i] || !rhsRTTI[i] || !lhsRTTI[i]->Equals(rhsRTTI[i]))
-				{
-					return false;
-				}
-			}
-			
-			return true;
-		},
-		[](void* lhs, void* rhs, const std::size_t size) 
+	template<>
+	bool Datum::RangeEquals<Datum::RTTIPointer>(const RTTIPointer* lhs, const RTTIPointer* rhs, const std::size_t size)
+	{
+		for (std::size_t i = 0; i < size; ++i)
 		{
-			DatumPointer* lhsDatum = static_cast<DatumPointer*>(lhs);
-			DatumPointer* rhsDatum = static_cast<DatumPointer*>(rhs);
-
-			for (std::size_t i = 0; i < size; ++i)
+			if (!lhs[i] && !rhs[i]) continue;
+			if (!lhs[i] || !rhs[i] || !lhs[i]->Equals(rhs[i]))
 			{
-				if (!lhsDatum[i] && !rhsDatum[i]) continue;
-				if (!lhsDatum[i] || !rhsDatum[i] || lhsDatum[i] != rhsDatum[i])
-				{
-					return false;
-				}
+				return false;
 			}
-			
-			return true;
 		}
-	};
 
-	const Datum::ElementEqualityFunctor Datum::ElementEqualityLUT[static_cast<std::size_t>(Types::End)] =
+		return true;
+	}
+
+	template<typename T>
+	bool Datum::ElementEquals(const T& lhs, const T& rhs)
 	{
-		[](void* lhs, void* rhs) { return *static_cast<int*>(lhs) == *static_cast<int*>(rhs); },
-		[](void* lhs, void* rhs) { return *static_cast<float*>(lhs) == *static_cast<float*>(rhs); },
-		[](void* lhs, void* rhs) { return *static_cast<glm::vec4*>(lhs) == *static_cast<glm::vec4*>(rhs); },
-		[](void* lhs, void* rhs) { return *static_cast<glm::mat4*>(lhs) == *static_cast<glm::mat4*>(rhs); },
-		[](void* lhs, void* rhs) { return *static_cast<std::string*>(lhs) == *static_cast<std::string*>(rhs); },
-		[](void* lhs, void* rhs)
-		{
-			ScopePointer* lhsScope = static_cast<ScopePointer*>(lhs);
-			ScopePointer* rhsScope = static_cast<ScopePointer*>(rhs);
-			return ((!*lhsScope && !*rhsScope) || (*lhsScope && (*lhsScope)->Equals(*rhsScope)));
-		},
-		[](void* lhs, void* rhs) 
+		return lhs == rhs;
+	}
+
+	template<>
+	bool Datum::ElementEquals<Datum::ScopePointer>(const ScopePointer& lhs, const ScopePointer& rhs)
+	{
+		return (!lhs && !rhs) || (lhs && lhs->Equals(rhs));
+	}
+
+	template<>
+	bool Datum::ElementEquals<Datum::RTTIPointer>(const RTTIPointer& lhs, const RTTIPointer& rhs)
+	{
+		return (!lhs && !rhs) || (lhs && lhs->Equals(rhs));
+	}
+
+	template<>
+	bool Datum::ElementEquals<Datum::DatumPointer>(const DatumPointer& lhs, const DatumPointer& rhs)
+	{
+		return (!lhs && !rhs) || (lhs && rhs && *lhs == *rhs);
+	}
+
+	template<typename T>
+	T Datum::DefaultValue()
+	{
+		if constexpr (std::is_same_v<T, glm::vec4> || std::is_same_v<T, glm::mat4>)
 		{
-			RTTIPointer* lhsRTTI = static_cast<RTTIPointer*>(lhs);
-			RTTIPointer* rhsRTTI = static_cast<RTTIPointer*>(rhs);
-			return ((!*lhsRTTI && !*rhsRTTI) || (*lhsRTTI && (*lhsRTTI)->Equals(*rhsRTTI)));
-		},
-		[](void* lhs, void* rhs) 
+			return T(0.0f);
+		}
+		else
 		{
-			DatumPointer* lhsDatum = static_cast<DatumPointer*>(lhs);
-			DatumPointer* rhsDatum = static_cast<DatumPointer*>(rhs);
-			return ((!*lhsDatum && !*rhsDatum) || (*lhsDatum && *rhsDatum && **lhsDatum == **rhsDatum));
+			return T{};
 		}
-	};
+	}
 
-	const Datum::CreateDefaultFunctor Datum::CreateDefaultLUT[static_cast<std::size_t>(Types::End)] =
+	template<typename T>
+	std::string Datum::ElementToString(const void* data, const std::size_t index)
 	{
-		[](void* data, const std::size_t index) { new(static_cast<int*>(data) + index)int(0); },
-		[](void* data, const std::size_t index) { new(static_cast<float*>(data) + index)float(0.0f); },
-		[](void* data, const std::size_t index) { new(static_cast<glm::vec4*>(data) + index)glm::vec4(0.0f); },
-		[](void* data, const std::size_t index) { new(static_cast<glm::mat4*>(data) + index)glm::mat4(0.0f); },
-		[](void* data, const std::size_t index) { new(static_cast<std::string*>(data) + index)std::string(); },
-		[](void* data, const std::size_t index) { new(static_cast<ScopePointer*>(data) + index)ScopePointer(nullptr); },
-		[](void* data, const std::size_t index) { new(static_cast<RTTIPointer*>(data) + index)RTTIPointer(nullptr); },
-		[](void* data, const std::size_t index) { new(static_cast<DatumPointer*>(data) + index)DatumPointer(nullptr); }
-	};
+		const T& value = static_cast<const T*>(data)[index];
 
-	const Datum::ToStringFunctor Datum::ToStringLUT[static_cast<std::size_t>(Types::End)] =
-	{
-		[](void* data, const std::size_t index) { return std::to_string(static_cast<int*>(data)[index]); },
-		[](void* data, const std::size_t index) { return std::to_string(static_cast<float*>(data)[index]); },
-		[](void* data, const std::size_t index) { return glm::to_string(static_cast<glm::vec4*>(data)[index]); },
-		[](void* data, const std::size_t index) { return glm::to_string(static_cast<glm::mat4*>(data)[index]); },
-		[](void* data, const std::size_t index) { return static_cast<std::string*>(data)[index]; },
-		[](void* data, const std::size_t index) { const ScopePointer ptr = static_cast<ScopePointer*>(data)[index]; return ptr ? ptr->ToString() : "nullptr";  },
-		[](void* data, const std::size_t index) { const RTTIPointer ptr = static_cast<RTTIPointer*>(data)[index]; return ptr ? ptr->ToString() : "nullptr";  },
-		[](void* data, const std::size_t index) { const DatumPointer ptr = static_cast<DatumPointer*>(data)[index]; return ptr ? ptr->ToString() : "nullptr";  }
-	};
+		if constexpr (std::is_same_v<T, std::string>)
+		{
+			return value;
+		}
+		else if constexpr (std::is_pointer_v<T>)
+		{
+			return value ? value->ToString() : "nullptr";
+		}
+		else if constexpr (std::is_arithmetic_v<T>)
+		{
+			return std::to_string(value);
+		}
+		else
+		{
+			return glm::to_string(value);
+		}
+	}
 
-	const Datum::FromStringFunctor Datum::FromStringLUT[static_cast<std::size_t>(Types::End)] =
+	template<typename T>
+	void Datum::ElementFromString(const std::string& str, void* data, const std::size_t index)
 	{
-		[](const std::string& str, void* data, const std::size_t index) { static_cast<int*>(data)[index] = std::stoi(str); },
-		[](const std::string& str, void* data, const std::size_t index) { static_cast<float*>(data)[index] = std::stof(str); },
-		[](const std::string& str, void* data, const std::size_t index)
+		T& value = static_cast<T*>(data)[index];
+
+		if constexpr (std::is_same_v<T, int>)
+		{
+			value = std::stoi(str);
+		}
+		else if constexpr (std::is_same_v<T, float>)
 		{
-			float* vector = glm::value_ptr(static_cast<glm::vec4*>(data)[index]);
+			value = std::stof(str);
+		}
+		else if constexpr (std::is_same_v<T, std::string>)
+		{
+			value = str;
+		}
+		else if constexpr (std::is_same_v<T, glm::vec4>)
+		{
+			float* vector = glm::value_ptr(value);
 #if defined (_WIN32)
 			sscanf_s(str.c_str(), "vec4(%f,%f,%f,%f)", &vector[0], &vector[1], &vector[2], &vector[3]);
 #else
 			sscanf(str.c_str(), "vec4(%f,%f,%f,%f)", &vector[0], &vector[1], &vector[2], &vector[3]);
 #endif
-
-		},
-		[](const std::string& str, void* data, std::size_t index)
+		}
+		else
 		{
-			float* matrix = glm::value_ptr(static_cast<glm::mat4*>(data)[index]);
+			float* matrix = glm::value_ptr(value);
 #if defined (_WIN32)
 			sscanf_s(str.c_str(), "mat4x4((%f,%f,%f,%f), (%f,%f,%f,%f), (%f,%f,%f,%f), (%f,%f,%f,%f))",
 						&matrix[0], &matrix[1], &matrix[2], &matrix[3],
@@ -161,11 +159,40 @@ namespace Library
 					&matrix[8], &matrix[9], &matrix[10], &matrix[11],
 					&matrix[12], &matrix[13], &matrix[14], &matrix[15]);
 #endif
-		},
-		[](const std::string& str, void* data, const std::size_t index) { static_cast<std::string*>(data)[index] = str; },
-		[](const std::string&, void*, const std::size_t) {},
-		[](const std::string&, void*, const std::size_t) {},
-		[](const std::string&, void*, const std::size_t) {}
+		}
+	}
+
+	template<>
+	void Datum::ElementFromString<Datum::ScopePointer>(const std::string&, void*, const std::size_t)
+	{
+	}
+
+	template<>
+	void Datum::ElementFromString<Datum::RTTIPointer>(const std::string&, void*, const std::size_t)
+	{
+	}
+
+	template<>
+	void Datum::ElementFromString<Datum::DatumPointer>(const std::string&, void*, const std::size_t)
+	{
+	}
+#pragma endregion Type Helpers
+
+#pragma region Look Up Tables
+	const Datum::ToStringFunction Datum::ToStringLUT[static_cast<std::size_t>(Types::End)] =
+	{
+		&ElementToString<int>, &ElementToString<float>,
+		&ElementToString<glm::vec4>, &ElementToString<glm::mat4>,
+		&ElementToString<std::string>, &ElementToString<ScopePointer>,
+		&ElementToString<RTTIPointer>, &ElementToString<DatumPointer>
+	};
+
+	const Datum::FromStringFunction Datum::FromStringLUT[static_cast<std::size_t>(Types::End)] =
+	{
+		&ElementFromString<int>, &ElementFromString<float>,
+		&ElementFromString<glm::vec4>, &ElementFromString<glm::mat4>,
+		&ElementFromString<std::string>, &ElementFromString<ScopePointer>,
+		&ElementFromString<RTTIPointer>, &ElementFromString<DatumPointer>
 	};
 #pragma endregion Look Up Tables
 
@@ -173,18 +200,14 @@ namespace Library
 	Datum::~Datum()
 	{
 		Clear();
-	
-		if (mInternalStorage && mData.VoidPtr != nullptr)
-		{
-			free(mData.VoidPtr);
-		}
+		FreeStorage();
 	
 		mData.VoidPtr = nullptr;
 		mCapacity = 0;
 	}
 	
 	Datum::Datum(const Datum& rhs) :
-		mType(rhs.mType), mSize(rhs.mSize), mInternalStorage(rhs.mInternalStorage), mReserveFunctor(rhs.mReserveFunctor)
+		mSize(rhs.mSize), mType(rhs.mType), mInternalStorage(rhs.mInternalStorage), mReserveStrategy(rhs.mReserveStrategy)
 	{
 		if (this != &rhs)
 		{
@@ -192,18 +215,11 @@ namespace Library
 			{
 				Reserve(rhs.mCapacity);
 
-				if (mType == Types::String)
-				{
-					for (std::size_t i = 0; i < mSize; ++i)
-					{
-						new(mData.StringPtr + i)std::string(rhs.mData.StringPtr[i]);
-					}
-				}
-				else if (mData.VoidPtr && rhs.mData.VoidPtr)
+				Visit([&rhs](auto data)
 				{
-					const std::size_t dataSize = TypeSizeLUT[static_cast<std::size_t>(mType)];
-					std::memcpy(mData.VoidPtr, rhs.mData.VoidPtr, rhs.mSize * dataSize);
-				}
+					using T = typename decltype(data)::element_type;
+					std::uninitialized_copy_n(static_cast<const T*>(rhs.mData.VoidPtr), data.size(), data.data());
+				});
 			}
 			else
 			{
@@ -217,6 +233,24 @@ namespace Library
 	{
 		if (this != &rhs)
 		{
+			if (mType != Types::Unknown && mType == rhs.mType && mInternalStorage && rhs.mInternalStorage && mCapacity >= rhs.mSize && mCapacity > 0)
+			{
+				Visit([this, &rhs](auto data)
+				{
+					using T = typename decltype(data)::element_type;
+					const T* source = static_cast<const T*>(rhs.mData.VoidPtr);
+					const std::size_t assignedCount = std::min(mSize, rhs.mSize);
+
+					std::copy_n(source, assignedCount, data.data());
+					std::uninitialized_copy(source + assignedCount, source + rhs.mSize, data.data() + assignedCount);
+					std::destroy(data.data() + assignedCount, data.data() + mSize);
+				});
+
+				mSize = rhs.mSize;
+				mReserveStrategy = rhs.mReserveStrategy;
+				return *this;
+			}
+
 			if (mSize > 0)
 			{
 				Clear();
@@ -226,24 +260,17 @@ namespace Library
 			mType = rhs.mType;
 			mSize = rhs.mSize;
 			mInternalStorage = rhs.mInternalStorage;
-			mReserveFunctor = rhs.mReserveFunctor;
+			mReserveStrategy = rhs.mReserveStrategy;
 
 			if (rhs.mInternalStorage && rhs.mCapacity > 0)
 			{
 				Reserve(rhs.mCapacity);
 
-				if (mType == Types::String)
+				Visit([&rhs](auto data)
 				{
-					for (std::size_t i = 0; i < mSize; ++i)
-					{
-						new(mData.StringPtr + i)std::string(rhs.mData.StringPtr[i]);
-					}
-				}
-				else
-				{
-					const std::size_t dataSize = TypeSizeLUT[static_cast<std::size_t>(mType)];
-					std::memcpy(mData.VoidPtr, rhs.mData.VoidPtr, rhs.mSize * dataSize);
-				}
+					using T = typename decltype(data)::element_type;
+					std::uninitialized_copy_n(static_cast<const T*>(rhs.mData.VoidPtr), data.size(), data.data());
+				});
 			}
 			else
 			{
@@ -256,9 +283,15 @@ namespace Library
 	}
 	
 	Datum::Datum(Datum&& rhs) noexcept :
-		mData(rhs.mData), mType(rhs.mType), mSize(rhs.mSize), mCapacity(rhs.mCapacity), 
-		mInternalStorage(rhs.mInternalStorage), mReserveFunctor(rhs.mReserveFunctor)
+		mData(rhs.mData), mSize(rhs.mSize), mCapacity(rhs.mCapacity), mType(rhs.mType),
+		mInternalStorage(rhs.mInternalStorage), mReserveStrategy(rhs.mReserveStrategy)
 	{
+		if (rhs.IsInlineStorage())
+		{
+			std::memcpy(mInlineStorage, rhs.mInlineStorage, InlineCapacity);
+			mData.BytePtr = mInlineStorage;
+		}
+
 		rhs.mData.VoidPtr = nullptr;
 		rhs.mSize = 0;
 		rhs.mCapacity = 0;
@@ -272,15 +305,22 @@ namespace Library
 			if (mInternalStorage && mCapacity > 0)
 			{
 				Clear();
-				free(mData.VoidPtr);
+				FreeStorage();
 			}
 
 			mData.VoidPtr = rhs.mData.VoidPtr;
+
+			if (rhs.IsInlineStorage())
+			{
+				std::memcpy(mInlineStorage, rhs.mInlineStorage, InlineCapacity);
+				mData.BytePtr = mInlineStorage;
+			}
+
 			mType = rhs.mType;
 			mSize = rhs.mSize;
 			mCapacity = rhs.mCapacity;
 			mInternalStorage = rhs.mInternalStorage;
-			mReserveFunctor = rhs.mReserveFunctor;
+			mReserveStrategy = rhs.mReserveStrategy;
 
 			rhs.mData.VoidPtr = nullptr;
 			rhs.mSize = 0;
@@ -463,7 +503,11 @@ namespace Library
 		if (mType != rhs.mType || mSize != rhs.mSize)	return false;
 		if (mType == Types::Unknown)					return true;
 		
-		return EqualityLUT[static_cast<std::size_t>(mType)](mData.VoidPtr, rhs.mData.VoidPtr, mSize);
+		return Visit([&rhs](auto data)
+		{
+			using T = std::remove_const_t<typename decltype(data)::element_type>;
+			return RangeEquals<T>(data.data(), static_cast<const T*>(rhs.mData.VoidPtr), static_cast<std::size_t>(data.size()));
+		});
 	}
 
 	bool Datum::operator!=(const Datum& rhs) const noexcept
@@ -572,10 +616,28 @@ namespace Library
 
 		if (capacity > mCapacity)
 		{
-			void* newMemory = realloc(mData.VoidPtr, capacity * TypeSizeLUT[static_cast<std::size_t>(mType)]);
-			if (!newMemory) throw std::bad_alloc();
+			const std::size_t newSize = capacity * TypeSizeLUT[static_cast<std::size_t>(mType)];
+
+			if (newSize <= InlineCapacity && mType != Types::String && (mData.VoidPtr == nullptr || IsInlineStorage()))
+			{
+				mData.BytePtr = mInlineStorage;
+			}
+			else if (IsInlineStorage())
+			{
+				void* newMemory = malloc(newSize);
+				if (!newMemory) throw std::bad_alloc();
+
+				std::memcpy(newMemory, mInlineStorage, InlineCapacity);
+				mData.VoidPtr = newMemory;
+			}
+			else
+			{
+				void* newMemory = realloc(mData.VoidPtr, newSize);
+				if (!newMemory) throw std::bad_alloc();
+
+				mData.VoidPtr = newMemory;
+			}
 
-			mData.VoidPtr = newMemory;
 			mCapacity = capacity;
 		}
 	}
@@ -589,10 +651,11 @@ namespace Library
 		{
 			Reserve(size);
 
-			for (std::size_t i = mSize; i < size; ++i)
+			Visit([this, size](auto data)
 			{
-				CreateDefaultLUT[static_cast<std::size_t>(mType)](mData.VoidPtr, i);
-			}
+				using T = typename decltype(data)::element_type;
+				std::uninitialized_fill(data.data() + mSize, data.data() + size, DefaultValue<T>());
+			});
 		}
 		else if (mType == Types::String && size < mSize)
 		{
@@ -612,15 +675,26 @@ namespace Library
 
 		if (mSize == 0)
 		{
-			free(mData.VoidPtr);
+			FreeStorage();
 			mData.VoidPtr = nullptr;
 		}
-		else if (mSize < mCapacity)
+		else if (mSize < mCapacity && !IsInlineStorage())
 		{
-			void* newMemory = realloc(mData.VoidPtr, mSize * TypeSizeLUT[static_cast<std::size_t>(mType)]);
-			if (!newMemory) throw std::bad_alloc();
+			const std::size_t newSize = mSize * TypeSizeLUT[static_cast<std::size_t>(mType)];
 
-			mData.VoidPtr = newMemory;
+			if (newSize <= InlineCapacity && mType != Types::String)
+			{
+				std::memcpy(mInlineStorage, mData.VoidPtr, newSize);
+				free(mData.VoidPtr);
+				mData.BytePtr = mInlineStorage;
+			}
+			else
+			{
+				void* newMemory = realloc(mData.VoidPtr, newSize);
+				if (!newMemory) throw std::bad_alloc();
+
+				mData.VoidPtr = newMemory;
+			}
 		}
 
 		mCapacity = mSize;
@@ -670,7 +744,7 @@ namespace Library
 		}
 
 		const std::size_t size = TypeSizeLUT[static_cast<std::size_t>(mType)];
-		std::memmove(&mData.BytePtr[index * size], &mData.BytePtr[(index * size) + size], size * (mSize - index));
+		std::memmove(&mData.BytePtr[index * size], &mData.BytePtr[(index * size) + size], size * (mSize - index - 1));
 
 		--mSize;
 	}
@@ -765,5 +839,31 @@ namespace Library
 
 		return *this;
 	}
+
+	std::size_t Datum::IndexOfHelper(const void* value) const
+	{
+		return Visit([value](auto data)
+		{
+			using T = std::remove_const_t<typename decltype(data)::element_type>;
+			const T& typedValue = *static_cast<const T*>(value);
+
+			std::size_t i = 0;
+			for (const auto& element : data)
+			{
+				if (ElementEquals(element, typedValue)) break;
+				++i;
+			}
+
+			return i;
+		});
+	}
+
+	void Datum::FreeStorage()
+	{
+		if (mInternalStorage && mData.VoidPtr != nullptr && !IsInlineStorage())
+		{
+			free(mData.VoidPtr);
+		}
+	}
 #pragma endregion Helper Methods
 }
@@ -3,6 +3,7 @@
 #pragma region Includes
 // Standard
 #include <string>
+#include <tuple>
 
 // Third Party
 #include <gsl/span>
@@ -41,9 +42,23 @@ namespace Library
 		using DatumPointer = Datum*;
 
 		/// <summary>
-		/// Reserve strategy functor type used during resize on insertion.
+		/// Strategy for incrementing the capacity during insertion at full capacity.
+		/// Default grows the capacity by half, Double doubles it, and Increment adds a single element.
 		/// </summary>
-		using ReserveFunctor = std::function<std::size_t(const std::size_t, const std::size_t)>;
+		enum class ReserveStrategy : std::uint8_t
+		{
+			Default,
+			Double,
+			Increment,
+
+			End
+		};
+
+		/// <summary>
+		/// Size in bytes of the buffer inside the Datum that holds small payloads without a heap allocation.
+		/// Fits a glm::vec4, four ints or floats, or two pointers. Strings and matrices always use the heap.
+		/// </summary>
+		static constexpr std::size_t InlineCapacity = 16;
 
 		/// <summary>
 		/// Represents one of the valid types that datum can contain.
@@ -64,6 +79,17 @@ namespace Library
 			End
 		};
 
+		/// <summary>
+		/// Compile-time list of the types a Datum can contain, in the order of Types.
+		/// </summary>
+		using TypeList = std::tuple<int, float, glm::vec4, glm::mat4, std::string, ScopePointer, RTTIPointer, DatumPointer>;
+
+		/// <summary>
+		/// Type in the TypeList associated with a Types value.
+		/// </summary>
+		template<Types Type>
+		using TypeAt = std::tuple_element_t<static_cast<std::size_t>(Type), TypeList>;
+
 	private:
 		/// <summary>
 		/// Wrapper for a pointer to data of any type that datum can contain.
@@ -95,54 +121,19 @@ namespace Library
 			sizeof(RTTIPointer), sizeof(DatumPointer)
 		};
 
-		/// <summary>
-		/// Datum equality function look-up table.
-		/// </summary>
-		using EqualityFunctor = std::function<bool(void*, void*, const std::size_t)>;
-		static const EqualityFunctor EqualityLUT[static_cast<std::size_t>(Types::End)];
-		
-		/// <summary>
-		/// Datum single value equality look-up table.
-		/// </summary>
-		using ElementEqualityFunctor = std::function<bool(void*, void*)>;
-		static const ElementEqualityFunctor ElementEqualityLUT[static_cast<std::size_t>(Types::End)];
-
-		/// <summary>
-		/// Create default value function look-up table.
-		/// </summary>
-		using CreateDefaultFunctor = std::function<void(void*, const std::size_t)>;
-		static const CreateDefaultFunctor CreateDefaultLUT[static_cast<std::size_t>(Types::End)];
-
 		/// <summary>
 		/// ToString function look-up table.
 		/// </summary>
-		using ToStringFunctor = std::function<std::string(void*, const std::size_t)>;
-		static const ToStringFunctor ToStringLUT[static_cast<std::size_t>(Types::End)];
+		using ToStringFunction = std::string(*)(const void*, const std::size_t);
+		static const ToStringFunction ToStringLUT[static_cast<std::size_t>(Types::End)];
 
 		/// <summary>
 		/// FromString function look-up table.
 		/// </summary>
-		using FromStringFunctor = std::function<void(const std::string&, void*, const std::size_t)>;
-		static const FromStringFunctor FromStringLUT[static_cast<std::size_t>(Types::End)];
+		using FromStringFunction = void(*)(const std::string&, void*, const std::size_t);
+		static const FromStringFunction FromStringLUT[static_cast<std::size_t>(Types::End)];
 #pragma endregion Type Definitions, Constants
 
-#pragma region Default Functors
-	public:
-		/// <summary>
-		/// Functor specifying the default strategy for incrementing the capacity of the Datum.
-		/// </summary>
-		struct DefaultReserveFunctor final
-		{
-			/// <summary>
-			/// Function call operator.
-			/// </summary>
-			/// <param name="size">Datum size.</param>
-			/// <param name="capacity">Datum capacity.</param>
-			/// <returns>New capacity.</returns>
-			constexpr std::size_t operator()(const std::size_t size, const std::size_t capacity) const;
-		};
-#pragma endregion Default Functors
-	
 #pragma region TypeOf
 	public:
 		/// <summary>
@@ -874,8 +865,8 @@ namespace Library
 		/// <summary>
 		/// Sets the reserve strategy for incrementing the capacity during a PushBack call at full capacity.
 		/// </summary>
-		/// <param name="reserveFunctor">New reserve strategy functor.</param>
-		void SetReserveStrategy(const ReserveFunctor& reserveFunctor);
+		/// <param name="reserveStrategy">New reserve strategy.</param>
+		void SetReserveStrategy(const ReserveStrategy reserveStrategy);
 #pragma endregion Modifiers
 
 #pragma region String Conversion
@@ -898,6 +889,30 @@ namespace Library
 		void SetFromString(const std::string& str, const std::size_t index=0);
 #pragma endregion String Conversion
 
+#pragma region Visit
+	public:
+		/// <summary>
+		/// Calls the visitor once with a span over all elements, typed by the Datum type.
+		/// Bulk operations then run as a loop over the concrete type instead of an indirect call per element.
+		/// </summary>
+		/// <typeparam name="Visitor">Callable accepting a gsl::span of any type in the TypeList, returning the same type for each.</typeparam>
+		/// <param name="visitor">Visitor to call with the elements.</param>
+		/// <returns>Result of the visitor.</returns>
+		/// <exception cref="std::runtime_error">Data type unknown.</exception>
+		template<typename Visitor>
+		decltype(auto) Visit(Visitor&& visitor);
+
+		/// <summary>
+		/// Calls the visitor once with a const span over all elements, typed by the Datum type.
+		/// </summary>
+		/// <typeparam name="Visitor">Callable accepting a const gsl::span of any type in the TypeList, returning the same type for each.</typeparam>
+		/// <param name="visitor">Visitor to call with the elements.</param>
+		/// <returns>Result of the visitor.</returns>
+		/// <exception cref="std::runtime_error">Data type unknown.</exception>
+		template<typename Visitor>
+		decltype(auto) Visit(Visitor&& visitor) const;
+#pragma endregion Visit
+
 #pragma region Helper Methods
 	private:
 		/// <summary>
@@ -915,6 +930,100 @@ namespace Library
 		/// <param name="rhs">List of values to fill the Datum.</param>
 		template<typename T>
 		Datum& ListInitializationHelper(const std::initializer_list<T> rhs);
+
+		/// <summary>
+		/// Checks if the data of the Datum is held in its inline buffer.
+		/// </summary>
+		/// <returns>True if the data is in the inline buffer, otherwise false.</returns>
+		bool IsInlineStorage() const;
+
+		/// <summary>
+		/// Calls the visitor with a span over all elements, as the type in the TypeList for the given Types value.
+		/// </summary>
+		/// <typeparam name="Type">Types value of the Datum.</typeparam>
+		/// <param name="visitor">Visitor to call with the elements.</param>
+		/// <returns>Result of the visitor.</returns>
+		template<Types Type, typename Visitor>
+		decltype(auto) VisitAs(Visitor&& visitor);
+
+		/// <summary>
+		/// Calls the visitor with a const span over all elements, as the type in the TypeList for the given Types value.
+		/// </summary>
+		/// <typeparam name="Type">Types value of the Datum.</typeparam>
+		/// <param name="visitor">Visitor to call with the elements.</param>
+		/// <returns>Result of the visitor.</returns>
+		template<Types Type, typename Visitor>
+		decltype(auto) VisitAs(Visitor&& visitor) const;
+
+		/// <summary>
+		/// Finds the index of the first element equal to the value, which must be of the Datum type.
+		/// </summary>
+		/// <param name="value">Pointer to the value to search for.</param>
+		/// <returns>Index of the value, or the size of the Datum if not found.</returns>
+		std::size_t IndexOfHelper(const void* value) const;
+
+		/// <summary>
+		/// Compares a range of elements of one type.
+		/// Trivially copyable types compare with memcmp, the pointer types compare as the Datum equality operator specifies.
+		/// </summary>
+		/// <typeparam name="T">Type of the elements.</typeparam>
+		/// <param name="lhs">Pointer to the first element of the left hand side range.</param>
+		/// <param name="rhs">Pointer to the first element of the right hand side range.</param>
+		/// <param name="size">Number of elements to compare.</param>
+		/// <returns>True if all elements are equal, otherwise false.</returns>
+		template<typename T>
+		static bool RangeEquals(const T* lhs, const T* rhs, const std::size_t size);
+
+		/// <summary>
+		/// Compares two elements of one type, following pointers to compare the referenced values.
+		/// </summary>
+		/// <typeparam name="T">Type of the elements.</typeparam>
+		/// <param name="lhs">Left hand side element.</param>
+		/// <param name="rhs">Right hand side element.</param>
+		/// <returns>True if the elements are equal, otherwise false.</returns>
+		template<typename T>
+		static bool ElementEquals(const T& lhs, const T& rhs);
+
+		/// <summary>
+		/// Gets the value used for new elements on Resize.
+		/// </summary>
+		/// <typeparam name="T">Type of the element.</typeparam>
+		/// <returns>Default value of the type.</returns>
+		template<typename T>
+		static T DefaultValue();
+
+		/// <summary>
+		/// Converts an element to a string. Used to build the ToString look-up table.
+		/// </summary>
+		/// <typeparam name="T">Type of the element.</typeparam>
+		/// <param name="data">Pointer to the elements.</param>
+		/// <param name="index">Index of the element.</param>
+		/// <returns>String representation of the element.</returns>
+		template<typename T>
+		static std::string ElementToString(const void* data, const std::size_t index);
+
+		/// <summary>
+		/// Sets an element from a string. Used to build the FromString look-up table.
+		/// </summary>
+		/// <typeparam name="T">Type of the element.</typeparam>
+		/// <param name="str">String representation of the value.</param>
+		/// <param name="data">Pointer to the elements.</param>
+		/// <param name="index">Index of the element.</param>
+		template<typename T>
+		static void ElementFromString(const std::string& str, void* data, const std::size_t index);
+
+		/// <summary>
+		/// Frees internal data held on the heap. Inline and external data are left untouched.
+		/// </summary>
+		void FreeStorage();
+
+		/// <summary>
+		/// Computes the capacity to reserve when inserting at full capacity.
+		/// </summary>
+		/// <param name="reserveStrategy">Strategy for incrementing the capacity.</param>
+		/// <param name="capacity">Current capacity.</param>
+		/// <returns>New capacity, always greater than the current capacity.</returns>
+		static constexpr std::size_t NextCapacity(const ReserveStrategy reserveStrategy, const std::size_t capacity);
 #pragma endregion Helper Methods
 
 #pragma region Data Members
@@ -924,11 +1033,6 @@ namespace Library
 		/// </summary>
 		Values mData{ nullptr };
 
-		/// <summary>
-		/// Enum specifying the type of the data in the Datum.
-		/// </summary>
-		Types mType{ Types::Unknown };
-
 		/// <summary>
 		/// Number of elements in the Datum.
 		/// </summary>
@@ -939,15 +1043,25 @@ namespace Library
 		/// </summary>
 		std::size_t mCapacity{ 0 };
 
+		/// <summary>
+		/// Enum specifying the type of the data in the Datum.
+		/// </summary>
+		Types mType{ Types::Unknown };
+
 		/// <summary>
 		/// Represents whether the Datum owns the data or if it is owned externally.
 		/// </summary>
 		bool mInternalStorage{ true };
 
 		/// <summary>
-		/// Reserve strategy functor denoting how to increment capacity during insertion.
+		/// Strategy for incrementing the capacity during insertion.
+		/// </summary>
+		ReserveStrategy mReserveStrategy{ ReserveStrategy::Default };
+
+		/// <summary>
+		/// Buffer holding the data when the internal capacity fits in InlineCapacity bytes.
 		/// </summary>
-		std::shared_ptr<ReserveFunctor> mReserveFunctor{ std::make_shared<ReserveFunctor>(DefaultReserveFunctor()) };
+		alignas(std::max_align_t) std::byte mInlineStorage[InlineCapacity];
 #pragma endregion Data Members
 	};
 }
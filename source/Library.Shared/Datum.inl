@@ -5,13 +5,6 @@
 
 namespace Library
 {
-#pragma region Default Functors
-	inline constexpr std::size_t Datum::DefaultReserveFunctor::operator()(const std::size_t, const std::size_t capacity) const
-	{
-		return static_cast<std::size_t>(capacity * 1.5);
-	}
-#pragma endregion Default Functors
-
 #pragma region TypeOf
 	template<typename T>
 	inline constexpr Datum::Types Datum::TypeOf()
@@ -212,19 +205,7 @@ namespace Library
 		if (mType == Types::Unknown)	throw std::runtime_error("Type not set.");
 		if (mType != TypeOf<T>())		throw std::runtime_error("Mismatched type.");
 
-		T* const data = static_cast<T*>(mData.VoidPtr);
-		T valueCopy = value;
-
-		std::size_t i = 0;
-		for (; i < mSize; ++i)
-		{
-			if (ElementEqualityLUT[static_cast<std::size_t>(mType)](&data[i], &valueCopy))
-			{
-				break;
-			}
-		}
-
-		return i;
+		return IndexOfHelper(&value);
 	}
 #pragma endregion Element Accessors
 
@@ -287,8 +268,7 @@ namespace Library
 
 		if (mCapacity <= mSize)
 		{
-			const std::size_t newCapacity = mReserveFunctor->operator()(mCapacity, mSize);
-			Reserve(std::max(newCapacity, mCapacity + 1));
+			Reserve(NextCapacity(mReserveStrategy, mCapacity));
 		}
 
 		return *new(static_cast<T*>(mData.VoidPtr) + mSize++)T(std::forward<Args>(args)...);
@@ -323,7 +303,7 @@ namespace Library
 				mData.StringPtr[index].~basic_string();
 			}
 
-			std::memmove(&data[index], &data[index + 1], sizeof(T) * (mSize - index));
+			std::memmove(&data[index], &data[index + 1], sizeof(T) * (mSize - index - 1));
 
 			--mSize;
 			return true;
@@ -332,9 +312,81 @@ namespace Library
 		return false;
 	}
 
-	inline void Datum::SetReserveStrategy(const ReserveFunctor& reserveFunctor)
+	inline void Datum::SetReserveStrategy(const ReserveStrategy reserveStrategy)
 	{
-		mReserveFunctor = std::make_shared<ReserveFunctor>(reserveFunctor);
+		assert(reserveStrategy < ReserveStrategy::End);
+		mReserveStrategy = reserveStrategy;
 	}
 #pragma endregion Modifiers
+
+#pragma region Visit
+	template<typename Visitor>
+	inline decltype(auto) Datum::Visit(Visitor&& visitor)
+	{
+		switch (mType)
+		{
+		case Types::Integer:	return VisitAs<Types::Integer>(visitor);
+		case Types::Float:		return VisitAs<Types::Float>(visitor);
+		case Types::Vector:		return VisitAs<Types::Vector>(visitor);
+		case Types::Matrix:		return VisitAs<Types::Matrix>(visitor);
+		case Types::String:		return VisitAs<Types::String>(visitor);
+		case Types::Scope:		return VisitAs<Types::Scope>(visitor);
+		case Types::Pointer:	return VisitAs<Types::Pointer>(visitor);
+		case Types::Reference:	return VisitAs<Types::Reference>(visitor);
+		default:				throw std::runtime_error("Data type unknown.");
+		}
+	}
+
+	template<typename Visitor>
+	inline decltype(auto) Datum::Visit(Visitor&& visitor) const
+	{
+		switch (mType)
+		{
+		case Types::Integer:	return VisitAs<Types::Integer>(visitor);
+		case Types::Float:		return VisitAs<Types::Float>(visitor);
+		case Types::Vector:		return VisitAs<Types::Vector>(visitor);
+		case Types::Matrix:		return VisitAs<Types::Matrix>(visitor);
+		case Types::String:		return VisitAs<Types::String>(visitor);
+		case Types::Scope:		return VisitAs<Types::Scope>(visitor);
+		case Types::Pointer:	return VisitAs<Types::Pointer>(visitor);
+		case Types::Reference:	return VisitAs<Types::Reference>(visitor);
+		default:				throw std::runtime_error("Data type unknown.");
+		}
+	}
+#pragma endregion Visit
+
+#pragma region Helper Methods
+	inline bool Datum::IsInlineStorage() const
+	{
+		return mData.BytePtr == mInlineStorage;
+	}
+
+	inline constexpr std::size_t Datum::NextCapacity(const ReserveStrategy reserveStrategy, const std::size_t capacity)
+	{
+		std::size_t newCapacity = capacity + 1;
+
+		switch (reserveStrategy)
+		{
+		case ReserveStrategy::Default:	newCapacity = static_cast<std::size_t>(capacity * 1.5);	break;
+		case ReserveStrategy::Double:	newCapacity = capacity * 2;								break;
+		default:																				break;
+		}
+
+		return std::max(newCapacity, capacity + 1);
+	}
+
+	template<Datum::Types Type, typename Visitor>
+	inline decltype(auto) Datum::VisitAs(Visitor&& visitor)
+	{
+		using T = TypeAt<Type>;
+		return visitor(gsl::span<T>(static_cast<T*>(mData.VoidPtr), mSize));
+	}
+
+	template<Datum::Types Type, typename Visitor>
+	inline decltype(auto) Datum::VisitAs(Visitor&& visitor) const
+	{
+		using T = TypeAt<Type>;
+		return visitor(gsl::span<const T>(static_cast<const T*>(mData.VoidPtr), mSize));
+	}
+#pragma endregion Helper Methods
 }
\ No newline at end of file
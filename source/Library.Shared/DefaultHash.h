@@ -1,19 +1,73 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 #include <string>
+#include <type_traits>
 
 namespace Library::Hash
 {
 #pragma region Hash Functions
 	/// <summary>
-	/// Simple additive hash function.
+	/// Multiplies two 64-bit values into a 128-bit product.
 	/// </summary>
-	std::size_t AdditiveHash(const std::uint8_t* data, const std::size_t byteCount, const std::size_t hashPrime=31);
+	/// <param name="lhs">First multiplicand, written with the low 64 bits of the product.</param>
+	/// <param name="rhs">Second multiplicand, written with the high 64 bits of the product.</param>
+	constexpr void Multiply128(std::uint64_t& lhs, std::uint64_t& rhs);
+
+	/// <summary>
+	/// Multiplies two 64-bit values into a 128-bit product and folds the high and low halves together.
+	/// Core mixing step of ByteHash and IntegerHash.
+	/// </summary>
+	/// <param name="lhs">First multiplicand.</param>
+	/// <param name="rhs">Second multiplicand.</param>
+	/// <returns>Exclusive or of the high and low 64 bits of the product.</returns>
+	constexpr std::uint64_t MultiplyFold(const std::uint64_t lhs, const std::uint64_t rhs);
+
+	/// <summary>
+	/// Fast 64-bit hash function for byte ranges, in the style of wyhash.
+	/// Reads eight bytes per step, so short keys cost a handful of multiplies regardless of content.
+	/// Usable in constant expressions when given a character pointer.
+	/// </summary>
+	/// <param name="data">Pointer to the first byte to hash.</param>
+	/// <param name="byteCount">Number of bytes to hash.</param>
+	/// <param name="seed">Seed value, producing an independent hash function for each value.</param>
+	/// <returns>64-bit hash code for the given bytes.</returns>
+	/// <typeparam name="TByte">Byte type, either char or std::uint8_t.</typeparam>
+	template<typename TByte>
+	constexpr std::uint64_t ByteHash(const TByte* data, const std::size_t byteCount, std::uint64_t seed=0);
+
+	/// <summary>
+	/// Fast mixing function for integer and pointer keys.
+	/// A bijection, so distinct keys never collide before being reduced to a bucket index.
+	/// </summary>
+	/// <param name="key">Integer value to hash.</param>
+	/// <returns>64-bit hash code for the given value.</returns>
+	constexpr std::uint64_t IntegerHash(std::uint64_t key);
+
+	/// <summary>
+	/// Computes the hash code of a string literal at compile time.
+	/// Equal to the DefaultHash of a std::string with the same characters.
+	/// </summary>
+	/// <param name="literal">Null terminated string literal.</param>
+	/// <returns>Hash code for the string literal.</returns>
+	/// <typeparam name="Length">Length of the literal, including the null terminator.</typeparam>
+	template<std::size_t Length>
+	constexpr std::size_t StringHash(const char(&literal)[Length]);
+
+	/// <summary>
+	/// User defined literal for computing the hash code of a string at compile time.
+	/// Equal to the DefaultHash of a std::string with the same characters.
+	/// </summary>
+	/// <param name="literal">String literal.</param>
+	/// <param name="length">Length of the string literal, excluding the null terminator.</param>
+	/// <returns>Hash code for the string literal.</returns>
+	constexpr std::size_t operator""_hash(const char* literal, const std::size_t length);
 #pragma endregion Hash Functions
 
 	/// <summary>
 	/// Default hash functor for computing hash codes for various types.
+	/// Integral and enumeration types are mixed with IntegerHash, all other types hash their object representation.
 	/// </summary>
 	/// <param name="key">Key used to compute the hashcode.</param>
 	/// <returns>Hash code for the given key.</returns>
@@ -23,6 +77,41 @@ namespace Library::Hash
 		std::size_t operator()(const T& key) const;
 	};
 
+	/// <summary>
+	/// Default hash functor for reference keys. Hashes the referenced value, rather than its object representation.
+	/// </summary>
+	/// <param name="key">Key used to compute the hashcode.</param>
+	/// <returns>Hash code for the given key.</returns>
+	template<typename T>
+	struct DefaultHash<T&> final
+	{
+		std::size_t operator()(const T& key) const;
+	};
+
+#pragma region Pointer Specializations
+	/// <summary>
+	/// Default hash functor for computing hash codes for pointer values, from the address alone.
+	/// </summary>
+	/// <param name="key">Key used to compute the hashcode.</param>
+	/// <returns>Hash code for the given key.</returns>
+	template<typename T>
+	struct DefaultHash<T*> final
+	{
+		std::size_t operator()(const T* const key) const;
+	};
+
+	/// <summary>
+	/// Default hash functor for computing hash codes for constant pointer values, from the address alone.
+	/// </summary>
+	/// <param name="key">Key used to compute the hashcode.</param>
+	/// <returns>Hash code for the given key.</returns>
+	template<typename T>
+	struct DefaultHash<T* const> final
+	{
+		std::size_t operator()(const T* const key) const;
+	};
+#pragma endregion Pointer Specializations
+
 #pragma region Integer Specializations
 	/// <summary>
 	/// Default hash functor for computing hash codes for int values.
@@ -6,35 +6,191 @@
 namespace Library::Hash
 {
 #pragma region Hash Functions
-	inline std::size_t AdditiveHash(const std::uint8_t* data, const std::size_t byteCount, const std::size_t hashPrime)
+	inline constexpr void Multiply128(std::uint64_t& lhs, std::uint64_t& rhs)
 	{
-		std::size_t hashValue = 0;
+#if defined(__SIZEOF_INT128__)
+		const unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs;
+		lhs = static_cast<std::uint64_t>(product);
+		rhs = static_cast<std::uint64_t>(product >> 64);
+#else
+		const std::uint64_t lhsHigh = lhs >> 32;
+		const std::uint64_t lhsLow = lhs & 0xFFFFFFFFull;
+		const std::uint64_t rhsHigh = rhs >> 32;
+		const std::uint64_t rhsLow = rhs & 0xFFFFFFFFull;
 
-		for (std::size_t i = 0; i < byteCount; ++i)
+		const std::uint64_t lowLow = lhsLow * rhsLow;
+		const std::uint64_t highLow = lhsHigh * rhsLow;
+		const std::uint64_t lowHigh = lhsLow * rhsHigh;
+		const std::uint64_t highHigh = lhsHigh * rhsHigh;
+
+		const std::uint64_t cross = (lowLow >> 32) + (highLow & 0xFFFFFFFFull) + lowHigh;
+
+		lhs = (cross << 32) | (lowLow & 0xFFFFFFFFull);
+		rhs = highHigh + (highLow >> 32) + (cross >> 32);
+#endif
+	}
+
+	inline constexpr std::uint64_t MultiplyFold(std::uint64_t lhs, std::uint64_t rhs)
+	{
+		Multiply128(lhs, rhs);
+		return lhs ^ rhs;
+	}
+
+	template<typename TByte>
+	inline constexpr std::uint64_t ByteHash(const TByte* data, const std::size_t byteCount, std::uint64_t seed)
+	{
+		static_assert(sizeof(TByte) == 1, "ByteHash requires a byte sized element type.");
+
+		constexpr std::uint64_t secret0 = 0xA0761D6478BD642Full;
+		constexpr std::uint64_t secret1 = 0xE7037ED1A0B428DBull;
+		constexpr std::uint64_t secret2 = 0x8EBC6AF09C88C6E3ull;
+		constexpr std::uint64_t secret3 = 0x589965CC75374CC3ull;
+
+		// Little endian read of up to eight bytes. Character data is assembled a byte at a time so that
+		// string literals may be hashed in constant expressions, other data is copied directly.
+		const auto read = [data](const std::size_t offset, const std::size_t count)
 		{
-			hashValue += hashPrime * data[i];
+			std::uint64_t value = 0;
+
+			if constexpr (std::is_same_v<std::remove_cv_t<TByte>, char>)
+			{
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					value |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(data[offset + i])) << (8 * i);
+				}
+			}
+			else
+			{
+				std::memcpy(&value, data + offset, count);
+			}
+
+			return value;
+		};
+
+		seed ^= MultiplyFold(seed ^ secret0, secret1);
+
+		std::uint64_t a = 0;
+		std::uint64_t b = 0;
+
+		if (byteCount <= 16)
+		{
+			if (byteCount >= 4)
+			{
+				const std::size_t quarter = (byteCount >> 3) << 2;
+				a = (read(0, 4) << 32) | read(quarter, 4);
+				b = (read(byteCount - 4, 4) << 32) | read(byteCount - 4 - quarter, 4);
+			}
+			else if (byteCount > 0)
+			{
+				a = (read(0, 1) << 16) | (read(byteCount >> 1, 1) << 8) | read(byteCount - 1, 1);
+			}
+		}
+		else
+		{
+			std::size_t offset = 0;
+			std::size_t remaining = byteCount;
+
+			if (remaining > 48)
+			{
+				std::uint64_t seed1 = seed;
+				std::uint64_t seed2 = seed;
+
+				do
+				{
+					seed = MultiplyFold(read(offset, 8) ^ secret1, read(offset + 8, 8) ^ seed);
+					seed1 = MultiplyFold(read(offset + 16, 8) ^ secret2, read(offset + 24, 8) ^ seed1);
+					seed2 = MultiplyFold(read(offset + 32, 8) ^ secret3, read(offset + 40, 8) ^ seed2);
+					offset += 48;
+					remaining -= 48;
+				} while (remaining > 48);
+
+				seed ^= seed1 ^ seed2;
+			}
+
+			while (remaining > 16)
+			{
+				seed = MultiplyFold(read(offset, 8) ^ secret1, read(offset + 8, 8) ^ seed);
+				offset += 16;
+				remaining -= 16;
+			}
+
+			a = read(offset + remaining - 16, 8);
+			b = read(offset + remaining - 8, 8);
 		}
 
-		return hashValue;
+		a ^= secret1;
+		b ^= seed;
+		Multiply128(a, b);
+
+		return MultiplyFold(a ^ secret0 ^ byteCount, b ^ secret1);
+	}
+
+	inline constexpr std::uint64_t IntegerHash(std::uint64_t key)
+	{
+		key ^= key >> 33;
+		key *= 0xFF51AFD7ED558CCDull;
+		key ^= key >> 33;
+		key *= 0xC4CEB9FE1A85EC53ull;
+		key ^= key >> 33;
+
+		return key;
+	}
+
+	template<std::size_t Length>
+	inline constexpr std::size_t StringHash(const char(&literal)[Length])
+	{
+		return static_cast<std::size_t>(ByteHash(literal, Length - 1));
+	}
+
+	inline constexpr std::size_t operator""_hash(const char* literal, const std::size_t length)
+	{
+		return static_cast<std::size_t>(ByteHash(literal, length));
 	}
 #pragma endregion Hash Functions
 
 	template<typename T>
 	inline std::size_t DefaultHash<T>::operator()(const T& key) const
 	{
-		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(&key);
-		return AdditiveHash(data, sizeof(T));
+		if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+		{
+			return static_cast<std::size_t>(IntegerHash(static_cast<std::uint64_t>(key)));
+		}
+		else
+		{
+			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(&key);
+			return static_cast<std::size_t>(ByteHash(data, sizeof(T)));
+		}
+	}
+
+	template<typename T>
+	inline std::size_t DefaultHash<T&>::operator()(const T& key) const
+	{
+		return DefaultHash<std::remove_cv_t<T>>()(key);
+	}
+
+#pragma region Pointer Specializations
+	template<typename T>
+	inline std::size_t DefaultHash<T*>::operator()(const T* const key) const
+	{
+		return static_cast<std::size_t>(IntegerHash(reinterpret_cast<std::uintptr_t>(key)));
+	}
+
+	template<typename T>
+	inline std::size_t DefaultHash<T* const>::operator()(const T* const key) const
+	{
+		return static_cast<std::size_t>(IntegerHash(reinterpret_cast<std::uintptr_t>(key)));
 	}
+#pragma endregion Pointer Specializations
 
 #pragma region Integer Specializations
 	inline std::size_t DefaultHash<int>::operator()(const int& key) const
 	{
-		return static_cast<std::size_t>(key);
+		return static_cast<std::size_t>(IntegerHash(static_cast<std::uint64_t>(key)));
 	}
 
 	inline std::size_t DefaultHash<const int>::operator()(const int& key) const
 	{
-		return static_cast<std::size_t>(key);
+		return static_cast<std::size_t>(IntegerHash(static_cast<std::uint64_t>(key)));
 	}
 #pragma endregion Integer Specializations
 
@@ -42,49 +198,49 @@ namespace Library::Hash
 	inline std::size_t DefaultHash<std::string>::operator()(const std::string& key) const
 	{
 		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key.c_str());
-		return AdditiveHash(data, key.length());
+		return static_cast<std::size_t>(ByteHash(data, key.length()));
 	}
 
 	inline std::size_t DefaultHash<const std::string>::operator()(const std::string& key) const
 	{
 		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key.c_str());
-		return AdditiveHash(data, key.length());
+		return static_cast<std::size_t>(ByteHash(data, key.length()));
 	}
 
 	inline std::size_t DefaultHash<std::wstring>::operator()(const std::wstring& key) const
 	{
 		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key.c_str());
-		return AdditiveHash(data, key.length() * sizeof(wchar_t));
+		return static_cast<std::size_t>(ByteHash(data, key.length() * sizeof(wchar_t)));
 	}
 
 	inline std::size_t DefaultHash<const std::wstring>::operator()(const std::wstring& key) const
 	{
 		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key.c_str());
-		return AdditiveHash(data, key.length() * sizeof(wchar_t));
+		return static_cast<std::size_t>(ByteHash(data, key.length() * sizeof(wchar_t)));
 	}
 
 	inline std::size_t DefaultHash<char*>::operator()(const char* const key) const
 	{
 		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key);
-		return AdditiveHash(data, strlen(key));
+		return static_cast<std::size_t>(ByteHash(data, strlen(key)));
 	}
 
 	inline std::size_t DefaultHash<const char*>::operator()(const char* const key) const
 	{
 		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key);
-		return AdditiveHash(data, strlen(key));
+		return static_cast<std::size_t>(ByteHash(data, strlen(key)));
 	}
 
 	inline std::size_t DefaultHash<char* const>::operator()(const char* const key) const
 	{
 		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key);
-		return AdditiveHash(data, strlen(key));
+		return static_cast<std::size_t>(ByteHash(data, strlen(key)));
 	}
 
 	inline std::size_t DefaultHash<const char* const>::operator()(const char* const key) const
 	{
 		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key);
-		return AdditiveHash(data, strlen(key));
+		return static_cast<std::size_t>(ByteHash(data, strlen(key)));
 	}
 #pragma endregion String Specializations
 }
\ No newline at end of file
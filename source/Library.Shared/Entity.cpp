@@ -5,6 +5,7 @@
 // Header
 #include "Entity.h"
 #include "WorldState.h"
+#include "JobSystem.h"
 #pragma endregion Includes
 
 namespace Library
@@ -25,7 +26,7 @@ namespace Library
 	}
 
 	Entity::Entity(const Entity& rhs) : Attributed(rhs),
-		mName(rhs.mName)
+		mName(rhs.mName), mIndependent(rhs.mIndependent)
 	{
 		rhs.ForEachChild([this](const Entity& rhsChild)
 		{
@@ -42,6 +43,7 @@ namespace Library
 		if (this == &rhs) return *this;
 
 		mName = rhs.mName;
+		mIndependent = rhs.mIndependent;
 		Attributed::operator=(rhs);
 
 		rhs.ForEachChild([this](const Entity& rhsChild)
@@ -58,8 +60,9 @@ namespace Library
 	}
 
 	Entity::Entity(Entity&& rhs) noexcept : Attributed(std::move(rhs)),
-		mName(std::move(rhs.mName)), mChildren(std::move(rhs.mChildren))
+		mName(std::move(rhs.mName)), mIndependent(rhs.mIndependent), mComponentHandle(rhs.mComponentHandle), mChildren(std::move(rhs.mChildren))
 	{
+		rhs.mComponentHandle = ComponentStore::Handle();
 	}
 
 	Entity& Entity::operator=(Entity&& rhs) noexcept
@@ -67,7 +70,11 @@ namespace Library
 		if (this == &rhs) return *this;
 
 		mName = std::move(rhs.mName);
+		mIndependent = rhs.mIndependent;
+		mComponentHandle = rhs.mComponentHandle;
 		mChildren = std::move(rhs.mChildren);
+
+		rhs.mComponentHandle = ComponentStore::Handle();
 		
 		Attributed::operator=(std::move(rhs));
 		
@@ -119,17 +126,53 @@ namespace Library
 		};
 	}
 
-	Entity& Entity::AddChild(Entity& child)
+	void Entity::ForEachChild(JobSystem& jobSystem, const std::function<void(Entity&)>& functor, const bool independentOnly)
 	{
-		if (mUpdatingChildren)
+		JobSystem::Counter counter;
+		std::exception_ptr exception;
+
+		mUpdatingChildren = true;
+
+		try
 		{
-			PendingChild pendingChild
+			for (auto* child : mChildren)
 			{
-				child,
-				PendingChild::State::ToAdd,
-			};
+				assert(child != nullptr);
+
+				if (!independentOnly || child->mIndependent)
+				{
+					jobSystem.Schedule([&functor, child] { functor(*child); }, counter);
+				}
+				else
+				{
+					functor(*child);
+				}
+			}
+		}
+		catch (...)
+		{
+			exception = std::current_exception();
+		}
 
-			mPendingChildren.EmplaceBack(pendingChild);
+		try
+		{
+			jobSystem.Wait(counter);
+		}
+		catch (...)
+		{
+			if (!exception) exception = std::current_exception();
+		}
+
+		mUpdatingChildren = false;
+
+		if (exception) std::rethrow_exception(exception);
+	}
+
+	Entity& Entity::AddChild(Entity& child)
+	{
+		if (mUpdatingChildren)
+		{
+			AddPendingChild(child, PendingChild::State::ToAdd);
 		}
 		else
 		{
@@ -144,13 +187,7 @@ namespace Library
 	{
 		if (mUpdatingChildren)
 		{
-			PendingChild pendingChild
-			{
-				child,
-				PendingChild::State::ToRemove,
-			};
-
-			mPendingChildren.EmplaceBack(pendingChild);
+			AddPendingChild(child, PendingChild::State::ToRemove);
 		}
 		else
 		{
@@ -172,13 +209,7 @@ namespace Library
 		
 		if (mUpdatingChildren)
 		{
-			PendingChild pendingChild
-			{
-				*child,
-				PendingChild::State::ToAdd,
-			};
-
-			mPendingChildren.EmplaceBack(pendingChild);
+			AddPendingChild(*child, PendingChild::State::ToAdd);
 		}
 		else
 		{
@@ -207,12 +238,24 @@ namespace Library
 	void Entity::Update(WorldState& worldState)
 	{
 		if (!mEnabled) return;
-				
-		ForEachChild([&worldState](Entity& entity)
+
+		if (worldState.JobSystem)
 		{
-			worldState.Entity = &entity;
-			worldState.Entity->Update(worldState);
-		});
+			ForEachChild(*worldState.JobSystem, [&worldState](Entity& entity)
+			{
+				WorldState entityState = worldState;
+				entityState.Entity = &entity;
+				entity.Update(entityState);
+			}, true);
+		}
+		else
+		{
+			ForEachChild([&worldState](Entity& entity)
+			{
+				worldState.Entity = &entity;
+				worldState.Entity->Update(worldState);
+			});
+		}
 		
 		worldState.Entity = nullptr;
 
@@ -243,6 +286,8 @@ namespace Library
 
 	void Entity::UpdatePendingChildren()
 	{
+		std::lock_guard<std::mutex> lock(mPendingChildrenMutex);
+
 		for (PendingChild& pendingChild : mPendingChildren)
 		{
 			switch (pendingChild.ChildState)
@@ -262,4 +307,16 @@ namespace Library
 		
 		mPendingChildren.Clear();
 	}
+
+	void Entity::AddPendingChild(Entity& child, const PendingChild::State state)
+	{
+		PendingChild pendingChild
+		{
+			child,
+			state,
+		};
+
+		std::lock_guard<std::mutex> lock(mPendingChildrenMutex);
+		mPendingChildren.EmplaceBack(pendingChild);
+	}
 }
\ No newline at end of file
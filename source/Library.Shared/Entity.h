@@ -3,17 +3,20 @@
 #pragma region Includes
 // Standard
 #include <optional>
+#include <mutex>
 
 // First Party
 #include "TypeManager.h"
 #include "Attributed.h"
 #include "Factory.h"
+#include "ComponentStore.h"
 #pragma endregion Includes
 
 namespace Library
 {
 	// Forward Declarations
 	struct WorldState;
+	class JobSystem;
 
 	/// <summary>
 	/// Represents a base object within the reflection system.
@@ -157,6 +160,32 @@ namespace Library
 		/// </summary>
 		/// <param name="enabled">Boolean determining whether to enable or disable the Entity.</param>
 		void SetEnabled(const bool enabled);
+
+		/// <summary>
+		/// Gets whether the Entity is independent of its siblings, and may be updated as a job in parallel with them.
+		/// </summary>
+		/// <returns>True when independent. Otherwise, false.</returns>
+		bool IsIndependent() const;
+
+		/// <summary>
+		/// Flags the Entity as independent of its siblings, so a parallel update may run it as a job.
+		/// An independent Entity must not touch its siblings, and may only change its parent through AddChild, CreateChild, and DestroyChild.
+		/// </summary>
+		/// <param name="independent">Boolean determining whether the Entity is independent.</param>
+		void SetIndependent(const bool independent);
+
+		/// <summary>
+		/// Gets the Handle to the components this Entity owns in the ComponentStore of its World.
+		/// Copies of an Entity start without a Handle, since components are not copied.
+		/// </summary>
+		/// <returns>Handle to the components of the Entity, invalid if it has none.</returns>
+		const ComponentStore::Handle& ComponentHandle() const;
+
+		/// <summary>
+		/// Sets the Handle to the components this Entity owns in the ComponentStore of its World.
+		/// </summary>
+		/// <param name="handle">Handle to the components of the Entity.</param>
+		void SetComponentHandle(const ComponentStore::Handle& handle);
 		
 		/// <summary>
 		/// Gets the number of child Entity objects.
@@ -180,6 +209,22 @@ namespace Library
 		template<typename T=Entity>
 		const T* FindChild(const std::string& name) const;
 
+		/// <summary>
+		/// Gets the child Entity with the given interned name.
+		/// </summary>
+		/// <param name="name">Interned name of the child Entity to be found.</param>
+		/// <returns>Reference to the child Entity with the given name.</returns>
+		template<typename T=Entity>
+		T* FindChild(const NameId& name);
+
+		/// <summary>
+		/// Gets the child Entity with the given interned name.
+		/// </summary>
+		/// <param name="name">Interned name of the child Entity to be found.</param>
+		/// <returns>Reference to the child Entity with the given name.</returns>
+		template<typename T=Entity>
+		const T* FindChild(const NameId& name) const;
+
 		/// <summary>
 		/// Gets the child Entity array with the given name.
 		/// </summary>
@@ -207,6 +252,16 @@ namespace Library
 		/// </summary>
 		/// <param name="functor">Function to be performed on each child Entity.</param>
 		void ForEachChild(const std::function<void(const Entity&)>& functor) const;
+
+		/// <summary>
+		/// Performs the given function on each child Entity, running it as a job of the JobSystem for the selected children.
+		/// Other children run on the calling thread. Returns once every job is done, with child additions and removals deferred.
+		/// </summary>
+		/// <param name="jobSystem">JobSystem that runs the jobs.</param>
+		/// <param name="functor">Function to be performed on each child Entity, from any thread.</param>
+		/// <param name="independentOnly">True to only run independent children as jobs, false to run every child as a job.</param>
+		/// <exception cref="std::exception">Rethrows the first exception thrown by the function.</exception>
+		void ForEachChild(JobSystem& jobSystem, const std::function<void(Entity&)>& functor, const bool independentOnly);
 #pragma endregion Accessors
 
 #pragma region Modifiers
@@ -267,6 +322,14 @@ namespace Library
 		/// Performs pending actions of the child Scopes.
 		/// </summary>
 		void UpdatePendingChildren();
+
+	private:
+		/// <summary>
+		/// Defers an action on a child until the next UpdatePendingChildren call. Safe to call from jobs.
+		/// </summary>
+		/// <param name="child">Child pending an action.</param>
+		/// <param name="state">Action to be performed.</param>
+		void AddPendingChild(Entity& child, const PendingChild::State state);
 #pragma endregion Helper Methods
 		
 #pragma region Data Members
@@ -280,17 +343,33 @@ namespace Library
 		/// Represents whether the Entity should be updated.
 		/// </summary>
 		bool mEnabled{ true };
+
+		/// <summary>
+		/// Represents whether the Entity may be updated in parallel with its siblings.
+		/// </summary>
+		bool mIndependent{ false };
+
+		/// <summary>
+		/// Handle to the components of the Entity in the ComponentStore of its World.
+		/// </summary>
+		ComponentStore::Handle mComponentHandle;
 		
 		/// <summary>
 		/// Collection of Entity objects within the Children prescribed Attribute.
 		/// </summary>
-		Vector<Entity*> mChildren;
+		SmallVector<Entity*, 4> mChildren;
 
 	private:
 		/// <summary>
 		/// Pending children to have an action performed during the end of an Update call.
+		/// Held inline, so Entity instances cloned from a prototype do not allocate for it.
+		/// </summary>
+		SmallVector<PendingChild, 2> mPendingChildren;
+
+		/// <summary>
+		/// Mutex guarding the pending children, which jobs may add to concurrently. Not copied or moved.
 		/// </summary>
-		Vector<PendingChild> mPendingChildren{ Vector<PendingChild>::EqualityFunctor() };
+		std::mutex mPendingChildrenMutex;
 
 		/// <summary>
 		/// Flag representing whether the Entity is currently updating children.
@@ -35,6 +35,26 @@ namespace Library
 		mEnabled = enabled;
 	}
 
+	inline bool Entity::IsIndependent() const
+	{
+		return mIndependent;
+	}
+
+	inline void Entity::SetIndependent(const bool independent)
+	{
+		mIndependent = independent;
+	}
+
+	inline const ComponentStore::Handle& Entity::ComponentHandle() const
+	{
+		return mComponentHandle;
+	}
+
+	inline void Entity::SetComponentHandle(const ComponentStore::Handle& handle)
+	{
+		mComponentHandle = handle;
+	}
+
 	inline std::size_t Entity::ChildCount() const
 	{
 		return mChildren.Size();
@@ -61,6 +81,27 @@ namespace Library
 		return const_cast<Entity*>(this)->FindChild<T>(name);
 	}
 
+	template<typename T>
+	inline T* Entity::FindChild(const NameId& name)
+	{		
+		T* child = nullptr;
+
+		Data* childData = Find(name);
+
+		if (childData && childData->Type() == Types::Scope && childData->Size() > 0)
+		{
+			child = childData->Get<Scope*>()->As<T>();
+		}
+
+		return child;
+	}
+
+	template<typename T>
+	inline const T* Entity::FindChild(const NameId& name) const
+	{
+		return const_cast<Entity*>(this)->FindChild<T>(name);
+	}
+
 	template<typename T>
 	inline gsl::span<T*> Entity::FindChildArray(const std::string& name)
 	{
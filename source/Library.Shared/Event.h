@@ -3,13 +3,20 @@
 #pragma region Includes
 // First Party
 #include "EventPublisher.h"
+#include "FlatHashMap.h"
 #pragma endregion Includes
 
 namespace Library
 {
+	// Forward Declarations
+	template<typename MessageT>
+	class EventPool;
+
 	/// <summary>
 	/// Represents an Event type that can be subscribed to by IEventSubscriber subclasses
 	/// such that the subscriber will be notified if an Event instance is published.
+	/// Subscribers are held in an immutable snapshot, copied and swapped on every change,
+	/// so publishing only loads the current snapshot.
 	/// </summary>
 	/// <typeparam name="MessageT">Data type contained by the Event as a message for subscribers.</typeparam>
 	template<typename MessageT>
@@ -17,6 +24,8 @@ namespace Library
 	{
 		RTTI_DECLARATIONS(Event, EventPublisher)
 
+		friend class EventPool<MessageT>;
+
 #pragma region Static Members
 	public:
 		/// <summary>
@@ -39,37 +48,68 @@ namespace Library
 		/// Subscribes an IEventSubscriber instance to an Event type.
 		/// </summary>
 		/// <param name="eventSubscriber">IEventSubscriber instance to add to the SubscriberList.</param>
+		/// <exception cref="std::runtime_error">Subscriber already added.</exception>
+		/// <remarks>Takes effect for the next Publish; deliveries already in progress keep their snapshot.</remarks>
 		static void Subscribe(IEventSubscriber& eventSubscriber);
 
 		/// <summary>
 		/// Unsubscribes an IEventSubscriber instance to this Event type.
 		/// </summary>
 		/// <param name="eventSubscriber">IEventSubscriber instance to remove from the SubscriberList.</param>
-		/// <remarks>Does not reduce the Subscriber count until an Event of this type is published.</remarks>
+		/// <remarks>Takes effect for the next Publish; deliveries already in progress keep their snapshot.</remarks>
 		static void Unsubscribe(IEventSubscriber& eventSubscriber);
 
 		/// <summary>
 		/// Unsubscribes all IEventSubscriber instances in the SubscriberList of an Event type.
+		/// Keeps the capacity of the SubscriberList.
 		/// </summary>
-		/// <remarks>This should never be called during Publish.</remarks>
 		static void UnsubscribeAll();
 
 		/// <summary>
 		/// Resizes the capacity of the SubscriberList to the size.
 		/// </summary>
-		/// <remarks>This should never be called during Publish.</remarks>
 		static void SubscriberShrinkToFit();
 
+		/// <summary>
+		/// Checks if Event instances of this type are delivered in order, serially, on the publishing thread.
+		/// </summary>
+		/// <returns>True if delivery is ordered and serial, otherwise false.</returns>
+		static bool OrderedDelivery();
+
+		/// <summary>
+		/// Forces ordered, serial delivery of this Event type, even when an EventQueue publishes in parallel.
+		/// </summary>
+		/// <param name="isOrdered">True to force ordered, serial delivery, false to allow parallel delivery.</param>
+		static void SetOrderedDelivery(const bool isOrdered);
+
 	private:
 		/// <summary>
-		/// Static list of IEventSubscriber instances associated with an Event type.
+		/// Replaces the current snapshot of subscribers, releasing it entirely once it holds no memory.
+		/// Must be called with the mutex held.
+		/// </summary>
+		/// <param name="subscribers">New list of subscribers.</param>
+		static void SwapSubscribers(SubscriberList&& subscribers);
+
+		/// <summary>
+		/// Static snapshot of IEventSubscriber instances associated with an Event type.
+		/// Read with an atomic load by Publish, and replaced with an atomic store under the mutex.
+		/// </summary>
+		inline static SubscriberSnapshot sSubscribers;
+
+		/// <summary>
+		/// Set of IEventSubscriber instances in the current snapshot, used to reject duplicate subscriptions.
 		/// </summary>
-		inline static SubscriberList sSubscriberList;
+		inline static FlatHashMap<IEventSubscriber*, bool> sSubscriberIndex;
 
 		/// <summary>
-		/// Mutex controlling thread access to the Event SubscriberList.
+		/// Mutex serializing changes to the subscribers of the Event type.
 		/// </summary>
 		inline static std::mutex sMutex;
+
+		/// <summary>
+		/// Represents whether Event instances of this type must be delivered in order, serially.
+		/// </summary>
+		inline static std::atomic<bool> sOrderedDelivery{ false };
 #pragma endregion Static Members
 
 #pragma region Special Members
@@ -88,7 +128,7 @@ namespace Library
 		/// Copy constructor.
 		/// </summary>
 		/// <param name="rhs">Event instance to be copied.</param>
-		Event(const Event& rhs) = default;
+		Event(const Event& rhs);
 
 		/// <summary>
 		/// Copy assignment operator.
@@ -102,7 +142,7 @@ namespace Library
 		/// </summary>
 		/// <param name="rhs">Event instance to be moved.</param>
 		/// <returns>Newly moved into Event instance.</returns>
-		Event(Event&& rhs) noexcept = default;
+		Event(Event&& rhs) noexcept;
 
 		/// <summary>
 		/// Move assignment operator.
@@ -134,11 +174,17 @@ namespace Library
 #pragma endregion RTTI Overrides
 
 #pragma region Data Members
+	private:
+		/// <summary>
+		/// Storage for the data contained by the Event, only rewritten by an EventPool recycling the Event.
+		/// </summary>
+		MessageT mMessage;
+
 	public:
 		/// <summary>
 		/// Data contained by the Event.
 		/// </summary>
-		const MessageT Message;
+		const MessageT& Message{ mMessage };
 #pragma endregion Data Members
 	};
 }
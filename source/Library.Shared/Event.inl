@@ -9,15 +9,15 @@ namespace Library
 	template<typename MessageT>
 	inline std::size_t Event<MessageT>::SubscriberCount()
 	{
-		std::scoped_lock<std::mutex> lock(sMutex);
-		return sSubscriberList.Size();
+		const SubscriberSnapshot subscribers = std::atomic_load(&sSubscribers);
+		return subscribers ? subscribers->Size() : 0;
 	}
 
 	template<typename MessageT>
 	inline std::size_t Event<MessageT>::SubscriberCapacity()
 	{
-		std::scoped_lock<std::mutex> lock(sMutex);
-		return sSubscriberList.Capacity();
+		const SubscriberSnapshot subscribers = std::atomic_load(&sSubscribers);
+		return subscribers ? subscribers->Capacity() : 0;
 	}
 
 	template<typename MessageT>
@@ -27,14 +27,14 @@ namespace Library
 
 		IEventSubscriber* subscriber = &eventSubscriber;
 
-		const auto entryIt = sSubscriberList.Find(subscriber);
-		
-		if (entryIt != sSubscriberList.end())
+		if (!sSubscriberIndex.Emplace(subscriber, true).second)
 		{
 			throw std::runtime_error("Subscriber already added.");
 		}
 
-		sSubscriberList.EmplaceBack(subscriber);
+		SubscriberList subscribers = sSubscribers ? *sSubscribers : SubscriberList();
+		subscribers.EmplaceBack(subscriber);
+		SwapSubscribers(std::move(subscribers));
 	}
 
 	template<typename MessageT>
@@ -42,44 +42,86 @@ namespace Library
 	{
 		std::scoped_lock<std::mutex> lock(sMutex);
 
-		const auto subscriber = sSubscriberList.Find(&eventSubscriber);
-	
-		if (subscriber != sSubscriberList.end())
-		{
-			sSubscriberList.Remove(subscriber);
-		}
+		if (!sSubscriberIndex.Remove(&eventSubscriber)) return;
+
+		SubscriberList subscribers = *sSubscribers;
+		subscribers.Remove(subscribers.Find(&eventSubscriber));
+		SwapSubscribers(std::move(subscribers));
 	}
 
 	template<typename MessageT>
 	inline void Event<MessageT>::UnsubscribeAll()
 	{
 		std::scoped_lock<std::mutex> lock(sMutex);
-		sSubscriberList.Clear();
+
+		sSubscriberIndex.Clear();
+
+		SubscriberList subscribers;
+		subscribers.Reserve(sSubscribers ? sSubscribers->Capacity() : 0);
+		SwapSubscribers(std::move(subscribers));
 	}
 
 	template<typename MessageT>
 	inline void Event<MessageT>::SubscriberShrinkToFit()
 	{
 		std::scoped_lock<std::mutex> lock(sMutex);
-		sSubscriberList.ShrinkToFit();
+
+		sSubscriberIndex.Rehash(FlatHashMap<IEventSubscriber*, bool>::DefaultBucketCount);
+
+		if (!sSubscribers) return;
+
+		SubscriberList subscribers = *sSubscribers;
+		subscribers.ShrinkToFit();
+		SwapSubscribers(std::move(subscribers));
+	}
+
+	template<typename MessageT>
+	inline bool Event<MessageT>::OrderedDelivery()
+	{
+		return sOrderedDelivery.load(std::memory_order_relaxed);
+	}
+
+	template<typename MessageT>
+	inline void Event<MessageT>::SetOrderedDelivery(const bool isOrdered)
+	{
+		sOrderedDelivery.store(isOrdered, std::memory_order_relaxed);
+	}
+
+	template<typename MessageT>
+	inline void Event<MessageT>::SwapSubscribers(SubscriberList&& subscribers)
+	{
+		SubscriberSnapshot snapshot = subscribers.Capacity() > 0 ? std::make_shared<const SubscriberList>(std::move(subscribers)) : nullptr;
+		std::atomic_store(&sSubscribers, std::move(snapshot));
 	}
 #pragma endregion Static Members
 
 #pragma region Special Members
 	template<typename MessageT>
-	inline Event<MessageT>::Event() : EventPublisher(sSubscriberList, sMutex)
+	inline Event<MessageT>::Event() : EventPublisher(sSubscribers, sOrderedDelivery)
+	{
+	}
+
+	template<typename MessageT>
+	inline Event<MessageT>::Event(const Event& rhs) : EventPublisher(rhs),
+		mMessage(rhs.mMessage)
+	{
+	}
+
+	template<typename MessageT>
+	inline Event<MessageT>::Event(Event&& rhs) noexcept : EventPublisher(std::move(rhs)),
+		mMessage(std::move(rhs.mMessage))
 	{
 	}
 
 	template<typename MessageT>
-	inline Event<MessageT>::Event(const MessageT& message) : EventPublisher(sSubscriberList, sMutex),
-		Message(message)
+	inline Event<MessageT>::Event(const MessageT& message) : EventPublisher(sSubscribers, sOrderedDelivery),
+		mMessage(message)
 	{
 	}
 	
 	template<typename MessageT>
-	inline Event<MessageT>::Event(MessageT&& message) : EventPublisher(sSubscriberList, sMutex),
-		Message(message)
+	inline Event<MessageT>::Event(MessageT&& message) : EventPublisher(sSubscribers, sOrderedDelivery),
+		mMessage(std::move(message))
 	{
 	}
 #pragma endregion Special Members
@@ -0,0 +1,198 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <mutex>
+
+// Third Party
+#include <gsl/span>
+
+// First Party
+#include "IEventChannel.h"
+#include "IEventChannelSubscriber.h"
+#include "Vector.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Typed channel for high-rate messages, delivered to subscribers in a single batch per frame.
+	/// Messages are stored by value in a contiguous buffer, so publishing does not allocate once the buffer has grown,
+	/// and each IEventChannelSubscriber is notified once per Flush with every message published since the last one.
+	/// Publish is safe to call from any number of threads. Flush swaps the buffers first,
+	/// so messages published while subscribers are notified are delivered by the next Flush.
+	/// Add the EventChannel to a World to have it flushed at the start of every World::Update.
+	/// </summary>
+	/// <typeparam name="MessageT">Message type carried by the EventChannel.</typeparam>
+	template<typename MessageT>
+	class EventChannel final : public IEventChannel
+	{
+#pragma region Type Definitions
+	public:
+		/// <summary>
+		/// Type definition for a subscriber to the EventChannel.
+		/// </summary>
+		using Subscriber = IEventChannelSubscriber<MessageT>;
+#pragma endregion Type Definitions
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Default constructor.
+		/// </summary>
+		EventChannel() = default;
+
+		/// <summary>
+		/// Default destructor.
+		/// </summary>
+		virtual ~EventChannel() override = default;
+
+		/// <summary>
+		/// Deleted copy constructor.
+		/// </summary>
+		EventChannel(const EventChannel&) = delete;
+
+		/// <summary>
+		/// Deleted copy assignment operator.
+		/// </summary>
+		EventChannel& operator=(const EventChannel&) = delete;
+
+		/// <summary>
+		/// Deleted move constructor.
+		/// </summary>
+		EventChannel(EventChannel&&) = delete;
+
+		/// <summary>
+		/// Deleted move assignment operator.
+		/// </summary>
+		EventChannel& operator=(EventChannel&&) = delete;
+#pragma endregion Special Members
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the number of messages published since the last Flush.
+		/// </summary>
+		/// <returns>Number of pending messages.</returns>
+		std::size_t Size() const;
+
+		/// <summary>
+		/// Checks if any messages were published since the last Flush.
+		/// </summary>
+		/// <returns>True if there are no pending messages, otherwise false.</returns>
+		bool IsEmpty() const;
+
+		/// <summary>
+		/// Gets the number of messages that can be published before the pending buffer allocates.
+		/// </summary>
+		/// <returns>Capacity of the pending buffer.</returns>
+		std::size_t Capacity() const;
+
+		/// <summary>
+		/// Gets the number of subscribers.
+		/// </summary>
+		/// <returns>Number of subscribers.</returns>
+		std::size_t SubscriberCount() const;
+#pragma endregion Accessors
+
+#pragma region Publishing
+	public:
+		/// <summary>
+		/// Adds a message to be delivered by the next Flush.
+		/// </summary>
+		/// <param name="message">Message to be copied.</param>
+		void Publish(const MessageT& message);
+
+		/// <summary>
+		/// Adds a message to be delivered by the next Flush.
+		/// </summary>
+		/// <param name="message">Message to be moved.</param>
+		void Publish(MessageT&& message);
+
+		/// <summary>
+		/// Adds a range of messages to be delivered by the next Flush, taking the lock only once.
+		/// </summary>
+		/// <param name="messages">Messages to be copied.</param>
+		void Publish(gsl::span<const MessageT> messages);
+
+		/// <summary>
+		/// Constructs a message in place, to be delivered by the next Flush.
+		/// </summary>
+		/// <param name="args">Arguments forwarded to the MessageT constructor.</param>
+		template<typename... Args>
+		void Emplace(Args&&... args);
+
+		/// <summary>
+		/// Notifies every subscriber once with every message published since the last Flush,
+		/// then clears the messages while keeping their memory for the next frame.
+		/// Does nothing if no messages were published.
+		/// </summary>
+		/// <remarks>Must not be called concurrently with itself. Exceptions thrown by subscribers propagate, discarding the batch.</remarks>
+		virtual void Flush() override;
+
+		/// <summary>
+		/// Discards every message published since the last Flush, keeping the capacity.
+		/// </summary>
+		virtual void Clear() override;
+
+		/// <summary>
+		/// Resizes the message buffers and SubscriberList to their sizes.
+		/// </summary>
+		void ShrinkToFit();
+#pragma endregion Publishing
+
+#pragma region Subscription
+	public:
+		/// <summary>
+		/// Subscribes an IEventChannelSubscriber to the EventChannel.
+		/// </summary>
+		/// <param name="subscriber">Subscriber to be added.</param>
+		/// <exception cref="std::runtime_error">Subscriber already added.</exception>
+		/// <remarks>Takes effect for the next Flush.</remarks>
+		void Subscribe(Subscriber& subscriber);
+
+		/// <summary>
+		/// Unsubscribes an IEventChannelSubscriber from the EventChannel.
+		/// </summary>
+		/// <param name="subscriber">Subscriber to be removed.</param>
+		/// <remarks>Takes effect for the next Flush.</remarks>
+		void Unsubscribe(Subscriber& subscriber);
+
+		/// <summary>
+		/// Unsubscribes every IEventChannelSubscriber, keeping the capacity of the SubscriberList.
+		/// </summary>
+		void UnsubscribeAll();
+#pragma endregion Subscription
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Messages published since the last Flush.
+		/// </summary>
+		Vector<MessageT> mPending{ typename Vector<MessageT>::EqualityFunctor() };
+
+		/// <summary>
+		/// Messages being delivered by Flush, swapped with the pending messages so both buffers keep their capacity.
+		/// </summary>
+		Vector<MessageT> mDelivering{ typename Vector<MessageT>::EqualityFunctor() };
+
+		/// <summary>
+		/// Subscribers notified by Flush.
+		/// </summary>
+		Vector<Subscriber*> mSubscribers;
+
+		/// <summary>
+		/// Copy of the subscribers taken by Flush, so subscribers may change while being notified.
+		/// </summary>
+		Vector<Subscriber*> mDeliveringSubscribers;
+
+		/// <summary>
+		/// Mutex guarding the pending messages and the subscribers.
+		/// </summary>
+		mutable std::mutex mMutex;
+#pragma endregion Data Members
+	};
+}
+
+// Inline File
+#include "EventChannel.inl"
\ No newline at end of file
@@ -0,0 +1,155 @@
+#pragma once
+
+// Header
+#include "EventChannel.h"
+
+namespace Library
+{
+#pragma region Accessors
+	template<typename MessageT>
+	inline std::size_t EventChannel<MessageT>::Size() const
+	{
+		std::scoped_lock<std::mutex> lock(mMutex);
+		return mPending.Size();
+	}
+
+	template<typename MessageT>
+	inline bool EventChannel<MessageT>::IsEmpty() const
+	{
+		return Size() == 0;
+	}
+
+	template<typename MessageT>
+	inline std::size_t EventChannel<MessageT>::Capacity() const
+	{
+		std::scoped_lock<std::mutex> lock(mMutex);
+		return mPending.Capacity();
+	}
+
+	template<typename MessageT>
+	inline std::size_t EventChannel<MessageT>::SubscriberCount() const
+	{
+		std::scoped_lock<std::mutex> lock(mMutex);
+		return mSubscribers.Size();
+	}
+#pragma endregion Accessors
+
+#pragma region Publishing
+	template<typename MessageT>
+	inline void EventChannel<MessageT>::Publish(const MessageT& message)
+	{
+		std::scoped_lock<std::mutex> lock(mMutex);
+		mPending.PushBack(message);
+	}
+
+	template<typename MessageT>
+	inline void EventChannel<MessageT>::Publish(MessageT&& message)
+	{
+		std::scoped_lock<std::mutex> lock(mMutex);
+		mPending.PushBack(std::move(message));
+	}
+
+	template<typename MessageT>
+	inline void EventChannel<MessageT>::Publish(gsl::span<const MessageT> messages)
+	{
+		std::scoped_lock<std::mutex> lock(mMutex);
+
+		for (const auto& message : messages)
+		{
+			mPending.PushBack(message);
+		}
+	}
+
+	template<typename MessageT>
+	template<typename... Args>
+	inline void EventChannel<MessageT>::Emplace(Args&&... args)
+	{
+		std::scoped_lock<std::mutex> lock(mMutex);
+		mPending.EmplaceBack(std::forward<Args>(args)...);
+	}
+
+	template<typename MessageT>
+	inline void EventChannel<MessageT>::Flush()
+	{
+		{
+			std::scoped_lock<std::mutex> lock(mMutex);
+			if (mPending.IsEmpty()) return;
+
+			std::swap(mPending, mDelivering);
+
+			mDeliveringSubscribers.Clear();
+			mDeliveringSubscribers.Reserve(mSubscribers.Size());
+
+			for (auto* subscriber : mSubscribers)
+			{
+				mDeliveringSubscribers.PushBack(subscriber);
+			}
+		}
+
+		const gsl::span<const MessageT> messages(&mDelivering.Front(), mDelivering.Size());
+
+		try
+		{
+			for (auto* subscriber : mDeliveringSubscribers)
+			{
+				assert(subscriber);
+				subscriber->Notify(messages);
+			}
+		}
+		catch (...)
+		{
+			mDelivering.Clear();
+			throw;
+		}
+
+		mDelivering.Clear();
+	}
+
+	template<typename MessageT>
+	inline void EventChannel<MessageT>::Clear()
+	{
+		std::scoped_lock<std::mutex> lock(mMutex);
+		mPending.Clear();
+	}
+
+	template<typename MessageT>
+	inline void EventChannel<MessageT>::ShrinkToFit()
+	{
+		std::scoped_lock<std::mutex> lock(mMutex);
+
+		mPending.ShrinkToFit();
+		mDelivering.ShrinkToFit();
+		mSubscribers.ShrinkToFit();
+		mDeliveringSubscribers.ShrinkToFit();
+	}
+#pragma endregion Publishing
+
+#pragma region Subscription
+	template<typename MessageT>
+	inline void EventChannel<MessageT>::Subscribe(Subscriber& subscriber)
+	{
+		std::scoped_lock<std::mutex> lock(mMutex);
+
+		if (mSubscribers.Find(&subscriber) != mSubscribers.end())
+		{
+			throw std::runtime_error("Subscriber already added.");
+		}
+
+		mSubscribers.PushBack(&subscriber);
+	}
+
+	template<typename MessageT>
+	inline void EventChannel<MessageT>::Unsubscribe(Subscriber& subscriber)
+	{
+		std::scoped_lock<std::mutex> lock(mMutex);
+		mSubscribers.Remove(&subscriber);
+	}
+
+	template<typename MessageT>
+	inline void EventChannel<MessageT>::UnsubscribeAll()
+	{
+		std::scoped_lock<std::mutex> lock(mMutex);
+		mSubscribers.Clear();
+	}
+#pragma endregion Subscription
+}
\ No newline at end of file
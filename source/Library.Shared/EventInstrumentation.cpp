@@ -0,0 +1,367 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "EventInstrumentation.h"
+
+// Standard
+#include <iomanip>
+#pragma endregion Includes
+
+namespace Library
+{
+	FlatHashMap<RTTI::IdType, std::string> EventInstrumentation::sTypeNames;
+
+#pragma region Histogram
+	void EventInstrumentation::Histogram::Merge(const Histogram& rhs)
+	{
+		for (std::size_t i = 0; i < BucketCount; ++i)
+		{
+			mCounts[i] += rhs.mCounts[i];
+		}
+
+		mTotalCount += rhs.mTotalCount;
+		mSum += rhs.mSum;
+		mMin = std::min(mMin, rhs.mMin);
+		mMax = std::max(mMax, rhs.mMax);
+	}
+
+	std::uint64_t EventInstrumentation::Histogram::ValueAtPercentile(const double percentile) const
+	{
+		if (mTotalCount == 0) return 0;
+
+		const double clamped = std::min(std::max(percentile, 0.0), 100.0);
+		const std::uint64_t target = std::max(std::uint64_t(1), static_cast<std::uint64_t>(clamped / 100.0 * static_cast<double>(mTotalCount) + 0.5));
+		std::uint64_t count = 0;
+
+		for (std::size_t i = 0; i < BucketCount; ++i)
+		{
+			count += mCounts[i];
+
+			if (count >= target)
+			{
+				return std::min(BucketValue(i), mMax);
+			}
+		}
+
+		return mMax;
+	}
+#pragma endregion Histogram
+
+#pragma region Per-Thread Data
+	void EventInstrumentation::AtomicHistogram::Record(const std::uint64_t value)
+	{
+		auto& bucket = Counts[Histogram::BucketIndex(value)];
+		bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		TotalCount.store(TotalCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		Sum.store(Sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+
+		if (value < Min.load(std::memory_order_relaxed)) Min.store(value, std::memory_order_relaxed);
+		if (value > Max.load(std::memory_order_relaxed)) Max.store(value, std::memory_order_relaxed);
+	}
+
+	void EventInstrumentation::AtomicHistogram::MergeInto(Histogram& histogram) const
+	{
+		std::uint64_t totalCount = 0;
+
+		for (std::size_t i = 0; i < Histogram::BucketCount; ++i)
+		{
+			const std::uint64_t count = Counts[i].load(std::memory_order_relaxed);
+			histogram.mCounts[i] += count;
+			totalCount += count;
+		}
+
+		histogram.mTotalCount += totalCount;
+		histogram.mSum += Sum.load(std::memory_order_relaxed);
+		histogram.mMin = std::min(histogram.mMin, Min.load(std::memory_order_relaxed));
+		histogram.mMax = std::max(histogram.mMax, Max.load(std::memory_order_relaxed));
+	}
+
+	EventInstrumentation::TypeStats::TypeStats(const RTTI::IdType typeId, TypeStats* next) :
+		TypeId(typeId), Next(next)
+	{
+	}
+
+	EventInstrumentation::ThreadData::ThreadData(const std::size_t threadIndex, ThreadData* next) :
+		ThreadIndex(threadIndex), Next(next)
+	{
+	}
+
+	EventInstrumentation::ThreadData::~ThreadData()
+	{
+		TypeStats* stats = Types.load(std::memory_order_relaxed);
+
+		while (stats)
+		{
+			TypeStats* next = stats->Next;
+			delete stats;
+			stats = next;
+		}
+
+		delete[] TraceEvents.load(std::memory_order_relaxed);
+	}
+#pragma endregion Per-Thread Data
+
+#pragma region Configuration
+	void EventInstrumentation::SetTypeName(const RTTI::IdType typeId, std::string name)
+	{
+		std::lock_guard<std::mutex> lock(sTypeNamesMutex);
+
+		auto it = sTypeNames.Find(typeId);
+		if (it != sTypeNames.end())
+		{
+			it->second = std::move(name);
+		}
+		else
+		{
+			sTypeNames.Emplace(typeId, std::move(name));
+		}
+	}
+
+	std::string EventInstrumentation::TypeName(const RTTI::IdType typeId)
+	{
+		{
+			std::lock_guard<std::mutex> lock(sTypeNamesMutex);
+
+			auto it = sTypeNames.Find(typeId);
+			if (it != sTypeNames.end())
+			{
+				return it->second;
+			}
+		}
+
+		return "Event " + std::to_string(typeId);
+	}
+
+	void EventInstrumentation::Reset()
+	{
+		sGeneration.fetch_add(1, std::memory_order_acq_rel);
+
+		ThreadData* data = sThreads.exchange(nullptr, std::memory_order_acquire);
+
+		while (data)
+		{
+			ThreadData* next = data->Next;
+			delete data;
+			data = next;
+		}
+
+		sThreadCount.store(0, std::memory_order_relaxed);
+		sEpoch = Clock::now();
+
+		std::lock_guard<std::mutex> lock(sTypeNamesMutex);
+		sTypeNames.Clear();
+	}
+#pragma endregion Configuration
+
+#pragma region Recording
+	void EventInstrumentation::RecordEnqueue(const RTTI::IdType typeId)
+	{
+		TypeStats& stats = LocalStats(typeId);
+		stats.EnqueueCount.store(stats.EnqueueCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	}
+
+	void EventInstrumentation::RecordPublish(const RTTI::IdType typeId, const TimePoint& enqueueTime, const TimePoint& publishTime)
+	{
+		TypeStats& stats = LocalStats(typeId);
+		stats.PublishCount.store(stats.PublishCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+		if (enqueueTime != TimePoint())
+		{
+			stats.DwellTime.Record(Nanoseconds(enqueueTime, publishTime));
+			Trace(LocalData(), typeId, TracePhase::Queued, enqueueTime, publishTime);
+		}
+	}
+
+	void EventInstrumentation::RecordNotify(const RTTI::IdType typeId, const TimePoint& start, const TimePoint& end)
+	{
+		TypeStats& stats = LocalStats(typeId);
+		stats.NotifyCount.store(stats.NotifyCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		stats.HandlerTime.Record(Nanoseconds(start, end));
+
+		Trace(LocalData(), typeId, TracePhase::Notify, start, end);
+	}
+#pragma endregion Recording
+
+#pragma region Reporting
+	Vector<EventInstrumentation::TypeReport> EventInstrumentation::Report()
+	{
+		Vector<TypeReport> reports{ Vector<TypeReport>::EqualityFunctor() };
+		FlatHashMap<RTTI::IdType, std::size_t> reportIndices;
+
+		for (ThreadData* data = sThreads.load(std::memory_order_acquire); data; data = data->Next)
+		{
+			for (TypeStats* stats = data->Types.load(std::memory_order_acquire); stats; stats = stats->Next)
+			{
+				auto [it, isNew] = reportIndices.Emplace(stats->TypeId, reports.Size());
+				if (isNew)
+				{
+					TypeReport& report = reports.EmplaceBack();
+					report.TypeId = stats->TypeId;
+					report.Name = TypeName(stats->TypeId);
+				}
+
+				TypeReport& report = reports[it->second];
+				report.EnqueueCount += stats->EnqueueCount.load(std::memory_order_relaxed);
+				report.PublishCount += stats->PublishCount.load(std::memory_order_relaxed);
+				report.NotifyCount += stats->NotifyCount.load(std::memory_order_relaxed);
+				stats->DwellTime.MergeInto(report.DwellTime);
+				stats->HandlerTime.MergeInto(report.HandlerTime);
+			}
+		}
+
+		std::sort(reports.begin(), reports.end(), [](const TypeReport& lhs, const TypeReport& rhs)
+		{
+			return lhs.HandlerTime.Sum() > rhs.HandlerTime.Sum();
+		});
+
+		return reports;
+	}
+
+	std::size_t EventInstrumentation::DroppedTraceCount()
+	{
+		std::size_t droppedCount = 0;
+
+		for (ThreadData* data = sThreads.load(std::memory_order_acquire); data; data = data->Next)
+		{
+			droppedCount += data->DroppedCount.load(std::memory_order_relaxed);
+		}
+
+		return droppedCount;
+	}
+
+	void EventInstrumentation::WriteChromeTrace(std::ostream& stream)
+	{
+		FlatHashMap<RTTI::IdType, std::string> names;
+		bool isFirst = true;
+
+		stream << "{\"traceEvents\":[";
+
+		for (ThreadData* data = sThreads.load(std::memory_order_acquire); data; data = data->Next)
+		{
+			const std::size_t count = data->TraceCount.load(std::memory_order_acquire);
+			const TraceEvent* events = data->TraceEvents.load(std::memory_order_acquire);
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const TraceEvent& event = events[i];
+
+				auto [it, isNew] = names.Emplace(event.TypeId, std::string());
+				if (isNew)
+				{
+					it->second = TypeName(event.TypeId);
+				}
+
+				stream << (isFirst ? "" : ",") << "\n{\"name\":";
+				WriteJsonString(stream, it->second);
+				stream << ",\"cat\":\"" << (event.Phase == TracePhase::Queued ? "Queued" : "Notify") << "\",\"ph\":\"X\"";
+				stream << ",\"ts\":" << event.Start / 1000 << '.' << std::setw(3) << std::setfill('0') << event.Start % 1000;
+				stream << ",\"dur\":" << event.Duration / 1000 << '.' << std::setw(3) << std::setfill('0') << event.Duration % 1000;
+				stream << ",\"pid\":0,\"tid\":" << data->ThreadIndex << "}";
+
+				isFirst = false;
+			}
+		}
+
+		stream << "\n]}\n";
+	}
+
+	void EventInstrumentation::SaveChromeTrace(const std::string& filename)
+	{
+		std::ofstream file(filename.c_str());
+		if (!file.is_open())
+		{
+			throw std::runtime_error("Could not open file.");
+		}
+
+		WriteChromeTrace(file);
+	}
+#pragma endregion Reporting
+
+#pragma region Helper Methods
+	EventInstrumentation::TypeStats& EventInstrumentation::LocalStats(const RTTI::IdType typeId)
+	{
+		ThreadData& data = LocalData();
+
+		auto it = data.TypeLookup.Find(typeId);
+		if (it != data.TypeLookup.end())
+		{
+			return *it->second;
+		}
+
+		TypeStats* stats = new TypeStats(typeId, data.Types.load(std::memory_order_relaxed));
+		data.Types.store(stats, std::memory_order_release);
+		data.TypeLookup.Emplace(typeId, stats);
+
+		return *stats;
+	}
+
+	void EventInstrumentation::Trace(ThreadData& data, const RTTI::IdType typeId, const TracePhase phase, const TimePoint& start, const TimePoint& end)
+	{
+		if (!IsTracing()) return;
+
+		TraceEvent* events = data.TraceEvents.load(std::memory_order_relaxed);
+		if (!events)
+		{
+			events = new TraceEvent[TraceCapacity];
+			data.TraceEvents.store(events, std::memory_order_release);
+		}
+
+		const std::size_t count = data.TraceCount.load(std::memory_order_relaxed);
+		if (count == TraceCapacity)
+		{
+			data.DroppedCount.store(data.DroppedCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			return;
+		}
+
+		const auto startTime = std::chrono::duration_cast<std::chrono::nanoseconds>(start - sEpoch).count();
+		events[count] = TraceEvent{ typeId, std::max<std::int64_t>(startTime, 0), static_cast<std::int64_t>(Nanoseconds(start, end)), phase };
+		data.TraceCount.store(count + 1, std::memory_order_release);
+	}
+
+	void EventInstrumentation::WriteJsonString(std::ostream& stream, const std::string& string)
+	{
+		stream << '"';
+
+		for (const char c : string)
+		{
+			switch (c)
+			{
+			case '"':
+				stream << "\\\"";
+				break;
+
+			case '\\':
+				stream << "\\\\";
+				break;
+
+			case '\n':
+				stream << "\\n";
+				break;
+
+			case '\r':
+				stream << "\\r";
+				break;
+
+			case '\t':
+				stream << "\\t";
+				break;
+
+			default:
+				if (static_cast<unsigned char>(c) < 0x20)
+				{
+					stream << "\\u00" << "0123456789abcdef"[(c >> 4) & 0xF] << "0123456789abcdef"[c & 0xF];
+				}
+				else
+				{
+					stream << c;
+				}
+				break;
+			}
+		}
+
+		stream << '"';
+	}
+#pragma endregion Helper Methods
+}
\ No newline at end of file
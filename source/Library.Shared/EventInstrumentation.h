@@ -0,0 +1,509 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// First Party
+#include "RTTI.h"
+#include "Vector.h"
+#include "FlatHashMap.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Opt-in instrumentation of Event delivery, recording per Event type counts, queue dwell time and handler latency.
+	/// Each thread records into its own lock-free histograms, merged on demand by Report, and can also record
+	/// a trace of every dwell and Notify span, written out as Chrome trace-event JSON.
+	/// The EventQueue and EventPublisher hooks are only compiled when EVENT_INSTRUMENTATION is defined,
+	/// and only record while instrumentation is enabled at run time.
+	/// </summary>
+	class EventInstrumentation final
+	{
+#pragma region Type Definitions, Constants
+	public:
+		/// <summary>
+		/// Clock used to timestamp instrumented Event instances.
+		/// </summary>
+		using Clock = std::chrono::high_resolution_clock;
+
+		/// <summary>
+		/// Type definition for a point in time.
+		/// </summary>
+		using TimePoint = Clock::time_point;
+
+		/// <summary>
+		/// Maximum number of trace events recorded by each thread before further events are dropped.
+		/// </summary>
+		static constexpr std::size_t TraceCapacity{ 16384 };
+
+		/// <summary>
+		/// Log-linear histogram of nanosecond durations, in the style of an HDR histogram.
+		/// Every power of two range is split into SubBucketCount buckets, bounding the relative error of any reported value.
+		/// </summary>
+		class Histogram final
+		{
+			friend EventInstrumentation;
+
+		public:
+			/// <summary>
+			/// Number of bits of precision kept below the highest set bit of a value.
+			/// </summary>
+			static constexpr std::size_t SubBucketBits{ 3 };
+
+			/// <summary>
+			/// Number of buckets per power of two range.
+			/// </summary>
+			static constexpr std::size_t SubBucketCount{ std::size_t(1) << SubBucketBits };
+
+			/// <summary>
+			/// Number of buckets covering every 64 bit value.
+			/// </summary>
+			static constexpr std::size_t BucketCount{ (64 - SubBucketBits + 1) * SubBucketCount };
+
+			/// <summary>
+			/// Gets the bucket counting the given value.
+			/// </summary>
+			/// <param name="value">Value to be counted.</param>
+			/// <returns>Index of the bucket.</returns>
+			static std::size_t BucketIndex(const std::uint64_t value);
+
+			/// <summary>
+			/// Gets the highest value counted by the given bucket.
+			/// </summary>
+			/// <param name="index">Index of the bucket.</param>
+			/// <returns>Highest value equivalent to the bucket.</returns>
+			static std::uint64_t BucketValue(const std::size_t index);
+
+			/// <summary>
+			/// Counts a value.
+			/// </summary>
+			/// <param name="value">Value to be counted.</param>
+			void Record(const std::uint64_t value);
+
+			/// <summary>
+			/// Adds every value counted by another Histogram.
+			/// </summary>
+			/// <param name="rhs">Histogram to be added.</param>
+			void Merge(const Histogram& rhs);
+
+			/// <summary>
+			/// Gets the number of values counted.
+			/// </summary>
+			/// <returns>Number of values counted.</returns>
+			std::uint64_t TotalCount() const;
+
+			/// <summary>
+			/// Gets the sum of the values counted.
+			/// </summary>
+			/// <returns>Sum of the values counted.</returns>
+			std::uint64_t Sum() const;
+
+			/// <summary>
+			/// Gets the smallest value counted.
+			/// </summary>
+			/// <returns>Smallest value counted, or zero if empty.</returns>
+			std::uint64_t Min() const;
+
+			/// <summary>
+			/// Gets the largest value counted.
+			/// </summary>
+			/// <returns>Largest value counted, or zero if empty.</returns>
+			std::uint64_t Max() const;
+
+			/// <summary>
+			/// Gets the mean of the values counted.
+			/// </summary>
+			/// <returns>Mean of the values counted, or zero if empty.</returns>
+			double Mean() const;
+
+			/// <summary>
+			/// Gets the value below which the given percentage of the values counted fall, within the bucket precision.
+			/// </summary>
+			/// <param name="percentile">Percentage between 0 and 100.</param>
+			/// <returns>Value at the percentile, or zero if empty.</returns>
+			std::uint64_t ValueAtPercentile(const double percentile) const;
+
+		private:
+			/// <summary>
+			/// Gets the index of the highest set bit of a non-zero value.
+			/// </summary>
+			/// <param name="value">Non-zero value.</param>
+			/// <returns>Index of the highest set bit.</returns>
+			static std::size_t HighestBit(const std::uint64_t value);
+
+			/// <summary>
+			/// Number of values counted by each bucket.
+			/// </summary>
+			std::array<std::uint64_t, BucketCount> mCounts{};
+
+			/// <summary>
+			/// Number of values counted.
+			/// </summary>
+			std::uint64_t mTotalCount{ 0 };
+
+			/// <summary>
+			/// Sum of the values counted.
+			/// </summary>
+			std::uint64_t mSum{ 0 };
+
+			/// <summary>
+			/// Smallest value counted.
+			/// </summary>
+			std::uint64_t mMin{ std::numeric_limits<std::uint64_t>::max() };
+
+			/// <summary>
+			/// Largest value counted.
+			/// </summary>
+			std::uint64_t mMax{ 0 };
+		};
+
+		/// <summary>
+		/// Statistics of an Event type, merged across every thread.
+		/// </summary>
+		struct TypeReport final
+		{
+			/// <summary>
+			/// RTTI type identifier of the Event type.
+			/// </summary>
+			RTTI::IdType TypeId{ 0 };
+
+			/// <summary>
+			/// Name of the Event type, as set by SetTypeName.
+			/// </summary>
+			std::string Name;
+
+			/// <summary>
+			/// Number of Event instances enqueued.
+			/// </summary>
+			std::uint64_t EnqueueCount{ 0 };
+
+			/// <summary>
+			/// Number of Event instances published by an EventQueue.
+			/// </summary>
+			std::uint64_t PublishCount{ 0 };
+
+			/// <summary>
+			/// Number of calls to IEventSubscriber::Notify.
+			/// </summary>
+			std::uint64_t NotifyCount{ 0 };
+
+			/// <summary>
+			/// Nanoseconds between Enqueue and publication.
+			/// </summary>
+			Histogram DwellTime;
+
+			/// <summary>
+			/// Nanoseconds spent in each call to IEventSubscriber::Notify.
+			/// </summary>
+			Histogram HandlerTime;
+		};
+
+	private:
+		/// <summary>
+		/// Histogram written by a single thread while other threads may read it.
+		/// </summary>
+		struct AtomicHistogram final
+		{
+			/// <summary>
+			/// Counts a value. Must only be called by the owning thread.
+			/// </summary>
+			/// <param name="value">Value to be counted.</param>
+			void Record(const std::uint64_t value);
+
+			/// <summary>
+			/// Adds the values counted so far to a Histogram.
+			/// </summary>
+			/// <param name="histogram">Histogram receiving the values.</param>
+			void MergeInto(Histogram& histogram) const;
+
+			std::array<std::atomic<std::uint64_t>, Histogram::BucketCount> Counts{};
+			std::atomic<std::uint64_t> TotalCount{ 0 };
+			std::atomic<std::uint64_t> Sum{ 0 };
+			std::atomic<std::uint64_t> Min{ std::numeric_limits<std::uint64_t>::max() };
+			std::atomic<std::uint64_t> Max{ 0 };
+		};
+
+		/// <summary>
+		/// Statistics of an Event type recorded by a single thread.
+		/// </summary>
+		struct TypeStats final
+		{
+			TypeStats(const RTTI::IdType typeId, TypeStats* next);
+
+			RTTI::IdType TypeId;
+			std::atomic<std::uint64_t> EnqueueCount{ 0 };
+			std::atomic<std::uint64_t> PublishCount{ 0 };
+			std::atomic<std::uint64_t> NotifyCount{ 0 };
+			AtomicHistogram DwellTime;
+			AtomicHistogram HandlerTime;
+			TypeStats* Next;
+		};
+
+		/// <summary>
+		/// Kind of span recorded in the trace.
+		/// </summary>
+		enum class TracePhase : std::uint8_t
+		{
+			Queued,
+			Notify
+		};
+
+		/// <summary>
+		/// Span recorded in the trace, timed in nanoseconds since the epoch of the instrumentation.
+		/// </summary>
+		struct TraceEvent final
+		{
+			RTTI::IdType TypeId;
+			std::int64_t Start;
+			std::int64_t Duration;
+			TracePhase Phase;
+		};
+
+		/// <summary>
+		/// Statistics and trace recorded by a single thread, linked into the list of every thread's data.
+		/// </summary>
+		struct ThreadData final
+		{
+			ThreadData(const std::size_t threadIndex, ThreadData* next);
+			~ThreadData();
+
+			ThreadData(const ThreadData&) = delete;
+			ThreadData& operator=(const ThreadData&) = delete;
+
+			std::size_t ThreadIndex;
+			std::atomic<TypeStats*> Types{ nullptr };
+			FlatHashMap<RTTI::IdType, TypeStats*> TypeLookup;
+			std::atomic<TraceEvent*> TraceEvents{ nullptr };
+			std::atomic<std::size_t> TraceCount{ 0 };
+			std::atomic<std::size_t> DroppedCount{ 0 };
+			ThreadData* Next;
+		};
+#pragma endregion Type Definitions, Constants
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Deleted default constructor, since the class only has static members.
+		/// </summary>
+		EventInstrumentation() = delete;
+#pragma endregion Special Members
+
+#pragma region Configuration
+	public:
+		/// <summary>
+		/// Checks if Event instances are being recorded.
+		/// </summary>
+		/// <returns>True if recording, otherwise false.</returns>
+		static bool IsEnabled();
+
+		/// <summary>
+		/// Starts or stops recording Event instances.
+		/// </summary>
+		/// <param name="isEnabled">True to start recording, false to stop.</param>
+		static void SetEnabled(const bool isEnabled);
+
+		/// <summary>
+		/// Checks if spans are added to the trace while recording.
+		/// </summary>
+		/// <returns>True if tracing, otherwise false.</returns>
+		static bool IsTracing();
+
+		/// <summary>
+		/// Starts or stops adding spans to the trace while recording.
+		/// </summary>
+		/// <param name="isTracing">True to start tracing, false to stop.</param>
+		static void SetTracing(const bool isTracing);
+
+		/// <summary>
+		/// Names an Event type in reports and traces.
+		/// </summary>
+		/// <param name="typeId">RTTI type identifier of the Event type.</param>
+		/// <param name="name">Name of the Event type.</param>
+		static void SetTypeName(const RTTI::IdType typeId, std::string name);
+
+		/// <summary>
+		/// Names an Event type in reports and traces.
+		/// </summary>
+		/// <typeparam name="EventT">Event type to be named.</typeparam>
+		/// <param name="name">Name of the Event type.</param>
+		template<typename EventT>
+		static void SetTypeName(std::string name);
+
+		/// <summary>
+		/// Gets the name of an Event type.
+		/// </summary>
+		/// <param name="typeId">RTTI type identifier of the Event type.</param>
+		/// <returns>Name set by SetTypeName, or a name made from the type identifier.</returns>
+		static std::string TypeName(const RTTI::IdType typeId);
+
+		/// <summary>
+		/// Discards every recorded statistic, trace span and type name, and restarts the trace clock.
+		/// </summary>
+		/// <remarks>Must not be called while any thread may be recording.</remarks>
+		static void Reset();
+#pragma endregion Configuration
+
+#pragma region Recording
+	public:
+		/// <summary>
+		/// Records an Event instance being enqueued.
+		/// </summary>
+		/// <param name="typeId">RTTI type identifier of the Event.</param>
+		static void RecordEnqueue(const RTTI::IdType typeId);
+
+		/// <summary>
+		/// Records an Event instance being published, along with the time it waited in the queue.
+		/// </summary>
+		/// <param name="typeId">RTTI type identifier of the Event.</param>
+		/// <param name="enqueueTime">Time the Event was enqueued, or a default TimePoint if not recorded.</param>
+		/// <param name="publishTime">Time the Event was published.</param>
+		static void RecordPublish(const RTTI::IdType typeId, const TimePoint& enqueueTime, const TimePoint& publishTime);
+
+		/// <summary>
+		/// Records a call to IEventSubscriber::Notify.
+		/// </summary>
+		/// <param name="typeId">RTTI type identifier of the Event.</param>
+		/// <param name="start">Time the call started.</param>
+		/// <param name="end">Time the call returned.</param>
+		static void RecordNotify(const RTTI::IdType typeId, const TimePoint& start, const TimePoint& end);
+#pragma endregion Recording
+
+#pragma region Reporting
+	public:
+		/// <summary>
+		/// Merges the statistics recorded by every thread.
+		/// </summary>
+		/// <returns>Statistics of every recorded Event type, by descending total handler time.</returns>
+		static Vector<TypeReport> Report();
+
+		/// <summary>
+		/// Gets the number of trace spans dropped because a thread filled its trace.
+		/// </summary>
+		/// <returns>Number of dropped trace spans.</returns>
+		static std::size_t DroppedTraceCount();
+
+		/// <summary>
+		/// Writes the trace recorded by every thread as Chrome trace-event JSON.
+		/// </summary>
+		/// <param name="stream">Stream receiving the JSON.</param>
+		static void WriteChromeTrace(std::ostream& stream);
+
+		/// <summary>
+		/// Saves the trace recorded by every thread as a Chrome trace-event JSON file.
+		/// </summary>
+		/// <param name="filename">Path of the file to be written.</param>
+		/// <exception cref="std::runtime_error">File could not be opened.</exception>
+		static void SaveChromeTrace(const std::string& filename);
+#pragma endregion Reporting
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Gets the data of the calling thread, creating it on first use.
+		/// </summary>
+		/// <returns>Data of the calling thread.</returns>
+		static ThreadData& LocalData();
+
+		/// <summary>
+		/// Gets the statistics of an Event type recorded by the calling thread, creating them on first use.
+		/// </summary>
+		/// <param name="typeId">RTTI type identifier of the Event.</param>
+		/// <returns>Statistics of the Event type.</returns>
+		static TypeStats& LocalStats(const RTTI::IdType typeId);
+
+		/// <summary>
+		/// Adds a span to the trace of the calling thread, if tracing.
+		/// </summary>
+		/// <param name="data">Data of the calling thread.</param>
+		/// <param name="typeId">RTTI type identifier of the Event.</param>
+		/// <param name="phase">Kind of span.</param>
+		/// <param name="start">Time the span started.</param>
+		/// <param name="end">Time the span ended.</param>
+		static void Trace(ThreadData& data, const RTTI::IdType typeId, const TracePhase phase, const TimePoint& start, const TimePoint& end);
+
+		/// <summary>
+		/// Gets the nanoseconds between two points in time, clamped to zero.
+		/// </summary>
+		/// <param name="start">Earlier point in time.</param>
+		/// <param name="end">Later point in time.</param>
+		/// <returns>Nanoseconds between the points in time.</returns>
+		static std::uint64_t Nanoseconds(const TimePoint& start, const TimePoint& end);
+
+		/// <summary>
+		/// Writes a string as a JSON string literal.
+		/// </summary>
+		/// <param name="stream">Stream receiving the literal.</param>
+		/// <param name="string">String to be written.</param>
+		static void WriteJsonString(std::ostream& stream, const std::string& string);
+#pragma endregion Helper Methods
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Represents whether Event instances are being recorded.
+		/// </summary>
+		inline static std::atomic<bool> sIsEnabled{ false };
+
+		/// <summary>
+		/// Represents whether spans are added to the trace while recording.
+		/// </summary>
+		inline static std::atomic<bool> sIsTracing{ false };
+
+		/// <summary>
+		/// Head of the list of every thread's data.
+		/// </summary>
+		inline static std::atomic<ThreadData*> sThreads{ nullptr };
+
+		/// <summary>
+		/// Number of threads that have recorded since the last Reset.
+		/// </summary>
+		inline static std::atomic<std::size_t> sThreadCount{ 0 };
+
+		/// <summary>
+		/// Incremented by Reset, so threads recreate their data.
+		/// </summary>
+		inline static std::atomic<std::size_t> sGeneration{ 0 };
+
+		/// <summary>
+		/// Origin of the trace clock.
+		/// </summary>
+		inline static TimePoint sEpoch{ Clock::now() };
+
+		/// <summary>
+		/// Data of the calling thread, valid while sLocalGeneration matches sGeneration.
+		/// </summary>
+		inline static thread_local ThreadData* sLocalData{ nullptr };
+
+		/// <summary>
+		/// Generation in which the data of the calling thread was created.
+		/// </summary>
+		inline static thread_local std::size_t sLocalGeneration{ 0 };
+
+		/// <summary>
+		/// Names of the Event types.
+		/// </summary>
+		static FlatHashMap<RTTI::IdType, std::string> sTypeNames;
+
+		/// <summary>
+		/// Mutex guarding the names of the Event types.
+		/// </summary>
+		inline static std::mutex sTypeNamesMutex;
+#pragma endregion Data Members
+	};
+}
+
+// Inline File
+#include "EventInstrumentation.inl"
\ No newline at end of file
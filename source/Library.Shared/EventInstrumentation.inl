@@ -0,0 +1,131 @@
+#pragma once
+
+// Header
+#include "EventInstrumentation.h"
+
+namespace Library
+{
+#pragma region Histogram
+	inline std::size_t EventInstrumentation::Histogram::BucketIndex(const std::uint64_t value)
+	{
+		if (value < SubBucketCount) return static_cast<std::size_t>(value);
+
+		const std::size_t shift = HighestBit(value) - SubBucketBits;
+		return (shift + 1) * SubBucketCount + static_cast<std::size_t>((value >> shift) - SubBucketCount);
+	}
+
+	inline std::uint64_t EventInstrumentation::Histogram::BucketValue(const std::size_t index)
+	{
+		if (index < SubBucketCount) return index;
+
+		const std::size_t shift = index / SubBucketCount - 1;
+		const std::uint64_t lowest = static_cast<std::uint64_t>(SubBucketCount + index % SubBucketCount) << shift;
+		return lowest + ((std::uint64_t(1) << shift) - 1);
+	}
+
+	inline void EventInstrumentation::Histogram::Record(const std::uint64_t value)
+	{
+		++mCounts[BucketIndex(value)];
+		++mTotalCount;
+		mSum += value;
+		mMin = std::min(mMin, value);
+		mMax = std::max(mMax, value);
+	}
+
+	inline std::uint64_t EventInstrumentation::Histogram::TotalCount() const
+	{
+		return mTotalCount;
+	}
+
+	inline std::uint64_t EventInstrumentation::Histogram::Sum() const
+	{
+		return mSum;
+	}
+
+	inline std::uint64_t EventInstrumentation::Histogram::Min() const
+	{
+		return mTotalCount > 0 ? mMin : 0;
+	}
+
+	inline std::uint64_t EventInstrumentation::Histogram::Max() const
+	{
+		return mMax;
+	}
+
+	inline double EventInstrumentation::Histogram::Mean() const
+	{
+		return mTotalCount > 0 ? static_cast<double>(mSum) / static_cast<double>(mTotalCount) : 0.0;
+	}
+
+	inline std::size_t EventInstrumentation::Histogram::HighestBit(const std::uint64_t value)
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		const unsigned long high = static_cast<unsigned long>(value >> 32);
+
+		if (high != 0)
+		{
+			_BitScanReverse(&index, high);
+			return static_cast<std::size_t>(index) + 32;
+		}
+
+		_BitScanReverse(&index, static_cast<unsigned long>(value));
+		return static_cast<std::size_t>(index);
+#else
+		return static_cast<std::size_t>(63 - __builtin_clzll(value));
+#endif
+	}
+#pragma endregion Histogram
+
+#pragma region Configuration
+	inline bool EventInstrumentation::IsEnabled()
+	{
+		return sIsEnabled.load(std::memory_order_relaxed);
+	}
+
+	inline void EventInstrumentation::SetEnabled(const bool isEnabled)
+	{
+		sIsEnabled.store(isEnabled, std::memory_order_relaxed);
+	}
+
+	inline bool EventInstrumentation::IsTracing()
+	{
+		return sIsTracing.load(std::memory_order_relaxed);
+	}
+
+	inline void EventInstrumentation::SetTracing(const bool isTracing)
+	{
+		sIsTracing.store(isTracing, std::memory_order_relaxed);
+	}
+
+	template<typename EventT>
+	inline void EventInstrumentation::SetTypeName(std::string name)
+	{
+		SetTypeName(EventT::TypeIdClass(), std::move(name));
+	}
+#pragma endregion Configuration
+
+#pragma region Helper Methods
+	inline EventInstrumentation::ThreadData& EventInstrumentation::LocalData()
+	{
+		const std::size_t generation = sGeneration.load(std::memory_order_acquire);
+
+		if (sLocalData == nullptr || sLocalGeneration != generation)
+		{
+			ThreadData* data = new ThreadData(sThreadCount.fetch_add(1, std::memory_order_relaxed), sThreads.load(std::memory_order_relaxed));
+			while (!sThreads.compare_exchange_weak(data->Next, data, std::memory_order_release, std::memory_order_relaxed));
+
+			sLocalData = data;
+			sLocalGeneration = generation;
+		}
+
+		return *sLocalData;
+	}
+
+	inline std::uint64_t EventInstrumentation::Nanoseconds(const TimePoint& start, const TimePoint& end)
+	{
+		const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+		return nanoseconds > 0 ? static_cast<std::uint64_t>(nanoseconds) : 0;
+	}
+#pragma endregion Helper Methods
+}
\ No newline at end of file
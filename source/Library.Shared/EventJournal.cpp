@@ -0,0 +1,225 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "EventJournal.h"
+
+// Standard
+#include <cstring>
+
+// First Party
+#include "GameTime.h"
+#include "StreamHelper.h"
+#pragma endregion Includes
+
+namespace Library
+{
+#pragma region Record Buffer
+	EventJournal::RecordBuffer::int_type EventJournal::RecordBuffer::overflow(int_type character)
+	{
+		if (!traits_type::eq_int_type(character, traits_type::eof()))
+		{
+			Bytes.push_back(traits_type::to_char_type(character));
+		}
+
+		return traits_type::not_eof(character);
+	}
+
+	std::streamsize EventJournal::RecordBuffer::xsputn(const char* characters, std::streamsize count)
+	{
+		Bytes.append(characters, static_cast<std::size_t>(count));
+		return count;
+	}
+#pragma endregion Record Buffer
+
+#pragma region Special Members
+	EventJournal::EventJournal(std::ostream& stream, const std::size_t ringCapacity) :
+		mStream(stream)
+	{
+		std::size_t capacity = 64;
+
+		while (capacity < ringCapacity)
+		{
+			capacity <<= 1;
+		}
+
+		mRing = std::make_unique<char[]>(capacity);
+		mRingMask = capacity - 1;
+
+		RecordBuffer& buffer = LocalBuffer();
+		OutputStreamHelper helper(buffer.Stream);
+		helper << Magic << Version;
+		Append(buffer.Bytes);
+
+		mWriter = std::thread(&EventJournal::WriterLoop, this);
+	}
+
+	EventJournal::~EventJournal()
+	{
+		{
+			std::scoped_lock<std::mutex> lock(mMutex);
+			mIsRunning = false;
+		}
+
+		mWakeCondition.notify_one();
+		mWriter.join();
+	}
+#pragma endregion Special Members
+
+#pragma region Recording
+	void EventJournal::RecordEnqueue(const EventPublisher& event, const std::chrono::high_resolution_clock::time_point& expireTime)
+	{
+		const auto it = mTypes.Find(event.TypeIdInstance());
+
+		if (it == mTypes.end())
+		{
+			mUnregisteredCount.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		RecordBuffer& buffer = LocalBuffer();
+		OutputStreamHelper helper(buffer.Stream);
+
+		helper << static_cast<std::uint32_t>(RecordType::Enqueue) << it->second.Index
+			<< static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(expireTime.time_since_epoch()).count())
+			<< std::uint32_t(0);
+
+		const std::size_t payloadOffset = buffer.Bytes.size();
+		it->second.Write(helper, event);
+
+		const std::uint32_t payloadSize = static_cast<std::uint32_t>(buffer.Bytes.size() - payloadOffset);
+		std::memcpy(&buffer.Bytes[payloadOffset - sizeof(std::uint32_t)], &payloadSize, sizeof(std::uint32_t));
+
+		Append(buffer.Bytes);
+		mEnqueueCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void EventJournal::RecordUpdate(const GameTime& gameTime)
+	{
+		RecordBuffer& buffer = LocalBuffer();
+		OutputStreamHelper helper(buffer.Stream);
+
+		helper << static_cast<std::uint32_t>(RecordType::Update)
+			<< static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(gameTime.CurrentTime().time_since_epoch()).count())
+			<< static_cast<std::int64_t>(gameTime.TotalGameTime().count())
+			<< static_cast<std::int64_t>(gameTime.ElapsedGameTime().count());
+
+		Append(buffer.Bytes);
+	}
+
+	void EventJournal::Flush()
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+
+		const std::size_t appendedBytes = mAppendedBytes;
+		mWrittenCondition.wait(lock, [this, appendedBytes] { return mWrittenBytes >= appendedBytes || mHasFailed; });
+
+		if (mHasFailed) throw std::runtime_error("Could not write journal.");
+	}
+#pragma endregion Recording
+
+#pragma region Helper Methods
+	void EventJournal::Register(const RTTI::IdType typeId, const std::string& name, std::function<void(OutputStreamHelper&, const EventPublisher&)> write)
+	{
+		const std::uint32_t index = static_cast<std::uint32_t>(mTypes.Size());
+
+		if (!mTypes.Emplace(typeId, TypeEntry{ index, std::move(write) }).second)
+		{
+			throw std::runtime_error("Event type already registered.");
+		}
+
+		RecordBuffer& buffer = LocalBuffer();
+		OutputStreamHelper helper(buffer.Stream);
+		helper << static_cast<std::uint32_t>(RecordType::Type) << index << name;
+		Append(buffer.Bytes);
+	}
+
+	EventJournal::RecordBuffer& EventJournal::LocalBuffer()
+	{
+		thread_local RecordBuffer buffer;
+
+		buffer.Bytes.clear();
+		return buffer;
+	}
+
+	void EventJournal::Append(const std::string& record)
+	{
+		{
+			std::scoped_lock<std::mutex> lock(mMutex);
+
+			const std::size_t capacity = mRingMask + 1;
+
+			if (mOverflow.empty() && capacity - (mRingHead - mRingTail) >= record.size())
+			{
+				const std::size_t offset = mRingHead & mRingMask;
+				const std::size_t firstSize = std::min(record.size(), capacity - offset);
+
+				std::memcpy(&mRing[offset], record.data(), firstSize);
+				std::memcpy(&mRing[0], record.data() + firstSize, record.size() - firstSize);
+				mRingHead += record.size();
+			}
+			else
+			{
+				mOverflow.append(record);
+				++mOverflowCount;
+			}
+
+			mAppendedBytes += record.size();
+		}
+
+		mWakeCondition.notify_one();
+	}
+
+	void EventJournal::WriterLoop()
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+
+		while (true)
+		{
+			mWakeCondition.wait(lock, [this] { return !mIsRunning || mRingHead != mRingTail || !mOverflow.empty(); });
+
+			if (mRingHead != mRingTail)
+			{
+				const std::size_t head = mRingHead;
+				const std::size_t tail = mRingTail;
+				lock.unlock();
+
+				const std::size_t capacity = mRingMask + 1;
+				const std::size_t offset = tail & mRingMask;
+				const std::size_t size = head - tail;
+				const std::size_t firstSize = std::min(size, capacity - offset);
+
+				mStream.write(&mRing[offset], static_cast<std::streamsize>(firstSize));
+				mStream.write(&mRing[0], static_cast<std::streamsize>(size - firstSize));
+				mStream.flush();
+
+				lock.lock();
+				mRingTail = head;
+				mWrittenBytes += size;
+			}
+			else if (!mOverflow.empty())
+			{
+				mWriting.swap(mOverflow);
+				lock.unlock();
+
+				mStream.write(mWriting.data(), static_cast<std::streamsize>(mWriting.size()));
+				mStream.flush();
+
+				const std::size_t size = mWriting.size();
+				mWriting.clear();
+
+				lock.lock();
+				mWrittenBytes += size;
+			}
+			else
+			{
+				break;
+			}
+
+			if (!mStream) mHasFailed = true;
+			mWrittenCondition.notify_all();
+		}
+	}
+#pragma endregion Helper Methods
+}
\ No newline at end of file
@@ -0,0 +1,317 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <thread>
+
+// First Party
+#include "RTTI.h"
+#include "FlatHashMap.h"
+#include "Event.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	// Forward Declarations
+	class GameTime;
+	class OutputStreamHelper;
+
+	/// <summary>
+	/// Compact binary log of every Event enqueued on an EventQueue and every EventQueue Update, for deterministic replay by EventReplay.
+	/// Records are serialized on the calling thread into a fixed ring buffer, then written to the stream by a background thread,
+	/// so recording never waits on the stream. Records that do not fit in the ring are kept in order in an overflow buffer.
+	/// Event types are journaled by a stable name, along with a function serializing their message.
+	/// </summary>
+	class EventJournal final
+	{
+#pragma region Type Definitions, Constants
+	public:
+		/// <summary>
+		/// Default size, in bytes, of the ring buffer.
+		/// </summary>
+		static constexpr std::size_t DefaultRingCapacity{ std::size_t(1) << 20 };
+
+		/// <summary>
+		/// Identifies the start of an EventJournal stream.
+		/// </summary>
+		static constexpr std::uint32_t Magic{ 0x4C4A5645 };
+
+		/// <summary>
+		/// Version of the record layout.
+		/// </summary>
+		static constexpr std::uint32_t Version{ 1 };
+
+		/// <summary>
+		/// Kinds of record in the journal.
+		/// </summary>
+		enum class RecordType : std::uint32_t
+		{
+			Type,
+			Enqueue,
+			Update
+		};
+
+		/// <summary>
+		/// Type definition for a function serializing an Event message.
+		/// </summary>
+		/// <typeparam name="MessageT">Message type of the Event.</typeparam>
+		template<typename MessageT>
+		using Writer = std::function<void(OutputStreamHelper&, const MessageT&)>;
+
+	private:
+		/// <summary>
+		/// Registered Event type.
+		/// </summary>
+		struct TypeEntry final
+		{
+			std::uint32_t Index;
+			std::function<void(OutputStreamHelper&, const EventPublisher&)> Write;
+		};
+
+		/// <summary>
+		/// Stream buffer appending to a reusable string, so records are serialized without allocating once it has grown.
+		/// </summary>
+		class RecordBuffer final : public std::streambuf
+		{
+		public:
+			std::string Bytes;
+			std::ostream Stream{ this };
+
+		protected:
+			virtual int_type overflow(int_type character) override;
+			virtual std::streamsize xsputn(const char* characters, std::streamsize count) override;
+		};
+#pragma endregion Type Definitions, Constants
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Constructor, writing the journal header and starting the writer thread.
+		/// </summary>
+		/// <param name="stream">Binary stream receiving the journal, which must outlive the EventJournal.</param>
+		/// <param name="ringCapacity">Size of the ring buffer in bytes, rounded up to a power of two.</param>
+		explicit EventJournal(std::ostream& stream, const std::size_t ringCapacity=DefaultRingCapacity);
+
+		/// <summary>
+		/// Destructor, writing every record still buffered before stopping the writer thread.
+		/// </summary>
+		~EventJournal();
+
+		/// <summary>
+		/// Deleted copy constructor.
+		/// </summary>
+		EventJournal(const EventJournal&) = delete;
+
+		/// <summary>
+		/// Deleted copy assignment operator.
+		/// </summary>
+		EventJournal& operator=(const EventJournal&) = delete;
+
+		/// <summary>
+		/// Deleted move constructor.
+		/// </summary>
+		EventJournal(EventJournal&&) = delete;
+
+		/// <summary>
+		/// Deleted move assignment operator.
+		/// </summary>
+		EventJournal& operator=(EventJournal&&) = delete;
+#pragma endregion Special Members
+
+#pragma region Registration
+	public:
+		/// <summary>
+		/// Registers an Event type to be journaled. Must be called before recording starts.
+		/// </summary>
+		/// <typeparam name="MessageT">Message type of the Event.</typeparam>
+		/// <param name="name">Name identifying the Event type across sessions.</param>
+		/// <param name="write">Function serializing a message.</param>
+		/// <exception cref="std::runtime_error">Event type already registered.</exception>
+		template<typename MessageT>
+		void Register(const std::string& name, Writer<MessageT> write);
+#pragma endregion Registration
+
+#pragma region Recording
+	public:
+		/// <summary>
+		/// Records an Event being enqueued. Events of unregistered types are only counted.
+		/// Safe to call from any number of threads.
+		/// </summary>
+		/// <param name="event">Event being enqueued.</param>
+		/// <param name="expireTime">TimePoint when the Event expires.</param>
+		void RecordEnqueue(const EventPublisher& event, const std::chrono::high_resolution_clock::time_point& expireTime);
+
+		/// <summary>
+		/// Records an EventQueue Update, along with the GameTime it updated to.
+		/// </summary>
+		/// <param name="gameTime">GameTime passed to Update.</param>
+		void RecordUpdate(const GameTime& gameTime);
+
+		/// <summary>
+		/// Blocks until every record so far has been written and flushes the stream.
+		/// </summary>
+		/// <exception cref="std::runtime_error">The stream failed.</exception>
+		void Flush();
+#pragma endregion Recording
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the number of Event instances recorded.
+		/// </summary>
+		/// <returns>Number of Event instances recorded.</returns>
+		std::size_t EnqueueCount() const;
+
+		/// <summary>
+		/// Gets the number of Event instances not recorded because their type is not registered.
+		/// </summary>
+		/// <returns>Number of Event instances not recorded.</returns>
+		std::size_t UnregisteredCount() const;
+
+		/// <summary>
+		/// Gets the number of records that did not fit in the ring buffer.
+		/// </summary>
+		/// <returns>Number of records written through the overflow buffer.</returns>
+		std::size_t OverflowCount() const;
+#pragma endregion Accessors
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Registers an Event type, writing its type record.
+		/// </summary>
+		/// <param name="typeId">RTTI type identifier of the Event type.</param>
+		/// <param name="name">Name identifying the Event type across sessions.</param>
+		/// <param name="write">Function serializing an Event of the type.</param>
+		void Register(const RTTI::IdType typeId, const std::string& name, std::function<void(OutputStreamHelper&, const EventPublisher&)> write);
+
+		/// <summary>
+		/// Gets the record buffer of the calling thread, cleared.
+		/// Records are serialized into it before being appended, so the mutex is only held to copy them.
+		/// </summary>
+		/// <returns>Record buffer of the calling thread.</returns>
+		static RecordBuffer& LocalBuffer();
+
+		/// <summary>
+		/// Appends a serialized record to the ring buffer, or the overflow buffer if the ring is full, and wakes the writer thread.
+		/// </summary>
+		/// <param name="record">Serialized record.</param>
+		void Append(const std::string& record);
+
+		/// <summary>
+		/// Body of the writer thread.
+		/// </summary>
+		void WriterLoop();
+#pragma endregion Helper Methods
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Binary stream receiving the journal.
+		/// </summary>
+		std::ostream& mStream;
+
+		/// <summary>
+		/// Registered Event types, by RTTI type identifier.
+		/// </summary>
+		FlatHashMap<RTTI::IdType, TypeEntry> mTypes;
+
+		/// <summary>
+		/// Ring buffer of serialized records waiting to be written.
+		/// </summary>
+		std::unique_ptr<char[]> mRing;
+
+		/// <summary>
+		/// Mask wrapping positions into the ring buffer.
+		/// </summary>
+		std::size_t mRingMask;
+
+		/// <summary>
+		/// Number of bytes ever appended to the ring, so the next byte goes at this position, guarded by the mutex.
+		/// </summary>
+		std::size_t mRingHead{ 0 };
+
+		/// <summary>
+		/// Number of bytes ever written from the ring, advanced by the writer thread, guarded by the mutex.
+		/// </summary>
+		std::size_t mRingTail{ 0 };
+
+		/// <summary>
+		/// Records appended while the ring was full, written once the ring is drained, guarded by the mutex.
+		/// </summary>
+		std::string mOverflow;
+
+		/// <summary>
+		/// Overflow records taken by the writer thread.
+		/// </summary>
+		std::string mWriting;
+
+		/// <summary>
+		/// Number of bytes appended, guarded by the mutex.
+		/// </summary>
+		std::size_t mAppendedBytes{ 0 };
+
+		/// <summary>
+		/// Number of bytes written to the stream, guarded by the mutex.
+		/// </summary>
+		std::size_t mWrittenBytes{ 0 };
+
+		/// <summary>
+		/// Number of Event instances recorded.
+		/// </summary>
+		std::atomic<std::size_t> mEnqueueCount{ 0 };
+
+		/// <summary>
+		/// Number of Event instances not recorded because their type is not registered.
+		/// </summary>
+		std::atomic<std::size_t> mUnregisteredCount{ 0 };
+
+		/// <summary>
+		/// Number of records appended to the overflow buffer, guarded by the mutex.
+		/// </summary>
+		std::size_t mOverflowCount{ 0 };
+
+		/// <summary>
+		/// Represents whether the writer thread should keep running, guarded by the mutex.
+		/// </summary>
+		bool mIsRunning{ true };
+
+		/// <summary>
+		/// Represents whether the stream failed, guarded by the mutex.
+		/// </summary>
+		bool mHasFailed{ false };
+
+		/// <summary>
+		/// Mutex guarding appends and the positions shared with the writer thread, held only to copy bytes, never while writing.
+		/// </summary>
+		mutable std::mutex mMutex;
+
+		/// <summary>
+		/// Wakes the writer thread when records are appended.
+		/// </summary>
+		std::condition_variable mWakeCondition;
+
+		/// <summary>
+		/// Wakes Flush when records are written.
+		/// </summary>
+		std::condition_variable mWrittenCondition;
+
+		/// <summary>
+		/// Background thread writing records to the stream.
+		/// </summary>
+		std::thread mWriter;
+#pragma endregion Data Members
+	};
+}
+
+// Inline File
+#include "EventJournal.inl"
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+// Header
+#include "EventJournal.h"
+
+namespace Library
+{
+#pragma region Registration
+	template<typename MessageT>
+	inline void EventJournal::Register(const std::string& name, Writer<MessageT> write)
+	{
+		Register(Event<MessageT>::TypeIdClass(), name, [write = std::move(write)](OutputStreamHelper& helper, const EventPublisher& event)
+		{
+			write(helper, static_cast<const Event<MessageT>&>(event).Message);
+		});
+	}
+#pragma endregion Registration
+
+#pragma region Accessors
+	inline std::size_t EventJournal::EnqueueCount() const
+	{
+		return mEnqueueCount.load(std::memory_order_relaxed);
+	}
+
+	inline std::size_t EventJournal::UnregisteredCount() const
+	{
+		return mUnregisteredCount.load(std::memory_order_relaxed);
+	}
+
+	inline std::size_t EventJournal::OverflowCount() const
+	{
+		std::scoped_lock<std::mutex> lock(mMutex);
+		return mOverflowCount;
+	}
+#pragma endregion Accessors
+}
\ No newline at end of file
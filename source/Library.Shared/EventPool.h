@@ -0,0 +1,181 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <memory>
+#include <mutex>
+
+// First Party
+#include "Event.h"
+#include "Vector.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Recycles Event instances of a message type, so firing an Event in steady state performs no heap allocations.
+	/// Released Event instances keep their message, so its storage is reused by the next Acquire,
+	/// and the shared_ptr control blocks are recycled along with them.
+	/// Copies of an EventPool share the same pool.
+	/// </summary>
+	/// <typeparam name="MessageT">Data type contained by the pooled Event instances.</typeparam>
+	template<typename MessageT>
+	class EventPool final
+	{
+#pragma region Type Definitions
+	public:
+		/// <summary>
+		/// Shared pointer to a pooled Event, returned to the pool once the last reference is released.
+		/// </summary>
+		using EventPointer = std::shared_ptr<Event<MessageT>>;
+
+	private:
+		/// <summary>
+		/// Pool storage, kept alive by the EventPool and by every outstanding Event.
+		/// </summary>
+		struct State final
+		{
+			/// <summary>
+			/// Destructor.
+			/// Frees the idle Event instances and control blocks.
+			/// </summary>
+			~State();
+
+			/// <summary>
+			/// Mutex guarding the idle lists, since Event instances may be released from any thread.
+			/// </summary>
+			std::mutex Mutex;
+
+			/// <summary>
+			/// Released Event instances ready to be reused.
+			/// </summary>
+			Vector<Event<MessageT>*> IdleEvents;
+
+			/// <summary>
+			/// Released shared_ptr control blocks ready to be reused.
+			/// </summary>
+			Vector<void*> IdleBlocks;
+
+			/// <summary>
+			/// Size in bytes of the control blocks, set by the first one allocated.
+			/// </summary>
+			std::size_t BlockSize{ 0 };
+		};
+
+		/// <summary>
+		/// Deleter returning an Event to the pool instead of destroying it.
+		/// </summary>
+		struct Recycler final
+		{
+			/// <summary>
+			/// Adds the Event to the idle list of the pool.
+			/// </summary>
+			/// <param name="event">Event released by its last shared_ptr.</param>
+			void operator()(Event<MessageT>* event) const;
+
+			std::shared_ptr<State> PoolState;
+		};
+
+		/// <summary>
+		/// Allocator recycling the shared_ptr control blocks of pooled Event instances.
+		/// </summary>
+		/// <typeparam name="T">Type allocated, rebound by std::shared_ptr to its control block.</typeparam>
+		template<typename T>
+		struct BlockAllocator final
+		{
+			using value_type = T;
+
+			explicit BlockAllocator(std::shared_ptr<State> poolState);
+
+			template<typename U>
+			BlockAllocator(const BlockAllocator<U>& rhs);
+
+			/// <summary>
+			/// Takes an idle control block from the pool, or allocates one if none is idle.
+			/// </summary>
+			/// <param name="count">Number of T instances to allocate memory for.</param>
+			/// <returns>Pointer to uninitialized memory for the given number of T instances.</returns>
+			T* allocate(const std::size_t count);
+
+			/// <summary>
+			/// Returns a control block to the pool, or frees memory of any other size.
+			/// </summary>
+			/// <param name="pointer">Pointer to memory returned by allocate.</param>
+			/// <param name="count">Number of T instances the memory was allocated for.</param>
+			void deallocate(T* pointer, const std::size_t count);
+
+			template<typename U>
+			bool operator==(const BlockAllocator<U>& rhs) const;
+
+			template<typename U>
+			bool operator!=(const BlockAllocator<U>& rhs) const;
+
+			std::shared_ptr<State> PoolState;
+		};
+#pragma endregion Type Definitions
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Default constructor.
+		/// </summary>
+		EventPool();
+
+		/// <summary>
+		/// Default destructor.
+		/// Idle Event instances are freed once no outstanding Event refers to the pool.
+		/// </summary>
+		~EventPool() = default;
+
+		/// <summary>
+		/// Copy constructor, sharing the pool of the given EventPool.
+		/// Also used for rvalues, so an EventPool always refers to a pool.
+		/// </summary>
+		/// <param name="rhs">EventPool to be shared.</param>
+		EventPool(const EventPool& rhs) = default;
+
+		/// <summary>
+		/// Copy assignment operator, sharing the pool of the given EventPool.
+		/// </summary>
+		/// <param name="rhs">EventPool to be shared.</param>
+		/// <returns>Reference to the modified EventPool.</returns>
+		EventPool& operator=(const EventPool& rhs) = default;
+#pragma endregion Special Members
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the number of released Event instances ready to be reused.
+		/// </summary>
+		/// <returns>Number of idle Event instances.</returns>
+		std::size_t IdleCount() const;
+#pragma endregion Accessors
+
+#pragma region Modifiers
+	public:
+		/// <summary>
+		/// Takes an idle Event from the pool, or creates one if none is idle, then lets the caller rewrite its message.
+		/// </summary>
+		/// <param name="initializer">Functor taking a MessageT reference, holding the message of the last use of the Event, if any.</param>
+		/// <returns>Shared pointer to the Event, returning it to the pool once released.</returns>
+		template<typename Initializer>
+		EventPointer Acquire(Initializer&& initializer);
+
+		/// <summary>
+		/// Frees every idle Event and control block.
+		/// </summary>
+		void Clear();
+#pragma endregion Modifiers
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Shared pool storage.
+		/// </summary>
+		std::shared_ptr<State> mState;
+#pragma endregion Data Members
+	};
+}
+
+// Inline File
+#include "EventPool.inl"
\ No newline at end of file
@@ -0,0 +1,191 @@
+#pragma once
+
+// Header
+#include "EventPool.h"
+
+namespace Library
+{
+#pragma region State
+	template<typename MessageT>
+	inline EventPool<MessageT>::State::~State()
+	{
+		for (Event<MessageT>* event : IdleEvents)
+		{
+			delete event;
+		}
+
+		for (void* block : IdleBlocks)
+		{
+			::operator delete(block);
+		}
+	}
+#pragma endregion State
+
+#pragma region Recycler
+	template<typename MessageT>
+	inline void EventPool<MessageT>::Recycler::operator()(Event<MessageT>* event) const
+	{
+		try
+		{
+			std::scoped_lock<std::mutex> lock(PoolState->Mutex);
+			PoolState->IdleEvents.EmplaceBack(event);
+		}
+		catch (...)
+		{
+			delete event;
+		}
+	}
+#pragma endregion Recycler
+
+#pragma region Block Allocator
+	template<typename MessageT>
+	template<typename T>
+	inline EventPool<MessageT>::BlockAllocator<T>::BlockAllocator(std::shared_ptr<State> poolState) :
+		PoolState(std::move(poolState))
+	{
+	}
+
+	template<typename MessageT>
+	template<typename T>
+	template<typename U>
+	inline EventPool<MessageT>::BlockAllocator<T>::BlockAllocator(const BlockAllocator<U>& rhs) :
+		PoolState(rhs.PoolState)
+	{
+	}
+
+	template<typename MessageT>
+	template<typename T>
+	inline T* EventPool<MessageT>::BlockAllocator<T>::allocate(const std::size_t count)
+	{
+		const std::size_t size = count * sizeof(T);
+
+		{
+			std::scoped_lock<std::mutex> lock(PoolState->Mutex);
+
+			if (PoolState->BlockSize == 0)
+			{
+				PoolState->BlockSize = size;
+			}
+			else if (PoolState->BlockSize == size && !PoolState->IdleBlocks.IsEmpty())
+			{
+				void* block = PoolState->IdleBlocks.Back();
+				PoolState->IdleBlocks.PopBack();
+				return static_cast<T*>(block);
+			}
+		}
+
+		return static_cast<T*>(::operator new(size));
+	}
+
+	template<typename MessageT>
+	template<typename T>
+	inline void EventPool<MessageT>::BlockAllocator<T>::deallocate(T* pointer, const std::size_t count)
+	{
+		try
+		{
+			std::scoped_lock<std::mutex> lock(PoolState->Mutex);
+
+			if (PoolState->BlockSize == count * sizeof(T))
+			{
+				PoolState->IdleBlocks.EmplaceBack(pointer);
+				return;
+			}
+		}
+		catch (...)
+		{
+		}
+
+		::operator delete(pointer);
+	}
+
+	template<typename MessageT>
+	template<typename T>
+	template<typename U>
+	inline bool EventPool<MessageT>::BlockAllocator<T>::operator==(const BlockAllocator<U>& rhs) const
+	{
+		return PoolState == rhs.PoolState;
+	}
+
+	template<typename MessageT>
+	template<typename T>
+	template<typename U>
+	inline bool EventPool<MessageT>::BlockAllocator<T>::operator!=(const BlockAllocator<U>& rhs) const
+	{
+		return !(operator==(rhs));
+	}
+#pragma endregion Block Allocator
+
+#pragma region Special Members
+	template<typename MessageT>
+	inline EventPool<MessageT>::EventPool() :
+		mState(std::make_shared<State>())
+	{
+	}
+#pragma endregion Special Members
+
+#pragma region Accessors
+	template<typename MessageT>
+	inline std::size_t EventPool<MessageT>::IdleCount() const
+	{
+		std::scoped_lock<std::mutex> lock(mState->Mutex);
+		return mState->IdleEvents.Size();
+	}
+#pragma endregion Accessors
+
+#pragma region Modifiers
+	template<typename MessageT>
+	template<typename Initializer>
+	inline typename EventPool<MessageT>::EventPointer EventPool<MessageT>::Acquire(Initializer&& initializer)
+	{
+		Event<MessageT>* event = nullptr;
+
+		{
+			std::scoped_lock<std::mutex> lock(mState->Mutex);
+
+			if (!mState->IdleEvents.IsEmpty())
+			{
+				event = mState->IdleEvents.Back();
+				mState->IdleEvents.PopBack();
+			}
+		}
+
+		if (!event)
+		{
+			event = new Event<MessageT>();
+		}
+
+		try
+		{
+			initializer(event->mMessage);
+		}
+		catch (...)
+		{
+			Recycler{ mState }(event);
+			throw;
+		}
+
+		return EventPointer(event, Recycler{ mState }, BlockAllocator<Event<MessageT>>(mState));
+	}
+
+	template<typename MessageT>
+	inline void EventPool<MessageT>::Clear()
+	{
+		std::scoped_lock<std::mutex> lock(mState->Mutex);
+
+		for (Event<MessageT>* event : mState->IdleEvents)
+		{
+			delete event;
+		}
+
+		for (void* block : mState->IdleBlocks)
+		{
+			::operator delete(block);
+		}
+
+		mState->IdleEvents.Clear();
+		mState->IdleEvents.ShrinkToFit();
+		mState->IdleBlocks.Clear();
+		mState->IdleBlocks.ShrinkToFit();
+	}
+#pragma endregion Modifiers
+}
\ No newline at end of file
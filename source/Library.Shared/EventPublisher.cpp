@@ -5,12 +5,13 @@
 // Header
 #include "EventPublisher.h"
 
-// Standard
-#include <future>
-
 // First Party
 #include "IEventSubscriber.h"
 #include "Utility.h"
+
+#ifdef EVENT_INSTRUMENTATION
+#include "EventInstrumentation.h"
+#endif
 #pragma endregion Includes
 
 using namespace std::string_literals;
@@ -19,19 +20,58 @@ namespace Library
 {
 	void EventPublisher::Publish()
 	{
-		assert(mSubscriberList);
-		if (!mSubscriberList) return;
+		assert(mSubscribers);
 		
-		SubscriberList subscribers;
-		{
-			std::scoped_lock<std::mutex> lock(*mMutex);
-			subscribers = *mSubscriberList;
-		}
+		const SubscriberSnapshot subscribers = Subscribers();
+		if (!subscribers) return;
 		
-		for (auto* subscriber : subscribers)
+		for (auto* subscriber : *subscribers)
 		{
 			assert(subscriber);
-			subscriber->Notify(*this);
+			NotifySubscriber(*subscriber);
+		}
+	}
+
+	void EventPublisher::Deliver(const SubscriberList& subscribers, const std::size_t begin, const std::size_t end, ExceptionList& exceptions, std::mutex& exceptionsMutex)
+	{
+		for (std::size_t i = begin; i < end; ++i)
+		{
+			assert(subscribers[i]);
+
+			try
+			{
+				NotifySubscriber(*subscribers[i]);
+			}
+			catch (...)
+			{
+				std::scoped_lock<std::mutex> lock(exceptionsMutex);
+				exceptions.EmplaceBack(Exception::AggregateException::Entry{ std::current_exception(), __FILE__, __LINE__, __func__, ToString() });
+			}
 		}
 	}
+
+	void EventPublisher::NotifySubscriber(IEventSubscriber& subscriber)
+	{
+#ifdef EVENT_INSTRUMENTATION
+		if (EventInstrumentation::IsEnabled())
+		{
+			const EventInstrumentation::TimePoint start = EventInstrumentation::Clock::now();
+
+			try
+			{
+				subscriber.Notify(*this);
+			}
+			catch (...)
+			{
+				EventInstrumentation::RecordNotify(TypeIdInstance(), start, EventInstrumentation::Clock::now());
+				throw;
+			}
+
+			EventInstrumentation::RecordNotify(TypeIdInstance(), start, EventInstrumentation::Clock::now());
+			return;
+		}
+#endif
+
+		subscriber.Notify(*this);
+	}
 }
\ No newline at end of file
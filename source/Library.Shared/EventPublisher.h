@@ -2,11 +2,14 @@
 
 #pragma region Includes
 // Standard
+#include <atomic>
+#include <memory>
 #include <mutex>
 
 // First Party
 #include "RTTI.h"
 #include "Vector.h"
+#include "Utility.h"
 #pragma endregion Includes
 
 namespace Library
@@ -30,6 +33,17 @@ namespace Library
 		/// List of subscribers to an Event subclass.
 		/// </summary>
 		using SubscriberList = Vector<IEventSubscriber*>;
+
+		/// <summary>
+		/// Immutable, shared snapshot of a SubscriberList.
+		/// Replaced as a whole whenever the subscribers of an Event subclass change.
+		/// </summary>
+		using SubscriberSnapshot = std::shared_ptr<const SubscriberList>;
+
+		/// <summary>
+		/// List of exceptions thrown by subscribers during delivery.
+		/// </summary>
+		using ExceptionList = Vector<Exception::AggregateException::Entry>;
 #pragma endregion Type Definitions
 
 #pragma region Special Members
@@ -66,12 +80,12 @@ namespace Library
 
 	protected:
 		/// <summary>
-		/// Specialized constructor used to initialize a SubscriberList reference.
+		/// Specialized constructor used to initialize a SubscriberSnapshot reference.
 		/// Meant to be called from within the Event subclass constructor.
 		/// </summary>
-		/// <param name="subscribers">Reference to a list of subscribers.</param>
-		/// <param name="mutex">Reference to the underlying subclass instance mutex member.</param>
-		explicit EventPublisher(SubscriberList& subscribers, std::mutex& mutex);
+		/// <param name="subscribers">Reference to the current snapshot of subscribers of the Event type.</param>
+		/// <param name="isOrdered">Reference to the flag forcing ordered, serial delivery of the Event type.</param>
+		explicit EventPublisher(const SubscriberSnapshot& subscribers, const std::atomic<bool>& isOrdered);
 #pragma endregion Special Members
 
 #pragma region Event Publishing
@@ -81,6 +95,36 @@ namespace Library
 		/// Calls Notify on each IEventSubscriber in the SubscriberList for this Event type.
 		/// </summary>
 		void Publish();
+
+		/// <summary>
+		/// Atomically loads the current snapshot of subscribers for this Event type.
+		/// The snapshot stays valid while held, even if subscribers change during delivery.
+		/// </summary>
+		/// <returns>Current SubscriberSnapshot, or null if there are no subscribers.</returns>
+		SubscriberSnapshot Subscribers() const;
+
+		/// <summary>
+		/// Checks if the Event type requires ordered, serial delivery on the publishing thread.
+		/// </summary>
+		/// <returns>True if delivery must be ordered and serial, otherwise false.</returns>
+		bool IsOrderedDelivery() const;
+
+		/// <summary>
+		/// Calls Notify on a range of subscribers, recording any exception thrown instead of propagating it.
+		/// Safe to call for disjoint ranges from multiple threads.
+		/// </summary>
+		/// <param name="subscribers">Snapshot of the SubscriberList.</param>
+		/// <param name="begin">Index of the first subscriber to be notified.</param>
+		/// <param name="end">Index one past the last subscriber to be notified.</param>
+		/// <param name="exceptions">List receiving the exceptions thrown by subscribers.</param>
+		/// <param name="exceptionsMutex">Mutex guarding the exception list.</param>
+		void Deliver(const SubscriberList& subscribers, const std::size_t begin, const std::size_t end, ExceptionList& exceptions, std::mutex& exceptionsMutex);
+
+		/// <summary>
+		/// Calls Notify on a subscriber, timing the call when EventInstrumentation is enabled.
+		/// </summary>
+		/// <param name="subscriber">IEventSubscriber to be notified.</param>
+		void NotifySubscriber(IEventSubscriber& subscriber);
 #pragma endregion Event Publishing
 
 #pragma region RTTI Overrides
@@ -95,15 +139,15 @@ namespace Library
 #pragma region Data Members
 	private:
 		/// <summary>
-		/// Pointer to a static list of IEventSubscriber instances subscribed to the Event type
-		/// of the underlying Event instance for the underlying Event instance.
+		/// Pointer to the static snapshot of IEventSubscriber instances subscribed to the Event type
+		/// of the underlying Event instance.
 		/// </summary>
-		SubscriberList* mSubscriberList;
+		const SubscriberSnapshot* mSubscribers;
 
 		/// <summary>
-		/// Pointer to the mutex of the underlying Event instance. 
+		/// Pointer to the flag of the underlying Event type forcing ordered, serial delivery.
 		/// </summary>
-		std::mutex* mMutex;
+		const std::atomic<bool>* mIsOrdered;
 #pragma endregion Data Members
 	};
 }
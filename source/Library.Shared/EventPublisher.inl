@@ -6,28 +6,38 @@
 namespace Library
 {
 	inline EventPublisher::EventPublisher(EventPublisher&& rhs) noexcept :
-		mSubscriberList(rhs.mSubscriberList), mMutex(rhs.mMutex)
+		mSubscribers(rhs.mSubscribers), mIsOrdered(rhs.mIsOrdered)
 	{
-		rhs.mSubscriberList = nullptr;
-		rhs.mMutex = nullptr;
+		rhs.mSubscribers = nullptr;
+		rhs.mIsOrdered = nullptr;
 	}
 
 	inline EventPublisher& EventPublisher::operator=(EventPublisher&& rhs) noexcept
 	{
-		mSubscriberList = rhs.mSubscriberList;
-		mMutex = rhs.mMutex;
+		mSubscribers = rhs.mSubscribers;
+		mIsOrdered = rhs.mIsOrdered;
 		
-		rhs.mSubscriberList = nullptr;
-		rhs.mMutex = nullptr;
+		rhs.mSubscribers = nullptr;
+		rhs.mIsOrdered = nullptr;
 		
 		return *this;
 	}
 
-	inline EventPublisher::EventPublisher(SubscriberList& subscribers, std::mutex& mutex) :
-		mSubscriberList(&subscribers), mMutex(&mutex)
+	inline EventPublisher::EventPublisher(const SubscriberSnapshot& subscribers, const std::atomic<bool>& isOrdered) :
+		mSubscribers(&subscribers), mIsOrdered(&isOrdered)
 	{
 	}
 
+	inline EventPublisher::SubscriberSnapshot EventPublisher::Subscribers() const
+	{
+		return mSubscribers ? std::atomic_load(mSubscribers) : SubscriberSnapshot();
+	}
+
+	inline bool EventPublisher::IsOrderedDelivery() const
+	{
+		return mIsOrdered && mIsOrdered->load(std::memory_order_relaxed);
+	}
+
 	inline std::string EventPublisher::ToString() const
 	{
 		return "EventPublisher";
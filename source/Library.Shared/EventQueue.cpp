@@ -5,49 +5,185 @@
 // Header
 #include "EventQueue.h"
 
-// Standard
-#include <algorithm>
-#include <future>
-
 // First Party
 #include "EventPublisher.h"
+#include "EventJournal.h"
+#include "JobSystem.h"
+#include "StackAllocator.h"
 #pragma endregion Includes
 
 using namespace std::string_literals;
 
 namespace Library
 {
+	EventQueue::EventQueue(const std::size_t stagingCapacity)
+	{
+		std::size_t capacity = 2;
+
+		while (capacity < stagingCapacity)
+		{
+			capacity <<= 1;
+		}
+
+		mStaging = std::make_unique<StagingSlot[]>(capacity);
+		mStagingMask = capacity - 1;
+
+		for (std::size_t i = 0; i < capacity; ++i)
+		{
+			mStaging[i].Sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	EventQueue::~EventQueue()
+	{
+		Clear();
+	}
+
 	void EventQueue::Publish(EventPublisher& event)
 	{
+#ifdef EVENT_INSTRUMENTATION
+		if (EventInstrumentation::IsEnabled())
+		{
+			EventInstrumentation::RecordPublish(event.TypeIdInstance(), TimePoint(), EventInstrumentation::Clock::now());
+		}
+#endif
+
 		event.Publish();
 	}
 
 	void EventQueue::Update(const GameTime& gameTime)
 	{
-		for (EventEntry& entry : mQueue)
+		if (mJournal) mJournal->RecordUpdate(gameTime);
+
+		std::unique_lock<std::mutex> lock(mMutex);
+
+		DrainPending();
+
+		Vector<EventEntry> expiredEvents(std::move(mExpiredEvents));
+
+		while (!mQueue.IsEmpty() && gameTime.CurrentTime() >= mQueue.Front().ExpireTime)
+		{
+			std::pop_heap(mQueue.begin(), mQueue.end(), ExpiresLater);
+
+			assert(mQueue.Back().Publisher);
+			expiredEvents.EmplaceBack(std::move(mQueue.Back()));
+			mQueue.PopBack();
+		}
+
+		mSize.fetch_sub(expiredEvents.Size(), std::memory_order_relaxed);
+		lock.unlock();
+
+#ifdef EVENT_INSTRUMENTATION
+		if (EventInstrumentation::IsEnabled())
+		{
+			const TimePoint publishTime = EventInstrumentation::Clock::now();
+
+			for (const auto& event : expiredEvents)
+			{
+				EventInstrumentation::RecordPublish(event.Publisher->TypeIdInstance(), event.EnqueueTime, publishTime);
+			}
+		}
+#endif
+
+		if (mJobSystem)
 		{
-			if (gameTime.CurrentTime() >= entry.ExpireTime)
+			PublishParallel(expiredEvents);
+		}
+		else
+		{
+			for (const auto& event : expiredEvents)
 			{
-				assert(entry.Publisher);
-				entry.IsExpired = true;
+				event.Publisher->Publish();
 			}
 		}
 
-		auto isExpired = [&gameTime](const EventEntry& eventEntry) 
-		{ 
-			return !eventEntry.IsExpired; 
-		};
+		expiredEvents.Clear();
+		lock.lock();
+
+		if (mExpiredEvents.Capacity() < expiredEvents.Capacity())
+		{
+			mExpiredEvents = std::move(expiredEvents);
+		}
+	}
+
+	void EventQueue::RecordEnqueue(const EventPublisher& eventPublisher, const TimePoint& expireTime)
+	{
+		mJournal->RecordEnqueue(eventPublisher, expireTime);
+	}
+
+	void EventQueue::DrainPending()
+	{
+		while (true)
+		{
+			StagingSlot& slot = mStaging[mStagingTail & mStagingMask];
+			if (slot.Sequence.load(std::memory_order_acquire) != mStagingTail + 1) break;
+
+			mQueue.EmplaceBack(std::move(slot.Entry));
+			std::push_heap(mQueue.begin(), mQueue.end(), ExpiresLater);
+
+			slot.Sequence.store(mStagingTail + mStagingMask + 1, std::memory_order_release);
+			++mStagingTail;
+		}
+
+		PendingEntry* entry = mPending.exchange(nullptr, std::memory_order_acquire);
 
-		const auto eventPartition = std::partition(mQueue.begin(), mQueue.end(), isExpired);
+		while (entry)
+		{
+			mQueue.EmplaceBack(std::move(entry->Entry));
+			std::push_heap(mQueue.begin(), mQueue.end(), ExpiresLater);
 
-		Vector expiredEvents(Vector<EventEntry>::EqualityFunctor{});
-		expiredEvents.Insert(expiredEvents.begin(), eventPartition, mQueue.cend());
+			PendingEntry* next = entry->Next;
+			delete entry;
+			entry = next;
+		}
+	}
+
+	void EventQueue::PublishParallel(const Vector<EventEntry>& expiredEvents)
+	{
+		Vector<EventPublisher::SubscriberSnapshot> snapshots(StackAllocator::ThreadLocal(), expiredEvents.Size(), Vector<EventPublisher::SubscriberSnapshot>::EqualityFunctor{});
 
-		mQueue.Erase(eventPartition);
-		
 		for (const auto& event : expiredEvents)
 		{
-			event.Publisher->Publish();
+			snapshots.EmplaceBack(event.Publisher->Subscribers());
+		}
+
+		EventPublisher::ExceptionList exceptions{ EventPublisher::ExceptionList::EqualityFunctor() };
+		std::mutex exceptionsMutex;
+		JobSystem::Counter counter;
+
+		for (std::size_t i = 0; i < expiredEvents.Size(); ++i)
+		{
+			EventPublisher& publisher = *expiredEvents[i].Publisher;
+			if (publisher.IsOrderedDelivery() || !snapshots[i]) continue;
+
+			const EventPublisher::SubscriberList& subscribers = *snapshots[i];
+
+			for (std::size_t begin = 0; begin < subscribers.Size(); begin += DeliveryBatchSize)
+			{
+				const std::size_t end = std::min(begin + DeliveryBatchSize, subscribers.Size());
+
+				mJobSystem->Schedule([&publisher, &subscribers, begin, end, &exceptions, &exceptionsMutex]
+				{
+					publisher.Deliver(subscribers, begin, end, exceptions, exceptionsMutex);
+				}, counter);
+			}
+		}
+
+		for (std::size_t i = 0; i < expiredEvents.Size(); ++i)
+		{
+			EventPublisher& publisher = *expiredEvents[i].Publisher;
+
+			if (publisher.IsOrderedDelivery() && snapshots[i])
+			{
+				publisher.Deliver(*snapshots[i], 0, snapshots[i]->Size(), exceptions, exceptionsMutex);
+			}
+		}
+
+		mJobSystem->Wait(counter);
+
+		if (!exceptions.IsEmpty())
+		{
+			throw Exception::AggregateException(std::move(exceptions));
 		}
 	}
 }
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #pragma region Includes
 // Standard
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <mutex>
@@ -9,25 +11,47 @@
 // First Party
 #include "Vector.h"
 #include "GameTime.h"
+
+#ifdef EVENT_INSTRUMENTATION
+#include "EventPublisher.h"
+#include "EventInstrumentation.h"
+#endif
 #pragma endregion Includes
 
 namespace Library
 {
 	// Forward Declarations
 	class EventPublisher;
+	class EventJournal;
+	class JobSystem;
 
 	/// <summary>
 	/// Queued list of Event instances that need to be published to their EventSubscriber list.
+	/// Entries are kept in a binary min-heap on their expire time, so Update only touches the Event instances that expire.
+	/// Enqueue is lock-free, claiming a slot of a fixed staging ring, or pushing onto an overflow list once the ring is full.
+	/// Update drains both into the heap once per frame, so steady-state Enqueue performs no heap allocations.
+	/// With a JobSystem set, expired Event instances are delivered to their subscribers in parallel.
 	/// </summary>
 	class EventQueue final 
 	{
 #pragma region Type Definitions, Constants
+	public:
+		/// <summary>
+		/// Default number of slots in the staging ring.
+		/// </summary>
+		static constexpr std::size_t DefaultStagingCapacity{ 1024 };
+
 	private:
 		/// <summary>
 		/// Type definition for a point in time.
 		/// </summary>
 		using TimePoint = std::chrono::high_resolution_clock::time_point;
 
+		/// <summary>
+		/// Number of subscribers notified by each job during parallel delivery.
+		/// </summary>
+		static constexpr std::size_t DeliveryBatchSize{ 64 };
+
 		/// <summary>
 		/// Type definition for a duration of time.
 		/// </summary>
@@ -92,14 +116,68 @@ namespace Library
 			TimePoint ExpireTime;
 
 			/// <summary>
-			/// Represents whether the Event has been published.
+			/// Time point at which the Event was enqueued, if recorded by EventInstrumentation.
+			/// Present whether or not EVENT_INSTRUMENTATION is defined, so every project sees the same layout.
 			/// </summary>
-			bool IsExpired{ false };
+			TimePoint EnqueueTime;
 #pragma endregion Data Members
 
 		};
+
+		/// <summary>
+		/// EventEntry staged by Enqueue, linked into a lock-free list until the next Update.
+		/// </summary>
+		struct PendingEntry final
+		{
+			EventEntry Entry;
+			PendingEntry* Next;
+		};
+
+		/// <summary>
+		/// Slot of the staging ring, stamped with a sequence number telling producers and Update whose turn it is.
+		/// </summary>
+		struct StagingSlot final
+		{
+			std::atomic<std::size_t> Sequence;
+			EventEntry Entry;
+		};
 #pragma endregion Type Definitions, Constants
 
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Default constructor.
+		/// </summary>
+		/// <param name="stagingCapacity">Number of slots in the staging ring, rounded up to a power of two.</param>
+		explicit EventQueue(const std::size_t stagingCapacity=DefaultStagingCapacity);
+
+		/// <summary>
+		/// Destructor.
+		/// Frees any EventEntry instances still staged.
+		/// </summary>
+		~EventQueue();
+
+		/// <summary>
+		/// Deleted copy constructor.
+		/// </summary>
+		EventQueue(const EventQueue& rhs) = delete;
+
+		/// <summary>
+		/// Deleted copy assignment operator.
+		/// </summary>
+		EventQueue& operator=(const EventQueue& rhs) = delete;
+
+		/// <summary>
+		/// Deleted move constructor.
+		/// </summary>
+		EventQueue(EventQueue&& rhs) = delete;
+
+		/// <summary>
+		/// Deleted move assignment operator.
+		/// </summary>
+		EventQueue& operator=(EventQueue&& rhs) = delete;
+#pragma endregion Special Members
+
 #pragma region Static Members
 		public:
 			/// <summary>
@@ -115,6 +193,7 @@ namespace Library
 		/// Getter method for the number of elements in the EventQueue.
 		/// </summary>
 		/// <returns>Number of queued Event instances.</returns>
+		/// <remarks>Read without locking, so the value is approximate while other threads Enqueue.</remarks>
 		std::size_t Size() const;
 
 		/// <summary>
@@ -127,14 +206,27 @@ namespace Library
 		/// Gets the max number of subscribers for which memory is already allocated.
 		/// </summary>
 		/// <returns>Max number of subscribers for which memory is already allocated.</returns>
-		/// <remarks>This value may be inaccurate between calls to Enqueue and Update.</remarks>
+		/// <remarks>Excludes Event instances staged by Enqueue since the last Update.</remarks>
 		std::size_t Capacity() const;
+
+		/// <summary>
+		/// Gets the JobSystem used to deliver expired Event instances in parallel.
+		/// </summary>
+		/// <returns>Pointer to the JobSystem, or null if delivery is serial.</returns>
+		JobSystem* GetJobSystem() const;
+
+		/// <summary>
+		/// Gets the EventJournal recording the EventQueue.
+		/// </summary>
+		/// <returns>Pointer to the EventJournal, or null if not recording.</returns>
+		EventJournal* GetJournal() const;
 #pragma endregion Accessors
 
 #pragma region Modifiers
 	public:
 		/// <summary>
 		/// Adds an EventEntry to the EventQueue.
+		/// Lock-free and safe to call from any number of threads; the EventEntry is staged until the next Update.
 		/// </summary>
 		/// <param name="eventPublisher">EventPublisher reference to the Event instance to be queued.</param>
 		/// <param name="expireTime">Reference to a GameTime instance used to calculate the Event expire time.</param>
@@ -142,14 +234,30 @@ namespace Library
 		void Enqueue(const std::shared_ptr<EventPublisher>& eventPublisher, const TimePoint& expireTime=TimePoint());
 
 		/// <summary>
-		/// Publishes all expired events, then removes expired EventEntry instances.
-		/// Also removes any EventEntry instances with null EventPublisher references.
+		/// Moves staged EventEntry instances into the queue, removes all expired EventEntry instances, then publishes them in order of expire time.
+		/// Runs in O(k log n) for k expired out of n queued Event instances.
+		/// With a JobSystem set, subscribers are notified in parallel batches, except for Event types forcing ordered delivery,
+		/// which are still published in order on the calling thread.
 		/// </summary>
 		/// <param name="gameTime">Reference to a GameTime instance used when calculating EventEntry expiration.</param>
+		/// <exception cref="Exception::AggregateException">Thrown after parallel delivery if any subscriber threw.</exception>
 		void Update(const GameTime& gameTime);
 
 		/// <summary>
-		/// Removes all EventEntry instances from the EventQueue, resetting the size to zero.
+		/// Opts in to parallel delivery of expired Event instances.
+		/// </summary>
+		/// <param name="jobSystem">JobSystem to deliver on, or null to deliver serially.</param>
+		void SetJobSystem(JobSystem* jobSystem);
+
+		/// <summary>
+		/// Starts recording every Enqueue and Update to an EventJournal, for replay by EventReplay.
+		/// </summary>
+		/// <param name="journal">EventJournal to record to, which must outlive the recording, or null to stop recording.</param>
+		/// <remarks>Must not be called concurrently with Enqueue or Update.</remarks>
+		void SetJournal(EventJournal* journal);
+
+		/// <summary>
+		/// Removes all queued and staged EventEntry instances from the EventQueue, resetting the size to zero.
 		/// </summary>
 		void Clear();
 
@@ -159,15 +267,99 @@ namespace Library
 		void ShrinkToFit();
 #pragma endregion Modifiers
 
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Heap ordering predicate, placing the EventEntry that expires first at the front of the queue.
+		/// </summary>
+		/// <param name="lhs">EventEntry to be compared.</param>
+		/// <param name="rhs">EventEntry to be compared against.</param>
+		/// <returns>True if lhs expires after rhs, otherwise false.</returns>
+		static bool ExpiresLater(const EventEntry& lhs, const EventEntry& rhs);
+
+		/// <summary>
+		/// Claims a slot of the staging ring for an EventEntry.
+		/// </summary>
+		/// <param name="entry">EventEntry to be staged, moved from only if staged.</param>
+		/// <returns>True if the EventEntry was staged, false if the ring is full.</returns>
+		bool TryStage(EventEntry& entry);
+
+		/// <summary>
+		/// Records an Enqueue to the EventJournal.
+		/// </summary>
+		/// <param name="eventPublisher">Event being enqueued.</param>
+		/// <param name="expireTime">TimePoint when the Event expires.</param>
+		void RecordEnqueue(const EventPublisher& eventPublisher, const TimePoint& expireTime);
+
+		/// <summary>
+		/// Moves every staged EventEntry, from the ring then the overflow list, into the heap.
+		/// Must be called with the mutex held.
+		/// </summary>
+		void DrainPending();
+
+		/// <summary>
+		/// Delivers expired Event instances across the JobSystem, collecting the exceptions thrown by subscribers.
+		/// </summary>
+		/// <param name="expiredEvents">Expired EventEntry instances, in order of expire time.</param>
+		/// <exception cref="Exception::AggregateException">Thrown if any subscriber threw.</exception>
+		void PublishParallel(const Vector<EventEntry>& expiredEvents);
+#pragma endregion Helper Methods
+
 #pragma region Data Members
 	private:
 		/// <summary>
 		/// Queue of EventEntry data used to publish Event instances to their EventSubscriber lists.
+		/// Ordered as a binary min-heap on ExpireTime.
 		/// </summary>
 		Vector<EventEntry> mQueue{ Vector<EventEntry>::EqualityFunctor() };
 
 		/// <summary>
-		/// Mutex controlling thread access to the EventQueue instance.
+		/// Storage for the EventEntry instances expired by Update, kept between calls so publishing does not allocate.
+		/// </summary>
+		Vector<EventEntry> mExpiredEvents{ Vector<EventEntry>::EqualityFunctor() };
+
+		/// <summary>
+		/// Staging ring of EventEntry instances enqueued since the last Update.
+		/// </summary>
+		std::unique_ptr<StagingSlot[]> mStaging;
+
+		/// <summary>
+		/// Mask wrapping positions into the staging ring.
+		/// </summary>
+		std::size_t mStagingMask;
+
+		/// <summary>
+		/// Next position of the staging ring to be claimed by a producer.
+		/// </summary>
+		std::atomic<std::size_t> mStagingHead{ 0 };
+
+		/// <summary>
+		/// Next position of the staging ring to be drained, guarded by the mutex.
+		/// </summary>
+		std::size_t mStagingTail{ 0 };
+
+		/// <summary>
+		/// Head of the overflow list of EventEntry instances enqueued while the staging ring was full.
+		/// </summary>
+		std::atomic<PendingEntry*> mPending{ nullptr };
+
+		/// <summary>
+		/// Number of queued and staged EventEntry instances.
+		/// </summary>
+		std::atomic<std::size_t> mSize{ 0 };
+
+		/// <summary>
+		/// JobSystem used to deliver expired Event instances in parallel, if any.
+		/// </summary>
+		JobSystem* mJobSystem{ nullptr };
+
+		/// <summary>
+		/// EventJournal recording the EventQueue, if any.
+		/// </summary>
+		EventJournal* mJournal{ nullptr };
+
+		/// <summary>
+		/// Mutex controlling access to the heap, taken by Update and the other consumer-side methods but never by Enqueue.
 		/// </summary>
 		mutable std::mutex mMutex;
 #pragma endregion Data Members
@@ -15,14 +15,12 @@ namespace Library
 #pragma region Accessors
 	inline std::size_t EventQueue::Size() const
 	{
-		std::scoped_lock<std::mutex> lock(mMutex);
-		return mQueue.Size();
+		return mSize.load(std::memory_order_relaxed);
 	}
 
 	inline bool EventQueue::IsEmpty() const
 	{
-		std::scoped_lock<std::mutex> lock(mMutex);
-		return mQueue.IsEmpty();
+		return Size() == 0;
 	}
 
 	inline std::size_t EventQueue::Capacity() const
@@ -30,22 +28,60 @@ namespace Library
 		std::scoped_lock<std::mutex> lock(mMutex);
 		return mQueue.Capacity();
 	}
+
+	inline JobSystem* EventQueue::GetJobSystem() const
+	{
+		return mJobSystem;
+	}
+
+	inline EventJournal* EventQueue::GetJournal() const
+	{
+		return mJournal;
+	}
 #pragma endregion Accessors
 	
 #pragma region Modifiers
 	inline void EventQueue::Enqueue(const std::shared_ptr<EventPublisher>& eventPublisher, const TimePoint& expireTime)
 	{
-		std::scoped_lock<std::mutex> lock(mMutex);
-
 		if (!eventPublisher) throw std::runtime_error("Attempted to Enqueue null pointer.");
 
-		mQueue.EmplaceBack(EventEntry(eventPublisher, expireTime));
+		if (mJournal) RecordEnqueue(*eventPublisher, expireTime);
+
+		EventEntry entry(eventPublisher, expireTime);
+
+#ifdef EVENT_INSTRUMENTATION
+		if (EventInstrumentation::IsEnabled())
+		{
+			entry.EnqueueTime = EventInstrumentation::Clock::now();
+			EventInstrumentation::RecordEnqueue(eventPublisher->TypeIdInstance());
+		}
+#endif
+
+		mSize.fetch_add(1, std::memory_order_relaxed);
+
+		if (TryStage(entry)) return;
+
+		PendingEntry* pending = new PendingEntry{ std::move(entry), mPending.load(std::memory_order_relaxed) };
+
+		while (!mPending.compare_exchange_weak(pending->Next, pending, std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	inline void EventQueue::SetJobSystem(JobSystem* jobSystem)
+	{
+		mJobSystem = jobSystem;
+	}
+
+	inline void EventQueue::SetJournal(EventJournal* journal)
+	{
+		mJournal = journal;
 	}
 
 	inline void EventQueue::Clear()
 	{
 		std::scoped_lock<std::mutex> lock(mMutex);
 
+		DrainPending();
+		mSize.fetch_sub(mQueue.Size(), std::memory_order_relaxed);
 		mQueue.Clear();
 	}
 	
@@ -54,6 +90,43 @@ namespace Library
 		std::scoped_lock<std::mutex> lock(mMutex);
 						
 		mQueue.ShrinkToFit();
+		mExpiredEvents.ShrinkToFit();
 	}
 #pragma endregion Modifiers
+
+#pragma region Helper Methods
+	inline bool EventQueue::TryStage(EventEntry& entry)
+	{
+		std::size_t position = mStagingHead.load(std::memory_order_relaxed);
+
+		while (true)
+		{
+			StagingSlot& slot = mStaging[position & mStagingMask];
+			const std::size_t sequence = slot.Sequence.load(std::memory_order_acquire);
+
+			if (sequence == position)
+			{
+				if (mStagingHead.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					slot.Entry = std::move(entry);
+					slot.Sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (sequence < position)
+			{
+				return false;
+			}
+			else
+			{
+				position = mStagingHead.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	inline bool EventQueue::ExpiresLater(const EventEntry& lhs, const EventEntry& rhs)
+	{
+		return lhs.ExpireTime > rhs.ExpireTime;
+	}
+#pragma endregion Helper Methods
 }
\ No newline at end of file
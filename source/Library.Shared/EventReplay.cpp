@@ -0,0 +1,136 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "EventReplay.h"
+
+// First Party
+#include "EventQueue.h"
+#include "GameTime.h"
+#include "StreamHelper.h"
+#pragma endregion Includes
+
+namespace Library
+{
+#pragma region Special Members
+	EventReplay::EventReplay(std::istream& stream) :
+		mStream(stream)
+	{
+		InputStreamHelper helper(mStream);
+
+		std::uint32_t magic{ 0 };
+		std::uint32_t version{ 0 };
+		helper >> magic >> version;
+
+		if (!mStream || magic != EventJournal::Magic) throw std::runtime_error("Invalid journal header.");
+		if (version != EventJournal::Version) throw std::runtime_error("Unsupported journal version.");
+	}
+#pragma endregion Special Members
+
+#pragma region Replay
+	bool EventReplay::Step(EventQueue& eventQueue, GameTime& gameTime)
+	{
+		InputStreamHelper helper(mStream);
+
+		while (true)
+		{
+			if (mStream.peek() == std::istream::traits_type::eof()) return false;
+
+			std::uint32_t recordType{ 0 };
+			helper >> recordType;
+			if (!mStream) throw std::runtime_error("Truncated journal.");
+
+			switch (static_cast<EventJournal::RecordType>(recordType))
+			{
+			case EventJournal::RecordType::Type:
+			{
+				std::uint32_t index{ 0 };
+				std::string name;
+				helper >> index >> name;
+
+				if (!mStream || index != mTypeNames.Size()) throw std::runtime_error("Truncated journal.");
+				mTypeNames.PushBack(std::move(name));
+				break;
+			}
+
+			case EventJournal::RecordType::Enqueue:
+			{
+				std::uint32_t index{ 0 };
+				std::int64_t expireTime{ 0 };
+				std::uint32_t payloadSize{ 0 };
+				helper >> index >> expireTime >> payloadSize;
+
+				if (!mStream || index >= mTypeNames.Size()) throw std::runtime_error("Truncated journal.");
+
+				mPayload.resize(payloadSize);
+				mStream.read(mPayload.data(), static_cast<std::streamsize>(payloadSize));
+				if (!mStream) throw std::runtime_error("Truncated journal.");
+
+				const auto it = mFactories.Find(mTypeNames[index]);
+
+				if (it == mFactories.end())
+				{
+					++mSkippedCount;
+					break;
+				}
+
+				std::istringstream payloadStream(mPayload);
+				InputStreamHelper payloadHelper(payloadStream);
+
+				const std::chrono::high_resolution_clock::time_point expireTimePoint(
+					std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(std::chrono::nanoseconds(expireTime)));
+
+				eventQueue.Enqueue(it->second(payloadHelper), expireTimePoint);
+				++mEventCount;
+				break;
+			}
+
+			case EventJournal::RecordType::Update:
+			{
+				std::int64_t currentTime{ 0 };
+				std::int64_t totalGameTime{ 0 };
+				std::int64_t elapsedGameTime{ 0 };
+				helper >> currentTime >> totalGameTime >> elapsedGameTime;
+
+				if (!mStream) throw std::runtime_error("Truncated journal.");
+
+				gameTime.SetCurrentTime(std::chrono::high_resolution_clock::time_point(
+					std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(std::chrono::nanoseconds(currentTime))));
+				gameTime.SetTotalGameTime(std::chrono::milliseconds(totalGameTime));
+				gameTime.SetElapsedGameTime(std::chrono::milliseconds(elapsedGameTime));
+
+				eventQueue.Update(gameTime);
+				++mFrameCount;
+				return true;
+			}
+
+			default:
+				throw std::runtime_error("Invalid journal record.");
+			}
+		}
+	}
+
+	std::size_t EventReplay::Run(EventQueue& eventQueue, GameTime& gameTime)
+	{
+		std::size_t frameCount = 0;
+
+		while (Step(eventQueue, gameTime))
+		{
+			++frameCount;
+		}
+
+		return frameCount;
+	}
+#pragma endregion Replay
+
+#pragma region Helper Methods
+	void EventReplay::Register(const std::string& name, Factory factory)
+	{
+		if (!mFactories.Emplace(name, std::move(factory)).second)
+		{
+			throw std::runtime_error("Event type already registered.");
+		}
+	}
+#pragma endregion Helper Methods
+}
\ No newline at end of file
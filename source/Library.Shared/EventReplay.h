@@ -0,0 +1,194 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <functional>
+#include <istream>
+#include <memory>
+#include <string>
+
+// First Party
+#include "FlatHashMap.h"
+#include "Vector.h"
+#include "Event.h"
+#include "EventJournal.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	// Forward Declarations
+	class EventQueue;
+	class GameTime;
+	class InputStreamHelper;
+
+	/// <summary>
+	/// Replays a journal written by EventJournal into an EventQueue, frame by frame.
+	/// Each Step enqueues the Event instances recorded before the next recorded Update,
+	/// then updates the EventQueue with the recorded GameTime, so the same Event instances expire in the same frames.
+	/// Event types are matched by the name they were registered with, so journals may be replayed in a later session.
+	/// </summary>
+	/// <remarks>
+	/// Event instances enqueued by subscribers during replay are recorded in the journal as well,
+	/// so subscribers that enqueue Event instances should be left unsubscribed, or they will be delivered twice.
+	/// </remarks>
+	class EventReplay final
+	{
+#pragma region Type Definitions
+	public:
+		/// <summary>
+		/// Type definition for a function deserializing an Event message.
+		/// </summary>
+		/// <typeparam name="MessageT">Message type of the Event.</typeparam>
+		template<typename MessageT>
+		using Reader = std::function<MessageT(InputStreamHelper&)>;
+
+	private:
+		/// <summary>
+		/// Type definition for a function deserializing an Event.
+		/// </summary>
+		using Factory = std::function<std::shared_ptr<EventPublisher>(InputStreamHelper&)>;
+#pragma endregion Type Definitions
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Constructor, reading the journal header.
+		/// </summary>
+		/// <param name="stream">Binary stream containing the journal, which must outlive the EventReplay.</param>
+		/// <exception cref="std::runtime_error">The stream does not start with a supported journal header.</exception>
+		explicit EventReplay(std::istream& stream);
+
+		/// <summary>
+		/// Default destructor.
+		/// </summary>
+		~EventReplay() = default;
+
+		/// <summary>
+		/// Deleted copy constructor.
+		/// </summary>
+		EventReplay(const EventReplay&) = delete;
+
+		/// <summary>
+		/// Deleted copy assignment operator.
+		/// </summary>
+		EventReplay& operator=(const EventReplay&) = delete;
+
+		/// <summary>
+		/// Deleted move constructor.
+		/// </summary>
+		EventReplay(EventReplay&&) = delete;
+
+		/// <summary>
+		/// Deleted move assignment operator.
+		/// </summary>
+		EventReplay& operator=(EventReplay&&) = delete;
+#pragma endregion Special Members
+
+#pragma region Registration
+	public:
+		/// <summary>
+		/// Registers an Event type to be replayed. Recorded Event instances of unregistered types are skipped.
+		/// </summary>
+		/// <typeparam name="MessageT">Message type of the Event.</typeparam>
+		/// <param name="name">Name the Event type was journaled with.</param>
+		/// <param name="read">Function deserializing a message.</param>
+		/// <exception cref="std::runtime_error">Event type already registered.</exception>
+		template<typename MessageT>
+		void Register(const std::string& name, Reader<MessageT> read);
+#pragma endregion Registration
+
+#pragma region Replay
+	public:
+		/// <summary>
+		/// Replays one frame: enqueues every Event recorded before the next Update record,
+		/// sets the GameTime to the recorded one, then updates the EventQueue with it.
+		/// </summary>
+		/// <param name="eventQueue">EventQueue to feed.</param>
+		/// <param name="gameTime">GameTime set to the recorded time of the frame.</param>
+		/// <returns>True if a frame was replayed, false if the journal has ended.</returns>
+		/// <exception cref="std::runtime_error">The journal is truncated or corrupt.</exception>
+		bool Step(EventQueue& eventQueue, GameTime& gameTime);
+
+		/// <summary>
+		/// Replays every remaining frame.
+		/// </summary>
+		/// <param name="eventQueue">EventQueue to feed.</param>
+		/// <param name="gameTime">GameTime set to the recorded time of each frame.</param>
+		/// <returns>Number of frames replayed.</returns>
+		/// <exception cref="std::runtime_error">The journal is truncated or corrupt.</exception>
+		std::size_t Run(EventQueue& eventQueue, GameTime& gameTime);
+#pragma endregion Replay
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the number of frames replayed.
+		/// </summary>
+		/// <returns>Number of frames replayed.</returns>
+		std::size_t FrameCount() const;
+
+		/// <summary>
+		/// Gets the number of Event instances enqueued.
+		/// </summary>
+		/// <returns>Number of Event instances enqueued.</returns>
+		std::size_t EventCount() const;
+
+		/// <summary>
+		/// Gets the number of recorded Event instances skipped because their type is not registered.
+		/// </summary>
+		/// <returns>Number of Event instances skipped.</returns>
+		std::size_t SkippedCount() const;
+#pragma endregion Accessors
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Registers an Event type by name.
+		/// </summary>
+		/// <param name="name">Name the Event type was journaled with.</param>
+		/// <param name="factory">Function deserializing an Event of the type.</param>
+		void Register(const std::string& name, Factory factory);
+#pragma endregion Helper Methods
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Binary stream containing the journal.
+		/// </summary>
+		std::istream& mStream;
+
+		/// <summary>
+		/// Registered Event types, by name.
+		/// </summary>
+		FlatHashMap<std::string, Factory> mFactories;
+
+		/// <summary>
+		/// Names of the Event types declared by the journal, by record index.
+		/// </summary>
+		Vector<std::string> mTypeNames;
+
+		/// <summary>
+		/// Storage for the payload of the current record, kept between records.
+		/// </summary>
+		std::string mPayload;
+
+		/// <summary>
+		/// Number of frames replayed.
+		/// </summary>
+		std::size_t mFrameCount{ 0 };
+
+		/// <summary>
+		/// Number of Event instances enqueued.
+		/// </summary>
+		std::size_t mEventCount{ 0 };
+
+		/// <summary>
+		/// Number of Event instances skipped.
+		/// </summary>
+		std::size_t mSkippedCount{ 0 };
+#pragma endregion Data Members
+	};
+}
+
+// Inline File
+#include "EventReplay.inl"
\ No newline at end of file
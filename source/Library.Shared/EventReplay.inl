@@ -0,0 +1,35 @@
+#pragma once
+
+// Header
+#include "EventReplay.h"
+
+namespace Library
+{
+#pragma region Registration
+	template<typename MessageT>
+	inline void EventReplay::Register(const std::string& name, Reader<MessageT> read)
+	{
+		Register(name, [read = std::move(read)](InputStreamHelper& helper)
+		{
+			return std::shared_ptr<EventPublisher>(std::make_shared<Event<MessageT>>(read(helper)));
+		});
+	}
+#pragma endregion Registration
+
+#pragma region Accessors
+	inline std::size_t EventReplay::FrameCount() const
+	{
+		return mFrameCount;
+	}
+
+	inline std::size_t EventReplay::EventCount() const
+	{
+		return mEventCount;
+	}
+
+	inline std::size_t EventReplay::SkippedCount() const
+	{
+		return mSkippedCount;
+	}
+#pragma endregion Accessors
+}
\ No newline at end of file
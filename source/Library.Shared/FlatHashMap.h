@@ -0,0 +1,757 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <cstdint>
+#include <cstring>
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define FLATHASHMAP_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// First Party
+#include "DefaultHash.h"
+#include "DefaultEquality.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Represents an open addressing HashMap collection of key-value pairs.
+	/// Pairs are stored inline in a single flat slot array, alongside an array of one byte control values.
+	/// Each control byte holds seven bits of the hash code of its slot, so that probing compares a group of
+	/// sixteen candidates at a time, using SSE2 when it is available, before touching any keys.
+	/// </summary>
+	/// <remarks>
+	/// Unlike HashMap, the address of a Pair is not stable. Rehashing, whether explicit or triggered by insertion,
+	/// invalidates all Iterators and any pointers or references to elements.
+	/// </remarks>
+	/// <typeparam name="TKey">Key value type associated with a TData value in a FlatHashMap.</typeparam>
+	/// <typeparam name="TData">Data value type associated with a TKey value in a FlatHashMap.</typeparam>
+	template<typename TKey, typename TData>
+	class FlatHashMap final
+	{
+#pragma region Type Definitions, Constants
+	public:
+		/// <summary>
+		/// Pairs of TKey and TData values that make up the elements of the FlatHashMap.
+		/// </summary>
+		using Pair = std::pair<const TKey, TData>;
+
+		/// <summary>
+		/// Value type for std::iterator_trait.
+		/// </summary>
+		using value_type = Pair;
+
+		/// <summary>
+		/// Hash functor type for computing hash codes from a TKey value.
+		/// </summary>
+		using HashFunctor = std::function<std::size_t(const TKey& key)>;
+
+		/// <summary>
+		/// Equality functor type for comparing TKey values.
+		/// </summary>
+		using KeyEqualityFunctor = std::function<bool(const TKey& lhs, const TKey& rhs)>;
+
+		/// <summary>
+		/// Default number of slots in the FlatHashMap.
+		/// </summary>
+		static constexpr std::size_t DefaultBucketCount = 32;
+
+		/// <summary>
+		/// Number of slots probed together as a single group.
+		/// </summary>
+		static constexpr std::size_t GroupWidth = 16;
+
+	private:
+		/// <summary>
+		/// Control byte type. Negative values mark slots without a Pair, otherwise it holds seven bits of hash code.
+		/// </summary>
+		using ControlByte = std::int8_t;
+
+		/// <summary>
+		/// Bit mask with one bit set for each slot in a group that matched a probe.
+		/// </summary>
+		using BitMask = std::uint32_t;
+
+		/// <summary>
+		/// Control byte value for a slot that has never held a Pair since the last rehash.
+		/// </summary>
+		static constexpr ControlByte Empty = -128;
+
+		/// <summary>
+		/// Control byte value for a slot whose Pair was removed. Probing continues past deleted slots.
+		/// </summary>
+		static constexpr ControlByte Deleted = -2;
+
+		/// <summary>
+		/// Maximum load factor, as a ratio of numerator to denominator, before the FlatHashMap grows.
+		/// </summary>
+		static constexpr std::size_t MaxLoadNumerator = 7;
+
+		/// <summary>
+		/// Maximum load factor, as a ratio of numerator to denominator, before the FlatHashMap grows.
+		/// </summary>
+		static constexpr std::size_t MaxLoadDenominator = 8;
+#pragma endregion Type Definitions, Constants
+
+#pragma region Iterator
+	public:
+		/// <summary>
+		/// Class for traversing the FlatHashMap and retrieving values, which can then be manipulated.
+		/// </summary>
+		class Iterator final
+		{
+			friend FlatHashMap;
+			friend class ConstIterator;
+
+#pragma region Iterator Traits
+		public:
+			/// <summary>
+			/// Size type for std::iterator_trait.
+			/// </summary>
+			using size_type = std::size_t;
+
+			/// <summary>
+			/// Difference type for std::iterator_trait.
+			/// </summary>
+			using difference_type = std::ptrdiff_t;
+
+			/// <summary>
+			/// Value type for std::iterator_trait.
+			/// </summary>
+			using value_type = Pair;
+
+			/// <summary>
+			/// Pointer type for std::iterator_trait.
+			/// </summary>
+			using pointer = Pair*;
+
+			/// <summary>
+			/// Reference type for std::iterator_trait.
+			/// </summary>
+			using reference = Pair&;
+
+			/// <summary>
+			/// Iterator category for std::iterator_trait.
+			/// </summary>
+			using iterator_category = std::forward_iterator_tag;
+#pragma endregion Iterator Traits
+
+		public:
+			/* Defaults */
+			Iterator() = default;
+			~Iterator() = default;
+			Iterator(const Iterator& rhs) = default;
+			Iterator& operator=(const Iterator& rhs) = default;
+			Iterator(Iterator&& rhs) = default;
+			Iterator& operator=(Iterator&& rhs) = default;
+
+		private:
+			/// <summary>
+			/// Specialized constructor for creating an Iterator for a FlatHashMap.
+			/// </summary>
+			/// <param name="hashMap">Source FlatHashMap for the Iterator's values.</param>
+			/// <param name="index">Index of the slot holding the target Pair value.</param>
+			explicit Iterator(FlatHashMap& hashMap, const std::size_t index);
+
+		public:
+			/// <summary>
+			/// Dereference operator.
+			/// </summary>
+			/// <returns>Value of the current element of the FlatHashMap.</returns>
+			/// <exception cref="runtime_error">Iterator invalid.</exception>
+			/// <exception cref="out_of_range">Iterator out of bounds.</exception>
+			Pair& operator*() const;
+
+			/// <summary>
+			/// Member access operator.
+			/// </summary>
+			/// <returns>Pointer to the value of the current element of the FlatHashMap.</returns>
+			/// <exception cref="runtime_error">Iterator invalid.</exception>
+			/// <exception cref="out_of_range">Iterator out of bounds.</exception>
+			Pair* operator->() const;
+
+			/// <summary>
+			/// Equal operator.
+			/// </summary>
+			/// <param name="rhs">Right hand side Iterator to be compared against for equality.</param>
+			/// <returns>True when the rhs owner FlatHashMap and element are equal to the left, false otherwise.</returns>
+			bool operator==(const Iterator& rhs) const noexcept;
+
+			/// <summary>
+			/// Not equal operator.
+			/// </summary>
+			/// <param name="rhs">Right hand side Iterator to be compared against for equality.</param>
+			/// <returns>True when the rhs owner FlatHashMap and element are unequal to the left, false otherwise.</returns>
+			bool operator!=(const Iterator& rhs) const noexcept;
+
+			/// <summary>
+			/// Pre-increment operator.
+			/// </summary>
+			/// <returns>Reference to the next Iterator.</returns>
+			/// <exception cref="runtime_error">Iterator invalid.</exception>
+			/// <exception cref="out_of_range">Iterator out of bounds.</exception>
+			Iterator& operator++();
+
+			/// <summary>
+			/// Post-increment operator.
+			/// </summary>
+			/// <returns>Copy of the Iterator before it was incremented.</returns>
+			/// <exception cref="runtime_error">Iterator invalid.</exception>
+			/// <exception cref="out_of_range">Iterator out of bounds.</exception>
+			Iterator operator++(int);
+
+		private:
+			/// <summary>
+			/// Owner FlatHashMap that is able to be traversed by the Iterator instance.
+			/// </summary>
+			FlatHashMap* mOwner{ nullptr };
+
+			/// <summary>
+			/// Index of the current slot in the owner FlatHashMap.
+			/// </summary>
+			std::size_t mIndex{ 0 };
+		};
+#pragma endregion Iterator
+
+#pragma region ConstIterator
+	public:
+		/// <summary>
+		/// Class for traversing the FlatHashMap and reading values, may not manipulate the FlatHashMap.
+		/// </summary>
+		class ConstIterator final
+		{
+			friend FlatHashMap;
+
+#pragma region Iterator Traits
+		public:
+			/// <summary>
+			/// Size type for std::iterator_trait.
+			/// </summary>
+			using size_type = std::size_t;
+
+			/// <summary>
+			/// Difference type for std::iterator_trait.
+			/// </summary>
+			using difference_type = std::ptrdiff_t;
+
+			/// <summary>
+			/// Value type for std::iterator_trait.
+			/// </summary>
+			using value_type = Pair;
+
+			/// <summary>
+			/// Pointer type for std::iterator_trait.
+			/// </summary>
+			using pointer = const Pair*;
+
+			/// <summary>
+			/// Reference type for std::iterator_trait.
+			/// </summary>
+			using reference = const Pair&;
+
+			/// <summary>
+			/// Iterator category for std::iterator_trait.
+			/// </summary>
+			using iterator_category = std::forward_iterator_tag;
+#pragma endregion Iterator Traits
+
+		public:
+			/* Defaults */
+			ConstIterator() = default;
+			~ConstIterator() = default;
+			ConstIterator(const ConstIterator&) = default;
+			ConstIterator& operator=(const ConstIterator&) = default;
+			ConstIterator(ConstIterator&&) = default;
+			ConstIterator& operator=(ConstIterator&&) = default;
+
+			/// <summary>
+			/// Specialized copy constructor that enables the construction of a ConstIterator from a non-const Iterator.
+			/// </summary>
+			/// <param name="it">Iterator to be copied.</param>
+			ConstIterator(const Iterator& it);
+
+		private:
+			/// <summary>
+			/// Specialized constructor for creating a ConstIterator for a FlatHashMap.
+			/// </summary>
+			/// <param name="hashMap">Source FlatHashMap for the ConstIterator's values.</param>
+			/// <param name="index">Index of the slot holding the target Pair value.</param>
+			explicit ConstIterator(const FlatHashMap& hashMap, const std::size_t index);
+
+		public:
+			/// <summary>
+			/// Dereference operator.
+			/// </summary>
+			/// <returns>Value of the current element of the FlatHashMap.</returns>
+			/// <exception cref="runtime_error">ConstIterator invalid.</exception>
+			/// <exception cref="out_of_range">ConstIterator out of bounds.</exception>
+			const Pair& operator*() const;
+
+			/// <summary>
+			/// Member access operator.
+			/// </summary>
+			/// <returns>Pointer to the value of the current element of the FlatHashMap.</returns>
+			/// <exception cref="runtime_error">ConstIterator invalid.</exception>
+			/// <exception cref="out_of_range">ConstIterator out of bounds.</exception>
+			const Pair* operator->() const;
+
+			/// <summary>
+			/// Equal operator.
+			/// </summary>
+			/// <param name="rhs">Right hand side ConstIterator to be compared against for equality.</param>
+			/// <returns>True when the rhs owner FlatHashMap and element are equal to the left, false otherwise.</returns>
+			bool operator==(const ConstIterator& rhs) const noexcept;
+
+			/// <summary>
+			/// Not equal operator.
+			/// </summary>
+			/// <param name="rhs">Right hand side ConstIterator to be compared against for equality.</param>
+			/// <returns>True when the rhs owner FlatHashMap and element are unequal to the left, false otherwise.</returns>
+			bool operator!=(const ConstIterator& rhs) const noexcept;
+
+			/// <summary>
+			/// Pre-increment operator.
+			/// </summary>
+			/// <returns>Reference to the next ConstIterator.</returns>
+			/// <exception cref="runtime_error">ConstIterator invalid.</exception>
+			/// <exception cref="out_of_range">ConstIterator out of bounds.</exception>
+			ConstIterator& operator++();
+
+			/// <summary>
+			/// Post-increment operator.
+			/// </summary>
+			/// <returns>Copy of the ConstIterator before it was incremented.</returns>
+			/// <exception cref="runtime_error">ConstIterator invalid.</exception>
+			/// <exception cref="out_of_range">ConstIterator out of bounds.</exception>
+			ConstIterator operator++(int);
+
+		private:
+			/// <summary>
+			/// Owner FlatHashMap that is able to be traversed by the ConstIterator instance.
+			/// </summary>
+			const FlatHashMap* mOwner{ nullptr };
+
+			/// <summary>
+			/// Index of the current slot in the owner FlatHashMap.
+			/// </summary>
+			std::size_t mIndex{ 0 };
+		};
+#pragma endregion ConstIterator
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Default constructor.
+		/// </summary>
+		/// <param name="bucketCount">Minimum number of slots to initialize for the FlatHashMap. Cannot be zero.</param>
+		/// <param name="keyEqualityFunctor">Equality functor for comparing TKey values.</param>
+		/// <param name="hashFunctor">Hashing functor for creating hash codes from TKey values.</param>
+		/// <remarks cref="bucketCount">Asserts on zero bucketCount. Rounded up to a power of two, no less than GroupWidth.</remarks>
+		explicit FlatHashMap(const std::size_t bucketCount=DefaultBucketCount, const KeyEqualityFunctor& keyEqualityFunctor=DefaultEquality<TKey>(), const HashFunctor& hashFunctor=DefaultHash<TKey>());
+
+		/// <summary>
+		/// Destructor.
+		/// Destroys all existing elements and frees the slot array.
+		/// </summary>
+		~FlatHashMap();
+
+		/// <summary>
+		/// Copy constructor.
+		/// Takes in a FlatHashMap as a parameter, then copies the data values to the constructed FlatHashMap.
+		/// </summary>
+		/// <param name="rhs">FlatHashMap to be copied.</param>
+		FlatHashMap(const FlatHashMap& rhs);
+
+		/// <summary>
+		/// Copy assignment operator.
+		/// Copies the data values from the right hand side (rhs) value to the left hand side.
+		/// </summary>
+		/// <param name="rhs">FlatHashMap whose values are copied.</param>
+		/// <returns>Modified FlatHashMap with copied values.</returns>
+		FlatHashMap& operator=(const FlatHashMap& rhs);
+
+		/// <summary>
+		/// Move constructor.
+		/// Takes a FlatHashMap as a parameter and moves the data to the constructed FlatHashMap.
+		/// </summary>
+		/// <param name="rhs">FlatHashMap to be moved.</param>
+		FlatHashMap(FlatHashMap&& rhs) noexcept;
+
+		/// <summary>
+		/// Move assignment operator.
+		/// Moves the data values from the right hand side (rhs) value to the left hand side.
+		/// </summary>
+		/// <param name="rhs">FlatHashMap whose values are moved.</param>
+		/// <returns>Modified FlatHashMap with moved values.</returns>
+		FlatHashMap& operator=(FlatHashMap&& rhs) noexcept;
+
+		/// <summary>
+		/// Initializer list constructor.
+		/// </summary>
+		/// <param name="rhs">List of Pair values for insertion.</param>
+		/// <param name="bucketCount">Minimum number of slots to initialize for the FlatHashMap. Cannot be zero.</param>
+		/// <param name="keyEqualityFunctor">Equality functor for comparing TKey values.</param>
+		/// <param name="hashFunctor">Hashing functor for creating hash codes from TKey values.</param>
+		/// <remarks cref="bucketCount">Asserts on zero bucketCount. Rounded up to a power of two, no less than GroupWidth.</remarks>
+		FlatHashMap(std::initializer_list<Pair> rhs, const std::size_t bucketCount=DefaultBucketCount, const KeyEqualityFunctor& keyEqualityFunctor=DefaultEquality<TKey>(), const HashFunctor& hashFunctor=DefaultHash<TKey>());
+
+		/// <summary>
+		/// Initializer list assignment operator.
+		/// </summary>
+		/// <param name="rhs">List of values to be in the FlatHashMap.</param>
+		/// <returns>Reference to the modified FlatHashMap containing the new pairs.</returns>
+		FlatHashMap& operator=(std::initializer_list<Pair> rhs);
+#pragma endregion Special Members
+
+#pragma region Size and Capacity
+	public:
+		/// <summary>
+		/// Getter method for the number of Pair values in the FlatHashMap.
+		/// </summary>
+		/// <returns>Number of Pair values in the FlatHashMap.</returns>
+		std::size_t Size() const;
+
+		/// <summary>
+		/// Getter method for the number of slots in the FlatHashMap.
+		/// </summary>
+		/// <returns>Number of slots in the FlatHashMap.</returns>
+		std::size_t BucketCount() const;
+
+		/// <summary>
+		/// Checks if the size of the FlatHashMap is greater than zero, indicating it is non-empty.
+		/// </summary>
+		/// <returns>True if the FlatHashMap contains no elements, otherwise false.</returns>
+		bool IsEmpty() const;
+
+		/// <summary>
+		/// Gets the ratio of the size of the FlatHashMap to the slot count.
+		/// </summary>
+		/// <returns>Ratio of elements to slots.</returns>
+		float LoadFactor() const;
+
+		/// <summary>
+		/// Resizes the FlatHashMap to a given slot count, re-indexing the elements.
+		/// </summary>
+		/// <param name="bucketCount">New minimum slot count for the FlatHashMap.</param>
+		/// <remarks>Rounded up to a power of two large enough to hold the current elements under the maximum load factor.</remarks>
+		void Rehash(const std::size_t bucketCount);
+#pragma endregion Size and Capacity
+
+#pragma region Iterator Accessors
+	public:
+		/// <summary>
+		/// Gets an Iterator pointing to the first element in the FlatHashMap, values are mutable.
+		/// </summary>
+		/// <returns>Iterator to the first element in the FlatHashMap.</returns>
+		Iterator begin();
+
+		/// <summary>
+		/// Gets a ConstIterator pointing to the first element in the FlatHashMap, values are immutable.
+		/// </summary>
+		/// <returns>Constant value ConstIterator to the first element in the FlatHashMap.</returns>
+		ConstIterator begin() const;
+
+		/// <summary>
+		/// Gets a ConstIterator pointing to the first element in the FlatHashMap, values are immutable.
+		/// </summary>
+		/// <returns>Constant value ConstIterator to the first element in the FlatHashMap.</returns>
+		ConstIterator cbegin() const;
+
+		/// <summary>
+		/// Gets an Iterator pointing past the last element in the FlatHashMap, value is mutable.
+		/// </summary>
+		/// <returns>Iterator to the last element in the FlatHashMap.</returns>
+		Iterator end();
+
+		/// <summary>
+		/// Gets a ConstIterator pointing past the last element in the FlatHashMap, value is immutable.
+		/// </summary>
+		/// <returns>Constant value ConstIterator to the last element in the FlatHashMap.</returns>
+		ConstIterator end() const;
+
+		/// <summary>
+		/// Gets a ConstIterator pointing past the last element in the FlatHashMap, value is immutable.
+		/// </summary>
+		/// <returns>Constant value ConstIterator to the last element in the FlatHashMap.</returns>
+		ConstIterator cend() const;
+
+		/// <summary>
+		/// Searches the FlatHashMap for a given value and returns an Iterator.
+		/// </summary>
+		/// <param name="key">TKey value to search for in the FlatHashMap.</param>
+		/// <returns>Iterator referencing the value, if found. Otherwise it returns an Iterator to the end.</returns>
+		/// <exception cref="std::runtime_error">HashFunctor null.</exception>
+		/// <exception cref="std::runtime_error">KeyEqualityFunctor null.</exception>
+		Iterator Find(const TKey& key);
+
+		/// <summary>
+		/// Searches the FlatHashMap for a given value and returns a ConstIterator.
+		/// </summary>
+		/// <param name="key">TKey value to search for in the FlatHashMap.</param>
+		/// <returns>ConstIterator referencing the value, if found. Otherwise it returns a ConstIterator to the end.</returns>
+		/// <exception cref="std::runtime_error">HashFunctor null.</exception>
+		/// <exception cref="std::runtime_error">KeyEqualityFunctor null.</exception>
+		ConstIterator Find(const TKey& key) const;
+#pragma endregion Iterator Accessors
+
+#pragma region Element Accessors
+	public:
+		/// <summary>
+		/// Retrieves a value reference for the element with the specified key.
+		/// </summary>
+		/// <param name="key">Key of an element in the FlatHashMap.</param>
+		/// <returns>Reference to the value of the element with the given key.</returns>
+		/// <exception cref="out_of_range">TKey not found.</exception>
+		TData& At(const TKey& key);
+
+		/// <summary>
+		/// Retrieves a const value reference for the element with the specified key.
+		/// </summary>
+		/// <param name="key">Key of an element in the FlatHashMap.</param>
+		/// <returns>Const value reference to the value of the element with the given key.</returns>
+		/// <exception cref="out_of_range">TKey not found.</exception>
+		const TData& At(const TKey& key) const;
+
+		/// <summary>
+		/// Subscript operator.
+		/// Retrieves a value reference for the element with the specified key, inserting a default value if not found.
+		/// </summary>
+		/// <param name="key">Key of an element in the FlatHashMap.</param>
+		/// <returns>Reference to the value of the element with the given key.</returns>
+		TData& operator[](const TKey& key);
+
+		/// <summary>
+		/// Subscript operator.
+		/// Retrieves a const value reference for the element with the specified key.
+		/// </summary>
+		/// <param name="key">Key of an element in the FlatHashMap.</param>
+		/// <returns>Const value reference to the value of the element with the given key.</returns>
+		/// <exception cref="out_of_range">TKey not found.</exception>
+		const TData& operator[](const TKey& key) const;
+
+		/// <summary>
+		/// Checks if a Pair value with the given key is within the FlatHashMap.
+		/// </summary>
+		/// <param name="key">Key of an element in the FlatHashMap.</param>
+		/// <returns>True if the key exists in the FlatHashMap, false otherwise.</returns>
+		bool ContainsKey(const TKey& key) const;
+
+		/// <summary>
+		/// Checks if a Pair value with the given key is within the FlatHashMap.
+		/// </summary>
+		/// <param name="key">Key of an element in the FlatHashMap.</param>
+		/// <param name="dataOut">Reference to be written with the associated TData value, if the key is found.</param>
+		/// <returns>True if the key exists in the FlatHashMap, false otherwise.</returns>
+		bool ContainsKey(const TKey& key, TData& dataOut);
+#pragma endregion Element Accessors
+
+#pragma region Modifiers
+	public:
+		/// <summary>
+		/// Attempts to construct and insert a Pair.
+		/// </summary>
+		/// <param name="args">Argument list used to construct the element.</param>
+		/// <returns>As a pair, an Iterator to the entry matching the TKey value and a boolean indicating successful insertion.</returns>
+		/// <typeparam name="Args">Variadic list for constructor arguments.</typeparam>
+		template<typename... Args>
+		std::pair<Iterator, bool> Emplace(Args&&... args);
+
+		/// <summary>
+		/// Attempts to construct and insert a Pair. The TData value is only constructed if the key is not found.
+		/// </summary>
+		/// <param name="key">Key of the Pair attempting to be inserted.</param>
+		/// <param name="args">Argument list used to construct the element.</param>
+		/// <returns>As a pair, an Iterator to the entry matching the TKey value and a boolean indicating successful insertion.</returns>
+		/// <typeparam name="Args">Variadic list for constructor arguments.</typeparam>
+		template<typename... Args>
+		std::pair<Iterator, bool> TryEmplace(const TKey& key, Args&&... args);
+
+		/// <summary>
+		/// Attempts to construct and insert a Pair. The TData value is only constructed if the key is not found.
+		/// </summary>
+		/// <param name="key">Key of the Pair attempting to be inserted.</param>
+		/// <param name="args">Argument list used to construct the element.</param>
+		/// <returns>As a pair, an Iterator to the entry matching the TKey value and a boolean indicating successful insertion.</returns>
+		/// <typeparam name="Args">Variadic list for constructor arguments.</typeparam>
+		template<typename Key, typename... Args>
+		auto TryEmplace(Key&& key, Args&&... args) -> std::enable_if_t<std::is_same_v<Key, TKey> && !std::is_reference_v<Key>, std::pair<Iterator, bool>>;
+
+		/// <summary>
+		/// Attempts to insert a Pair.
+		/// </summary>
+		/// <param name="entry">Pair element to be inserted.</param>
+		/// <returns>As a pair, an Iterator to the entry matching the TKey value and a boolean indicating successful insertion.</returns>
+		std::pair<Iterator, bool> Insert(const Pair& entry);
+
+		/// <summary>
+		/// Attempts to insert a Pair.
+		/// </summary>
+		/// <param name="entry">Pair element to be inserted.</param>
+		/// <returns>As a pair, an Iterator to the entry matching the TKey value and a boolean indicating successful insertion.</returns>
+		std::pair<Iterator, bool> Insert(Pair&& entry);
+
+		/// <summary>
+		/// Removes a single Pair value from the FlatHashMap given the corresponding TKey value.
+		/// </summary>
+		/// <param name="key">TKey value to be searched for in the FlatHashMap to be removed.</param>
+		/// <returns>True on successful remove, false otherwise.</returns>
+		bool Remove(const TKey& key);
+
+		/// <summary>
+		/// Removes a single Pair value from the FlatHashMap given an Iterator to it.
+		/// </summary>
+		/// <param name="it">Iterator pointing to the Pair value to be removed.</param>
+		/// <returns>True on successful remove, false otherwise.</returns>
+		bool Remove(const Iterator& it);
+
+		/// <summary>
+		/// Removes all elements from the FlatHashMap and resets the size to zero. Slot count is unchanged.
+		/// </summary>
+		void Clear();
+#pragma endregion Modifiers
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Computes the hash code of a key, then mixes it so that all bits contribute to the probe start and control byte.
+		/// </summary>
+		/// <param name="key">TKey value to be hashed.</param>
+		/// <returns>Mixed hash code.</returns>
+		/// <exception cref="std::runtime_error">HashFunctor null.</exception>
+		std::size_t HashKey(const TKey& key) const;
+
+		/// <summary>
+		/// Searches the slot array for the given key.
+		/// </summary>
+		/// <param name="key">TKey value to search for in the FlatHashMap.</param>
+		/// <param name="hash">Mixed hash code of the key.</param>
+		/// <returns>Index of the slot holding the key, if found. Otherwise the slot count.</returns>
+		/// <exception cref="std::runtime_error">KeyEqualityFunctor null.</exception>
+		std::size_t FindIndex(const TKey& key, const std::size_t hash) const;
+
+		/// <summary>
+		/// Finds a free slot for a new element with the given hash code, growing the FlatHashMap if required.
+		/// Marks the slot as full, the caller must construct the Pair in place.
+		/// </summary>
+		/// <param name="hash">Mixed hash code of the key to be inserted.</param>
+		/// <returns>Index of the slot for the new element.</returns>
+		std::size_t PrepareInsert(const std::size_t hash);
+
+		/// <summary>
+		/// Finds the first empty or deleted slot along the probe sequence of a hash code.
+		/// </summary>
+		/// <param name="hash">Mixed hash code of the key to be inserted.</param>
+		/// <returns>Index of the first free slot in the probe sequence.</returns>
+		std::size_t FindFreeIndex(const std::size_t hash) const;
+
+		/// <summary>
+		/// Reallocates the slot array with the given slot count and reinserts all elements.
+		/// </summary>
+		/// <param name="capacity">New slot count. Must be a power of two, no less than GroupWidth.</param>
+		void Resize(const std::size_t capacity);
+
+		/// <summary>
+		/// Allocates an uninitialized slot array and control byte array, all marked empty.
+		/// </summary>
+		/// <param name="capacity">Slot count. Must be a power of two, no less than GroupWidth.</param>
+		/// <exception cref="std::bad_alloc">Allocation failed.</exception>
+		void Allocate(const std::size_t capacity);
+
+		/// <summary>
+		/// Destroys all elements and frees the slot array.
+		/// </summary>
+		void Release();
+
+		/// <summary>
+		/// Finds the index of the next slot holding a Pair, starting at the given index.
+		/// </summary>
+		/// <param name="index">Index of the first slot to check.</param>
+		/// <returns>Index of the next full slot, or the slot count if there is none.</returns>
+		std::size_t NextFullIndex(std::size_t index) const;
+
+		/// <summary>
+		/// Rounds a requested slot count up to a valid capacity.
+		/// </summary>
+		/// <param name="bucketCount">Requested slot count.</param>
+		/// <returns>Smallest power of two no less than bucketCount and GroupWidth.</returns>
+		static std::size_t NormalizeCapacity(const std::size_t bucketCount);
+
+		/// <summary>
+		/// Gets the number of elements that fit in a given slot count under the maximum load factor.
+		/// </summary>
+		/// <param name="capacity">Slot count.</param>
+		/// <returns>Maximum number of elements before growth.</returns>
+		static std::size_t MaxLoad(const std::size_t capacity);
+
+		/// <summary>
+		/// Compares a group of control bytes against a value.
+		/// </summary>
+		/// <param name="group">Pointer to the first of GroupWidth control bytes.</param>
+		/// <param name="value">Control byte value to match.</param>
+		/// <returns>Bit mask with a bit set for each matching control byte.</returns>
+		static BitMask MatchGroup(const ControlByte* group, const ControlByte value);
+
+		/// <summary>
+		/// Finds the control bytes in a group that are empty or deleted.
+		/// </summary>
+		/// <param name="group">Pointer to the first of GroupWidth control bytes.</param>
+		/// <returns>Bit mask with a bit set for each free control byte.</returns>
+		static BitMask MatchFree(const ControlByte* group);
+
+		/// <summary>
+		/// Gets the index of the lowest set bit in a non-zero BitMask.
+		/// </summary>
+		/// <param name="mask">Non-zero bit mask.</param>
+		/// <returns>Index of the lowest set bit.</returns>
+		static std::size_t LowestBit(const BitMask mask);
+#pragma endregion Helper Methods
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Slot array of Pair values. Only slots with a non-negative control byte hold a constructed Pair.
+		/// </summary>
+		Pair* mSlots{ nullptr };
+
+		/// <summary>
+		/// Control byte array, one per slot. Allocated in the same block as the slot array.
+		/// </summary>
+		ControlByte* mControl{ nullptr };
+
+		/// <summary>
+		/// Number of slots in the FlatHashMap.
+		/// </summary>
+		std::size_t mCapacity{ 0 };
+
+		/// <summary>
+		/// Number of elements in the FlatHashMap.
+		/// </summary>
+		std::size_t mSize{ 0 };
+
+		/// <summary>
+		/// Number of empty slots that may be filled before the FlatHashMap must rehash.
+		/// </summary>
+		std::size_t mGrowthLeft{ 0 };
+
+		/// <summary>
+		/// Equality functor for comparing two TKey values.
+		/// </summary>
+		std::shared_ptr<KeyEqualityFunctor> mKeyEqualityFunctor;
+
+		/// <summary>
+		/// Hash functor used to compute hash code from a TKey.
+		/// </summary>
+		std::shared_ptr<HashFunctor> mHashFunctor;
+#pragma endregion Data Members
+	};
+}
+
+// Inline File
+#include "FlatHashMap.inl"
\ No newline at end of file
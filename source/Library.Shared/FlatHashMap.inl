@@ -0,0 +1,777 @@
+#pragma once
+
+// Header
+#include "FlatHashMap.h"
+
+namespace Library
+{
+#pragma region Iterator
+	template<typename TKey, typename TData>
+	inline FlatHashMap<TKey, TData>::Iterator::Iterator(FlatHashMap& hashMap, const std::size_t index) :
+		mOwner(&hashMap), mIndex(index)
+	{
+	}
+
+	template<typename TKey, typename TData>
+	inline typename FlatHashMap<TKey, TData>::Pair& FlatHashMap<TKey, TData>::Iterator::operator*() const
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::runtime_error("Iterator invalid.");
+		}
+
+		if (mIndex >= mOwner->mCapacity)
+		{
+			throw std::out_of_range("Iterator out of bounds.");
+		}
+
+		return mOwner->mSlots[mIndex];
+	}
+
+	template<typename TKey, typename TData>
+	inline typename FlatHashMap<TKey, TData>::Pair* FlatHashMap<TKey, TData>::Iterator::operator->() const
+	{
+		return &(this->operator*());
+	}
+
+	template<typename TKey, typename TData>
+	inline bool FlatHashMap<TKey, TData>::Iterator::operator==(const Iterator& rhs) const noexcept
+	{
+		return !(operator!=(rhs));
+	}
+
+	template<typename TKey, typename TData>
+	inline bool FlatHashMap<TKey, TData>::Iterator::operator!=(const Iterator& rhs) const noexcept
+	{
+		return (mOwner != rhs.mOwner || mIndex != rhs.mIndex);
+	}
+
+	template<typename TKey, typename TData>
+	inline typename FlatHashMap<TKey, TData>::Iterator& FlatHashMap<TKey, TData>::Iterator::operator++()
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::runtime_error("Iterator invalid.");
+		}
+
+		if (mIndex >= mOwner->mCapacity)
+		{
+			throw std::out_of_range("Iterator out of bounds.");
+		}
+
+		mIndex = mOwner->NextFullIndex(mIndex + 1);
+
+		return *this;
+	}
+
+	template<typename TKey, typename TData>
+	inline typename FlatHashMap<TKey, TData>::Iterator FlatHashMap<TKey, TData>::Iterator::operator++(int)
+	{
+		Iterator it = Iterator(*this);
+		++(*this);
+		return it;
+	}
+#pragma endregion Iterator
+
+#pragma region ConstIterator
+	template<typename TKey, typename TData>
+	inline FlatHashMap<TKey, TData>::ConstIterator::ConstIterator(const Iterator& it) :
+		mOwner(it.mOwner), mIndex(it.mIndex)
+	{
+	}
+
+	template<typename TKey, typename TData>
+	inline FlatHashMap<TKey, TData>::ConstIterator::ConstIterator(const FlatHashMap& hashMap, const std::size_t index) :
+		mOwner(&hashMap), mIndex(index)
+	{
+	}
+
+	template<typename TKey, typename TData>
+	inline const typename FlatHashMap<TKey, TData>::Pair& FlatHashMap<TKey, TData>::ConstIterator::operator*() const
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::runtime_error("ConstIterator invalid.");
+		}
+
+		if (mIndex >= mOwner->mCapacity)
+		{
+			throw std::out_of_range("ConstIterator out of bounds.");
+		}
+
+		return mOwner->mSlots[mIndex];
+	}
+
+	template<typename TKey, typename TData>
+	inline const typename FlatHashMap<TKey, TData>::Pair* FlatHashMap<TKey, TData>::ConstIterator::operator->() const
+	{
+		return &(this->operator*());
+	}
+
+	template<typename TKey, typename TData>
+	inline bool FlatHashMap<TKey, TData>::ConstIterator::operator==(const ConstIterator& rhs) const noexcept
+	{
+		return !(operator!=(rhs));
+	}
+
+	template<typename TKey, typename TData>
+	inline bool FlatHashMap<TKey, TData>::ConstIterator::operator!=(const ConstIterator& rhs) const noexcept
+	{
+		return (mOwner != rhs.mOwner || mIndex != rhs.mIndex);
+	}
+
+	template<typename TKey, typename TData>
+	inline typename FlatHashMap<TKey, TData>::ConstIterator& FlatHashMap<TKey, TData>::ConstIterator::operator++()
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::runtime_error("ConstIterator invalid.");
+		}
+
+		if (mIndex >= mOwner->mCapacity)
+		{
+			throw std::out_of_range("ConstIterator out of bounds.");
+		}
+
+		mIndex = mOwner->NextFullIndex(mIndex + 1);
+
+		return *this;
+	}
+
+	template<typename TKey, typename TData>
+	inline typename FlatHashMap<TKey, TData>::ConstIterator FlatHashMap<TKey, TData>::ConstIterator::operator++(int)
+	{
+		ConstIterator it = ConstIterator(*this);
+		++(*this);
+		return it;
+	}
+#pragma endregion ConstIterator
+
+#pragma region Constructors, Destructor, Assignment
+	template<typename TKey, typename TData>
+	inline FlatHashMap<TKey, TData>::FlatHashMap(const std::size_t bucketCount, const KeyEqualityFunctor& keyEqualityFunctor, const HashFunctor& hashFunctor) :
+		mKeyEqualityFunctor(std::make_shared<KeyEqualityFunctor>(keyEqualityFunctor)), mHashFunctor(std::make_shared<HashFunctor>(hashFunctor))
+	{
+		assert(bucketCount > 0);
+
+		Allocate(NormalizeCapacity(bucketCount));
+	}
+
+	template<typename TKey, typename TData>
+	inline FlatHashMap<TKey, TData>::~FlatHashMap()
+	{
+		Release();
+	}
+
+	template<typename TKey, typename TData>
+	inline FlatHashMap<TKey, TData>::FlatHashMap(const FlatHashMap& rhs) :
+		mKeyEqualityFunctor(rhs.mKeyEqualityFunctor), mHashFunctor(rhs.mHashFunctor)
+	{
+		if (rhs.mCapacity == 0) return;
+
+		Allocate(rhs.mCapacity);
+
+		for (std::size_t i = 0; i < mCapacity; ++i)
+		{
+			if (rhs.mControl[i] >= 0)
+			{
+				new(mSlots + i) Pair(rhs.mSlots[i]);
+				mControl[i] = rhs.mControl[i];
+				++mSize;
+			}
+		}
+
+		mGrowthLeft = rhs.mGrowthLeft;
+	}
+
+	template<typename TKey, typename TData>
+	inline FlatHashMap<TKey, TData>& FlatHashMap<TKey, TData>::operator=(const FlatHashMap& rhs)
+	{
+		if (this != &rhs)
+		{
+			FlatHashMap copy(rhs);
+			*this = std::move(copy);
+		}
+
+		return *this;
+	}
+
+	template<typename TKey, typename TData>
+	inline FlatHashMap<TKey, TData>::FlatHashMap(FlatHashMap&& rhs) noexcept :
+		mSlots(rhs.mSlots), mControl(rhs.mControl), mCapacity(rhs.mCapacity), mSize(rhs.mSize), mGrowthLeft(rhs.mGrowthLeft),
+		mKeyEqualityFunctor(rhs.mKeyEqualityFunctor), mHashFunctor(rhs.mHashFunctor)
+	{
+		rhs.mSlots = nullptr;
+		rhs.mControl = nullptr;
+		rhs.mCapacity = 0;
+		rhs.mSize = 0;
+		rhs.mGrowthLeft = 0;
+	}
+
+	template<typename TKey, typename TData>
+	inline FlatHashMap<TKey, TData>& FlatHashMap<TKey, TData>::operator=(FlatHashMap&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Release();
+
+			mSlots = rhs.mSlots;
+			mControl = rhs.mControl;
+			mCapacity = rhs.mCapacity;
+			mSize = rhs.mSize;
+			mGrowthLeft = rhs.mGrowthLeft;
+			mKeyEqualityFunctor = rhs.mKeyEqualityFunctor;
+			mHashFunctor = rhs.mHashFunctor;
+
+			rhs.mSlots = nullptr;
+			rhs.mControl = nullptr;
+			rhs.mCapacity = 0;
+			rhs.mSize = 0;
+			rhs.mGrowthLeft = 0;
+		}
+
+		return *this;
+	}
+
+	template<typename TKey, typename TData>
+	inline FlatHashMap<TKey, TData>::FlatHashMap(std::initializer_list<Pair> rhs, const std::size_t bucketCount, const KeyEqualityFunctor& keyEqualityFunctor, const HashFunctor& hashFunctor) :
+		FlatHashMap(bucketCount, keyEqualityFunctor, hashFunctor)
+	{
+		for (const auto& pair : rhs)
+		{
+			Emplace(pair);
+		}
+	}
+
+	template<typename TKey, typename TData>
+	inline FlatHashMap<TKey, TData>& FlatHashMap<TKey, TData>::operator=(std::initializer_list<Pair> rhs)
+	{
+		Clear();
+
+		for (const auto& pair : rhs)
+		{
+			Emplace(pair);
+		}
+
+		return *this;
+	}
+#pragma endregion Constructors, Destructor, Assignment
+
+#pragma region Size and Capacity
+	template<typename TKey, typename TData>
+	inline std::size_t FlatHashMap<TKey, TData>::Size() const
+	{
+		return mSize;
+	}
+
+	template<typename TKey, typename TData>
+	inline std::size_t FlatHashMap<TKey, TData>::BucketCount() const
+	{
+		return mCapacity;
+	}
+
+	template<typename TKey, typename TData>
+	inline bool FlatHashMap<TKey, TData>::IsEmpty() const
+	{
+		return mSize == 0;
+	}
+
+	template<typename TKey, typename TData>
+	inline float FlatHashMap<TKey, TData>::LoadFactor() const
+	{
+		return mCapacity > 0 ? static_cast<float>(mSize) / mCapacity : 0.0f;
+	}
+
+	template<typename TKey, typename TData>
+	inline void FlatHashMap<TKey, TData>::Rehash(const std::size_t bucketCount)
+	{
+		std::size_t capacity = NormalizeCapacity(bucketCount);
+
+		while (MaxLoad(capacity) < mSize)
+		{
+			capacity <<= 1;
+		}
+
+		if (capacity == mCapacity) return;
+
+		Resize(capacity);
+	}
+#pragma endregion Size and Capacity
+
+#pragma region Iterator Accessors
+	template<typename TKey, typename TData>
+	inline typename FlatHashMap<TKey, TData>::Iterator FlatHashMap<TKey, TData>::begin()
+	{
+		return Iterator(*this, mSize > 0 ? NextFullIndex(0) : mCapacity);
+	}
+
+	template<typename TKey, typename TData>
+	inline typename FlatHashMap<TKey, TData>::ConstIterator FlatHashMap<TKey, TData>::begin() const
+	{
+		return ConstIterator(*this, mSize > 0 ? NextFullIndex(0) : mCapacity);
+	}
+
+	template<typename TKey, typename TData>
+	inline typename FlatHashMap<TKey, TData>::ConstIterator FlatHashMap<TKey, TData>::cbegin() const
+	{
+		return ConstIterator(*this, mSize > 0 ? NextFullIndex(0) : mCapacity);
+	}
+
+	template<typename TKey, typename TData>
+	inline typename FlatHashMap<TKey, TData>::Iterator FlatHashMap<TKey, TData>::end()
+	{
+		return Iterator(*this, mCapacity);
+	}
+
+	template<typename TKey, typename TData>
+	inline typename FlatHashMap<TKey, TData>::ConstIterator FlatHashMap<TKey, TData>::end() const
+	{
+		return ConstIterator(*this, mCapacity);
+	}
+
+	template<typename TKey, typename TData>
+	inline typename FlatHashMap<TKey, TData>::ConstIterator FlatHashMap<TKey, TData>::cend() const
+	{
+		return ConstIterator(*this, mCapacity);
+	}
+
+	template<typename TKey, typename TData>
+	inline typename FlatHashMap<TKey, TData>::Iterator FlatHashMap<TKey, TData>::Find(const TKey& key)
+	{
+		return Iterator(*this, FindIndex(key, HashKey(key)));
+	}
+
+	template<typename TKey, typename TData>
+	inline typename FlatHashMap<TKey, TData>::ConstIterator FlatHashMap<TKey, TData>::Find(const TKey& key) const
+	{
+		return ConstIterator(*this, FindIndex(key, HashKey(key)));
+	}
+#pragma endregion Iterator Accessors
+
+#pragma region Element Accessors
+	template<typename TKey, typename TData>
+	inline TData& FlatHashMap<TKey, TData>::At(const TKey& key)
+	{
+		const std::size_t index = FindIndex(key, HashKey(key));
+
+		if (index == mCapacity)
+		{
+			throw std::out_of_range("TKey not found.");
+		}
+
+		return mSlots[index].second;
+	}
+
+	template<typename TKey, typename TData>
+	inline const TData& FlatHashMap<TKey, TData>::At(const TKey& key) const
+	{
+		const std::size_t index = FindIndex(key, HashKey(key));
+
+		if (index == mCapacity)
+		{
+			throw std::out_of_range("TKey not found.");
+		}
+
+		return mSlots[index].second;
+	}
+
+	template<typename TKey, typename TData>
+	inline TData& FlatHashMap<TKey, TData>::operator[](const TKey& key)
+	{
+		return TryEmplace(key).first->second;
+	}
+
+	template<typename TKey, typename TData>
+	inline const TData& FlatHashMap<TKey, TData>::operator[](const TKey& key) const
+	{
+		return At(key);
+	}
+
+	template<typename TKey, typename TData>
+	inline bool FlatHashMap<TKey, TData>::ContainsKey(const TKey& key) const
+	{
+		return FindIndex(key, HashKey(key)) != mCapacity;
+	}
+
+	template<typename TKey, typename TData>
+	inline bool FlatHashMap<TKey, TData>::ContainsKey(const TKey& key, TData& dataOut)
+	{
+		const std::size_t index = FindIndex(key, HashKey(key));
+
+		if (index != mCapacity)
+		{
+			dataOut = mSlots[index].second;
+			return true;
+		}
+
+		return false;
+	}
+#pragma endregion Element Accessors
+
+#pragma region Modifiers
+	template<typename TKey, typename TData>
+	template<typename ...Args>
+	inline std::pair<typename FlatHashMap<TKey, TData>::Iterator, bool> FlatHashMap<TKey, TData>::Emplace(Args&& ...args)
+	{
+		auto entry = Pair(std::forward<Args>(args)...);
+
+		const std::size_t hash = HashKey(entry.first);
+		std::size_t index = FindIndex(entry.first, hash);
+
+		const bool alreadyExists = index != mCapacity;
+
+		if (!alreadyExists)
+		{
+			index = PrepareInsert(hash);
+			new(mSlots + index) Pair(std::move(entry));
+			mControl[index] = static_cast<ControlByte>(hash & 0x7F);
+			++mSize;
+		}
+
+		return { Iterator(*this, index), !alreadyExists };
+	}
+
+	template<typename TKey, typename TData>
+	template<typename ...Args>
+	inline std::pair<typename FlatHashMap<TKey, TData>::Iterator, bool> FlatHashMap<TKey, TData>::TryEmplace(const TKey& key, Args&&... args)
+	{
+		const std::size_t hash = HashKey(key);
+		std::size_t index = FindIndex(key, hash);
+
+		const bool alreadyExists = index != mCapacity;
+
+		if (!alreadyExists)
+		{
+			index = PrepareInsert(hash);
+			new(mSlots + index) Pair(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+			mControl[index] = static_cast<ControlByte>(hash & 0x7F);
+			++mSize;
+		}
+
+		return { Iterator(*this, index), !alreadyExists };
+	}
+
+	template<typename TKey, typename TData>
+	template<typename Key, typename ...Args>
+	inline auto FlatHashMap<TKey, TData>::TryEmplace(Key&& key, Args&&... args) -> std::enable_if_t<std::is_same_v<Key, TKey> && !std::is_reference_v<Key>, std::pair<typename FlatHashMap<TKey, TData>::Iterator, bool>>
+	{
+		const std::size_t hash = HashKey(key);
+		std::size_t index = FindIndex(key, hash);
+
+		const bool alreadyExists = index != mCapacity;
+
+		if (!alreadyExists)
+		{
+			index = PrepareInsert(hash);
+			new(mSlots + index) Pair(std::piecewise_construct, std::forward_as_tuple(std::forward<Key>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+			mControl[index] = static_cast<ControlByte>(hash & 0x7F);
+			++mSize;
+		}
+
+		return { Iterator(*this, index), !alreadyExists };
+	}
+
+	template<typename TKey, typename TData>
+	inline std::pair<typename FlatHashMap<TKey, TData>::Iterator, bool> FlatHashMap<TKey, TData>::Insert(const Pair& entry)
+	{
+		return TryEmplace(entry.first, entry.second);
+	}
+
+	template<typename TKey, typename TData>
+	inline std::pair<typename FlatHashMap<TKey, TData>::Iterator, bool> FlatHashMap<TKey, TData>::Insert(Pair&& entry)
+	{
+		return Emplace(std::move(entry));
+	}
+
+	template<typename TKey, typename TData>
+	inline bool FlatHashMap<TKey, TData>::Remove(const TKey& key)
+	{
+		return Remove(Find(key));
+	}
+
+	template<typename TKey, typename TData>
+	inline bool FlatHashMap<TKey, TData>::Remove(const Iterator& it)
+	{
+		if (it.mOwner != this || it.mIndex >= mCapacity || mControl[it.mIndex] < 0) return false;
+
+		const std::size_t index = it.mIndex;
+		mSlots[index].~Pair();
+		--mSize;
+
+		// Probing only continues past groups without an empty slot. If this group still has one, no probe sequence
+		// could have passed through it, so the slot can be reused as empty rather than left as a tombstone.
+		const ControlByte* group = mControl + (index & ~(GroupWidth - 1));
+
+		if (MatchGroup(group, Empty) != 0)
+		{
+			mControl[index] = Empty;
+			++mGrowthLeft;
+		}
+		else
+		{
+			mControl[index] = Deleted;
+		}
+
+		return true;
+	}
+
+	template<typename TKey, typename TData>
+	inline void FlatHashMap<TKey, TData>::Clear()
+	{
+		for (std::size_t i = 0; i < mCapacity; ++i)
+		{
+			if (mControl[i] >= 0)
+			{
+				mSlots[i].~Pair();
+			}
+		}
+
+		if (mCapacity > 0)
+		{
+			std::memset(mControl, Empty, mCapacity);
+		}
+
+		mSize = 0;
+		mGrowthLeft = MaxLoad(mCapacity);
+	}
+#pragma endregion Modifiers
+
+#pragma region Helper Methods
+	template<typename TKey, typename TData>
+	inline std::size_t FlatHashMap<TKey, TData>::HashKey(const TKey& key) const
+	{
+		if (!mHashFunctor || !*mHashFunctor)
+		{
+			throw std::runtime_error("HashFunctor null.");
+		}
+
+		// Fibonacci hashing, so weak hash codes such as identity integers still spread across groups and control bytes.
+		std::uint64_t hash = static_cast<std::uint64_t>(mHashFunctor->operator()(key)) * 0x9E3779B97F4A7C15ull;
+		hash ^= hash >> 32;
+
+		return static_cast<std::size_t>(hash);
+	}
+
+	template<typename TKey, typename TData>
+	inline std::size_t FlatHashMap<TKey, TData>::FindIndex(const TKey& key, const std::size_t hash) const
+	{
+		if (!mKeyEqualityFunctor || !*mKeyEqualityFunctor)
+		{
+			throw std::runtime_error("KeyEqualityFunctor null.");
+		}
+
+		if (mSize == 0) return mCapacity;
+
+		const ControlByte tag = static_cast<ControlByte>(hash & 0x7F);
+		const std::size_t groupMask = (mCapacity / GroupWidth) - 1;
+		std::size_t group = (hash >> 7) & groupMask;
+
+		for (std::size_t probe = 1; probe <= groupMask + 1; ++probe)
+		{
+			const ControlByte* control = mControl + group * GroupWidth;
+
+			for (BitMask match = MatchGroup(control, tag); match != 0; match &= match - 1)
+			{
+				const std::size_t index = group * GroupWidth + LowestBit(match);
+
+				if (mKeyEqualityFunctor->operator()(key, mSlots[index].first))
+				{
+					return index;
+				}
+			}
+
+			if (MatchGroup(control, Empty) != 0) break;
+
+			group = (group + probe) & groupMask;
+		}
+
+		return mCapacity;
+	}
+
+	template<typename TKey, typename TData>
+	inline std::size_t FlatHashMap<TKey, TData>::PrepareInsert(const std::size_t hash)
+	{
+		if (mCapacity == 0)
+		{
+			Allocate(DefaultBucketCount);
+		}
+
+		std::size_t index = FindFreeIndex(hash);
+
+		if (mGrowthLeft == 0 && mControl[index] == Empty)
+		{
+			// Reclaims tombstones in place when they make up most of the load, otherwise doubles the slot count.
+			Resize(mSize < MaxLoad(mCapacity) / 2 ? mCapacity : mCapacity << 1);
+			index = FindFreeIndex(hash);
+		}
+
+		if (mControl[index] == Empty)
+		{
+			--mGrowthLeft;
+		}
+
+		return index;
+	}
+
+	template<typename TKey, typename TData>
+	inline std::size_t FlatHashMap<TKey, TData>::FindFreeIndex(const std::size_t hash) const
+	{
+		const std::size_t groupMask = (mCapacity / GroupWidth) - 1;
+		std::size_t group = (hash >> 7) & groupMask;
+
+		for (std::size_t probe = 1;; ++probe)
+		{
+			const BitMask free = MatchFree(mControl + group * GroupWidth);
+
+			if (free != 0)
+			{
+				return group * GroupWidth + LowestBit(free);
+			}
+
+			group = (group + probe) & groupMask;
+		}
+	}
+
+	template<typename TKey, typename TData>
+	inline void FlatHashMap<TKey, TData>::Resize(const std::size_t capacity)
+	{
+		Pair* oldSlots = mSlots;
+		ControlByte* oldControl = mControl;
+		const std::size_t oldCapacity = mCapacity;
+
+		Allocate(capacity);
+
+		for (std::size_t i = 0; i < oldCapacity; ++i)
+		{
+			if (oldControl[i] >= 0)
+			{
+				const std::size_t hash = HashKey(oldSlots[i].first);
+				const std::size_t index = FindFreeIndex(hash);
+
+				new(mSlots + index) Pair(std::move(oldSlots[i]));
+				mControl[index] = static_cast<ControlByte>(hash & 0x7F);
+				oldSlots[i].~Pair();
+			}
+		}
+
+		mGrowthLeft -= mSize;
+
+		free(oldSlots);
+	}
+
+	template<typename TKey, typename TData>
+	inline void FlatHashMap<TKey, TData>::Allocate(const std::size_t capacity)
+	{
+		void* memory = malloc(capacity * (sizeof(Pair) + sizeof(ControlByte)));
+		if (!memory) throw std::bad_alloc();
+
+		mSlots = static_cast<Pair*>(memory);
+		mControl = reinterpret_cast<ControlByte*>(mSlots + capacity);
+		mCapacity = capacity;
+		mGrowthLeft = MaxLoad(capacity);
+
+		std::memset(mControl, Empty, capacity);
+	}
+
+	template<typename TKey, typename TData>
+	inline void FlatHashMap<TKey, TData>::Release()
+	{
+		if (mSlots == nullptr) return;
+
+		for (std::size_t i = 0; i < mCapacity; ++i)
+		{
+			if (mControl[i] >= 0)
+			{
+				mSlots[i].~Pair();
+			}
+		}
+
+		free(mSlots);
+
+		mSlots = nullptr;
+		mControl = nullptr;
+		mCapacity = 0;
+		mSize = 0;
+		mGrowthLeft = 0;
+	}
+
+	template<typename TKey, typename TData>
+	inline std::size_t FlatHashMap<TKey, TData>::NextFullIndex(std::size_t index) const
+	{
+		while (index < mCapacity && mControl[index] < 0)
+		{
+			++index;
+		}
+
+		return index;
+	}
+
+	template<typename TKey, typename TData>
+	inline std::size_t FlatHashMap<TKey, TData>::NormalizeCapacity(const std::size_t bucketCount)
+	{
+		std::size_t capacity = GroupWidth;
+
+		while (capacity < bucketCount)
+		{
+			capacity <<= 1;
+		}
+
+		return capacity;
+	}
+
+	template<typename TKey, typename TData>
+	inline std::size_t FlatHashMap<TKey, TData>::MaxLoad(const std::size_t capacity)
+	{
+		return capacity / MaxLoadDenominator * MaxLoadNumerator;
+	}
+
+	template<typename TKey, typename TData>
+	inline typename FlatHashMap<TKey, TData>::BitMask FlatHashMap<TKey, TData>::MatchGroup(const ControlByte* group, const ControlByte value)
+	{
+#ifdef FLATHASHMAP_SSE2
+		const __m128i control = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+		return static_cast<BitMask>(_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8(value))));
+#else
+		BitMask mask = 0;
+
+		for (std::size_t i = 0; i < GroupWidth; ++i)
+		{
+			mask |= static_cast<BitMask>(group[i] == value) << i;
+		}
+
+		return mask;
+#endif
+	}
+
+	template<typename TKey, typename TData>
+	inline typename FlatHashMap<TKey, TData>::BitMask FlatHashMap<TKey, TData>::MatchFree(const ControlByte* group)
+	{
+#ifdef FLATHASHMAP_SSE2
+		// Empty and Deleted are the only control values with the sign bit set.
+		const __m128i control = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+		return static_cast<BitMask>(_mm_movemask_epi8(control));
+#else
+		BitMask mask = 0;
+
+		for (std::size_t i = 0; i < GroupWidth; ++i)
+		{
+			mask |= static_cast<BitMask>(group[i] < 0) << i;
+		}
+
+		return mask;
+#endif
+	}
+
+	template<typename TKey, typename TData>
+	inline std::size_t FlatHashMap<TKey, TData>::LowestBit(const BitMask mask)
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return static_cast<std::size_t>(index);
+#else
+		return static_cast<std::size_t>(__builtin_ctz(mask));
+#endif
+	}
+#pragma endregion Helper Methods
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "FrameAllocator.h"
+#pragma endregion Includes
+
+namespace Library
+{
+#pragma region Special Members
+	FrameAllocator::FrameAllocator(const std::size_t capacity) :
+		mCapacity(capacity)
+	{
+	}
+
+	FrameAllocator::~FrameAllocator()
+	{
+		Reset();
+
+		std::free(mBuffer);
+		mBuffer = nullptr;
+	}
+#pragma endregion Special Members
+
+#pragma region Accessors
+	std::size_t FrameAllocator::Capacity() const
+	{
+		return mCapacity;
+	}
+
+	std::size_t FrameAllocator::Size() const
+	{
+		return mOffset + mOverflowSize;
+	}
+#pragma endregion Accessors
+
+#pragma region IAllocator Overrides
+	void* FrameAllocator::Allocate(const std::size_t size, const std::size_t alignment)
+	{
+		assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+		if (mBuffer == nullptr)
+		{
+			mBuffer = static_cast<std::byte*>(std::malloc(mCapacity));
+			if (!mBuffer) throw std::bad_alloc();
+		}
+
+		const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(mBuffer);
+		const std::size_t offset = ((base + mOffset + alignment - 1) & ~(alignment - 1)) - base;
+
+		if (offset + size > mCapacity)
+		{
+			return AllocateOverflow(size, alignment);
+		}
+
+		mLastOffset = offset;
+		mOffset = offset + size;
+
+		return mBuffer + offset;
+	}
+
+	void* FrameAllocator::Reallocate(void* memory, const std::size_t size, const std::size_t newSize, const std::size_t alignment)
+	{
+		if (memory == nullptr)
+		{
+			return Allocate(newSize, alignment);
+		}
+
+		if (memory == mBuffer + mLastOffset && mLastOffset + newSize <= mCapacity)
+		{
+			mOffset = mLastOffset + newSize;
+			return memory;
+		}
+
+		if (newSize <= size)
+		{
+			return memory;
+		}
+
+		void* newMemory = Allocate(newSize, alignment);
+		std::memcpy(newMemory, memory, size);
+
+		return newMemory;
+	}
+
+	void FrameAllocator::Deallocate(void* memory, const std::size_t)
+	{
+		if (memory != nullptr && memory == mBuffer + mLastOffset)
+		{
+			mOffset = mLastOffset;
+		}
+	}
+#pragma endregion IAllocator Overrides
+
+#pragma region Modifiers
+	void FrameAllocator::Reset()
+	{
+		if (mOverflowBlocks != nullptr)
+		{
+			while (mOverflowBlocks != nullptr)
+			{
+				OverflowBlock* next = mOverflowBlocks->Next;
+				std::free(mOverflowBlocks);
+				mOverflowBlocks = next;
+			}
+
+			const std::size_t frameSize = mOffset + mOverflowSize;
+
+			if (mCapacity < frameSize)
+			{
+				mCapacity = std::max(mCapacity * 2, frameSize);
+			}
+
+			std::free(mBuffer);
+			mBuffer = nullptr;
+		}
+
+		mOffset = 0;
+		mLastOffset = 0;
+		mOverflowSize = 0;
+	}
+#pragma endregion Modifiers
+
+#pragma region Helper Methods
+	void* FrameAllocator::AllocateOverflow(const std::size_t size, const std::size_t alignment)
+	{
+		const std::size_t blockSize = sizeof(OverflowBlock) + alignment + size;
+
+		OverflowBlock* block = static_cast<OverflowBlock*>(std::malloc(blockSize));
+		if (!block) throw std::bad_alloc();
+
+		block->Next = mOverflowBlocks;
+		mOverflowBlocks = block;
+		mOverflowSize += blockSize;
+
+		const std::uintptr_t data = reinterpret_cast<std::uintptr_t>(block + 1);
+		return reinterpret_cast<void*>((data + alignment - 1) & ~(alignment - 1));
+	}
+#pragma endregion Helper Methods
+}
\ No newline at end of file
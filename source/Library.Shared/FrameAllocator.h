@@ -0,0 +1,147 @@
+#pragma once
+
+#pragma region Includes
+// First Party
+#include "IAllocator.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Linear arena allocator for memory that only lives until the end of a frame.
+	/// Allocations bump an offset into a single buffer and are released all at once by Reset.
+	/// When the buffer is exhausted, overflow blocks are taken from the heap and the buffer grows to fit on the next Reset.
+	/// </summary>
+	/// <remarks>Not thread safe. All memory from the allocator is invalid after Reset.</remarks>
+	class FrameAllocator final : public IAllocator
+	{
+#pragma region Type Definitions and Constants
+	public:
+		/// <summary>
+		/// Default size in bytes of the arena buffer.
+		/// </summary>
+		static constexpr std::size_t DefaultCapacity = 65536;
+
+	private:
+		/// <summary>
+		/// Header of a heap block used after the arena buffer is exhausted.
+		/// </summary>
+		struct OverflowBlock final
+		{
+			OverflowBlock* Next;
+		};
+#pragma endregion Type Definitions and Constants
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Specialized constructor. The arena buffer is allocated on first use.
+		/// </summary>
+		/// <param name="capacity">Size in bytes of the arena buffer.</param>
+		explicit FrameAllocator(const std::size_t capacity=DefaultCapacity);
+
+		/// <summary>
+		/// Destructor. Releases the arena buffer and any overflow blocks.
+		/// </summary>
+		~FrameAllocator();
+#pragma endregion Special Members
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the size in bytes of the arena buffer.
+		/// </summary>
+		/// <returns>Size of the arena buffer.</returns>
+		std::size_t Capacity() const;
+
+		/// <summary>
+		/// Gets the number of bytes allocated since the last Reset, including alignment padding and overflow blocks.
+		/// </summary>
+		/// <returns>Number of bytes allocated.</returns>
+		std::size_t Size() const;
+#pragma endregion Accessors
+
+#pragma region IAllocator Overrides
+	public:
+		/// <summary>
+		/// Allocates a block of memory from the arena.
+		/// </summary>
+		/// <param name="size">Size of the block in bytes.</param>
+		/// <param name="alignment">Required alignment of the block, a power of two.</param>
+		/// <returns>Pointer to the block.</returns>
+		/// <exception cref="std::bad_alloc">Allocation failed.</exception>
+		virtual void* Allocate(const std::size_t size, const std::size_t alignment=alignof(std::max_align_t)) override;
+
+		/// <summary>
+		/// Resizes a block of memory. The most recent allocation is resized in place when it fits.
+		/// </summary>
+		/// <param name="memory">Block to be resized, or null to allocate a new block.</param>
+		/// <param name="size">Current size of the block in bytes.</param>
+		/// <param name="newSize">Requested size of the block in bytes.</param>
+		/// <param name="alignment">Required alignment of the block, a power of two.</param>
+		/// <returns>Pointer to the resized block.</returns>
+		/// <exception cref="std::bad_alloc">Allocation failed.</exception>
+		virtual void* Reallocate(void* memory, const std::size_t size, const std::size_t newSize, const std::size_t alignment=alignof(std::max_align_t)) override;
+
+		/// <summary>
+		/// Returns a block of memory to the arena. Only the most recent allocation is reclaimed before Reset.
+		/// </summary>
+		/// <param name="memory">Block to be returned. May be null.</param>
+		/// <param name="size">Size of the block in bytes.</param>
+		virtual void Deallocate(void* memory, const std::size_t size) override;
+#pragma endregion IAllocator Overrides
+
+#pragma region Modifiers
+	public:
+		/// <summary>
+		/// Releases all allocations. If the previous frame overflowed, the arena buffer grows to fit it.
+		/// </summary>
+		void Reset();
+#pragma endregion Modifiers
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Allocates a heap block to serve an allocation that does not fit in the arena buffer.
+		/// </summary>
+		/// <param name="size">Size of the allocation in bytes.</param>
+		/// <param name="alignment">Required alignment of the allocation.</param>
+		/// <returns>Pointer to the allocation.</returns>
+		/// <exception cref="std::bad_alloc">Allocation failed.</exception>
+		void* AllocateOverflow(const std::size_t size, const std::size_t alignment);
+#pragma endregion Helper Methods
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Arena buffer, or null until the first allocation.
+		/// </summary>
+		std::byte* mBuffer{ nullptr };
+
+		/// <summary>
+		/// Size in bytes of the arena buffer.
+		/// </summary>
+		std::size_t mCapacity;
+
+		/// <summary>
+		/// Offset of the first unused byte in the arena buffer.
+		/// </summary>
+		std::size_t mOffset{ 0 };
+
+		/// <summary>
+		/// Offset in the arena buffer of the most recent allocation, used to resize or reclaim it.
+		/// </summary>
+		std::size_t mLastOffset{ 0 };
+
+		/// <summary>
+		/// Number of bytes taken by overflow blocks since the last Reset.
+		/// </summary>
+		std::size_t mOverflowSize{ 0 };
+
+		/// <summary>
+		/// List of overflow blocks allocated since the last Reset.
+		/// </summary>
+		OverflowBlock* mOverflowBlocks{ nullptr };
+#pragma endregion Data Members
+	};
+}
\ No newline at end of file
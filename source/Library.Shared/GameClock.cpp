@@ -42,4 +42,14 @@ namespace Library
 		gameTime.SetElapsedGameTime(duration_cast<milliseconds>(mCurrentTime - mLastTime));
         mLastTime = mCurrentTime;
     }
+
+	void GameClock::AdvanceGameTime(GameTime& gameTime, const high_resolution_clock::duration& step)
+	{
+		mCurrentTime += step;
+
+		gameTime.SetCurrentTime(mCurrentTime);
+		gameTime.SetTotalGameTime(duration_cast<milliseconds>(mCurrentTime - mStartTime));
+		gameTime.SetElapsedGameTime(duration_cast<milliseconds>(step));
+		mLastTime = mCurrentTime;
+	}
 }
\ No newline at end of file
@@ -22,6 +22,7 @@ namespace Library
 
 		void Reset();
 		void UpdateGameTime(GameTime& gameTime);
+		void AdvanceGameTime(GameTime& gameTime, const std::chrono::high_resolution_clock::duration& step);
 
 	private:
 		std::chrono::high_resolution_clock::time_point mStartTime;
@@ -481,6 +481,26 @@ namespace Library
 		/// <param name="key">TKey value to search for in the HashMap.</param>
 		/// <returns>constIterator referencing the value, if found. Otherwise it returns a ConstIterator to the end.</returns>
 		ConstIterator Find(const TKey& key) const;
+
+		/// <summary>
+		/// Searches the HashMap for a key equal to the given value, using a precomputed hash code.
+		/// Skips both the HashFunctor and KeyEqualityFunctor, for keys whose hash code is known ahead of time.
+		/// </summary>
+		/// <param name="key">Value comparable to a TKey through operator==.</param>
+		/// <param name="hashCode">Hash code of the key, equal to the HashFunctor result for an equal TKey.</param>
+		/// <returns>Iterator referencing the value, if found. Otherwise it returns an Iterator to the end.</returns>
+		template<typename TKeyView>
+		Iterator FindHashed(const TKeyView& key, const std::size_t hashCode);
+
+		/// <summary>
+		/// Searches the HashMap for a key equal to the given value, using a precomputed hash code.
+		/// Skips both the HashFunctor and KeyEqualityFunctor, for keys whose hash code is known ahead of time.
+		/// </summary>
+		/// <param name="key">Value comparable to a TKey through operator==.</param>
+		/// <param name="hashCode">Hash code of the key, equal to the HashFunctor result for an equal TKey.</param>
+		/// <returns>ConstIterator referencing the value, if found. Otherwise it returns a ConstIterator to the end.</returns>
+		template<typename TKeyView>
+		ConstIterator FindHashed(const TKeyView& key, const std::size_t hashCode) const;
 #pragma endregion Iterator Accessors
 
 #pragma region Element Accessors
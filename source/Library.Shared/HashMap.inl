@@ -338,6 +338,31 @@ namespace Library
 		std::size_t index;
 		return ConstIterator(const_cast<HashMap<TKey, TData>*>(this)->Find(key, index));
 	}
+
+	template<typename TKey, typename TData>
+	template<typename TKeyView>
+	inline typename HashMap<TKey, TData>::Iterator HashMap<TKey, TData>::FindHashed(const TKeyView& key, const std::size_t hashCode)
+	{
+		const std::size_t index = hashCode % mBuckets.Capacity();
+		Chain& chain = mBuckets[index];
+
+		for (ChainIterator chainIterator = chain.begin(); chainIterator != chain.end(); ++chainIterator)
+		{
+			if (chainIterator->first == key)
+			{
+				return Iterator(*this, mBuckets.begin() + index, chainIterator);
+			}
+		}
+
+		return end();
+	}
+
+	template<typename TKey, typename TData>
+	template<typename TKeyView>
+	inline typename HashMap<TKey, TData>::ConstIterator HashMap<TKey, TData>::FindHashed(const TKeyView& key, const std::size_t hashCode) const
+	{
+		return ConstIterator(const_cast<HashMap<TKey, TData>*>(this)->FindHashed(key, hashCode));
+	}
 #pragma endregion Iterator Accessors
 
 #pragma region Element Accessors
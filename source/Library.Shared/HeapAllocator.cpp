@@ -0,0 +1,47 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "HeapAllocator.h"
+#pragma endregion Includes
+
+namespace Library
+{
+#pragma region Instance
+	HeapAllocator& HeapAllocator::Instance()
+	{
+		static HeapAllocator instance;
+		return instance;
+	}
+#pragma endregion Instance
+
+#pragma region IAllocator Overrides
+	void* HeapAllocator::Allocate(const std::size_t size, const std::size_t)
+	{
+		void* memory = std::malloc(size);
+		if (!memory && size > 0) throw std::bad_alloc();
+
+		return memory;
+	}
+
+	void* HeapAllocator::Reallocate(void* memory, const std::size_t, const std::size_t newSize, const std::size_t)
+	{
+		if (newSize == 0)
+		{
+			std::free(memory);
+			return nullptr;
+		}
+
+		void* newMemory = std::realloc(memory, newSize);
+		if (!newMemory) throw std::bad_alloc();
+
+		return newMemory;
+	}
+
+	void HeapAllocator::Deallocate(void* memory, const std::size_t)
+	{
+		std::free(memory);
+	}
+#pragma endregion IAllocator Overrides
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+
+#pragma region Includes
+// First Party
+#include "IAllocator.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Allocator that forwards to the global heap through malloc, realloc, and free.
+	/// This is the default allocator for containers.
+	/// </summary>
+	class HeapAllocator final : public IAllocator
+	{
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Default constructor.
+		/// </summary>
+		HeapAllocator() = default;
+
+		/// <summary>
+		/// Default destructor.
+		/// </summary>
+		~HeapAllocator() = default;
+#pragma endregion Special Members
+
+#pragma region Instance
+	public:
+		/// <summary>
+		/// Gets the shared HeapAllocator instance.
+		/// </summary>
+		/// <returns>Reference to the shared HeapAllocator.</returns>
+		static HeapAllocator& Instance();
+#pragma endregion Instance
+
+#pragma region IAllocator Overrides
+	public:
+		/// <summary>
+		/// Allocates a block of memory with malloc.
+		/// </summary>
+		/// <param name="size">Size of the block in bytes.</param>
+		/// <param name="alignment">Required alignment of the block. Must not exceed the alignment of std::max_align_t.</param>
+		/// <returns>Pointer to the block.</returns>
+		/// <exception cref="std::bad_alloc">Allocation failed.</exception>
+		virtual void* Allocate(const std::size_t size, const std::size_t alignment=alignof(std::max_align_t)) override;
+
+		/// <summary>
+		/// Resizes a block of memory with realloc.
+		/// </summary>
+		/// <param name="memory">Block to be resized, or null to allocate a new block.</param>
+		/// <param name="size">Current size of the block in bytes.</param>
+		/// <param name="newSize">Requested size of the block in bytes. A size of zero frees the block and returns null.</param>
+		/// <param name="alignment">Required alignment of the block. Must not exceed the alignment of std::max_align_t.</param>
+		/// <returns>Pointer to the resized block.</returns>
+		/// <exception cref="std::bad_alloc">Allocation failed.</exception>
+		virtual void* Reallocate(void* memory, const std::size_t size, const std::size_t newSize, const std::size_t alignment=alignof(std::max_align_t)) override;
+
+		/// <summary>
+		/// Frees a block of memory.
+		/// </summary>
+		/// <param name="memory">Block to be freed. May be null.</param>
+		/// <param name="size">Size of the block in bytes.</param>
+		virtual void Deallocate(void* memory, const std::size_t size) override;
+#pragma endregion IAllocator Overrides
+	};
+}
\ No newline at end of file
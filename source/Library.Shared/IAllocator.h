@@ -0,0 +1,81 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <cstddef>
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Allocator interface class for raw memory used by containers.
+	/// Memory returned by an allocator must be returned to the same allocator.
+	/// </summary>
+	class IAllocator
+	{
+#pragma region Special Member Functions
+	protected:
+		/// <summary>
+		/// Default constructor.
+		/// </summary>
+		IAllocator() = default;
+
+	public:
+		/// <summary>
+		/// Virtual default destructor.
+		/// </summary>
+		virtual ~IAllocator() = default;
+
+		/// <summary>
+		/// Copy constructor.
+		/// </summary>
+		IAllocator(const IAllocator&) = delete;
+
+		/// <summary>
+		/// Copy assignment operator.
+		/// </summary>
+		IAllocator& operator=(const IAllocator&) = delete;
+
+		/// <summary>
+		/// Move constructor.
+		/// </summary>
+		IAllocator(IAllocator&&) noexcept = delete;
+
+		/// <summary>
+		/// Move assignment operator.
+		/// </summary>
+		IAllocator& operator=(IAllocator&&) noexcept = delete;
+#pragma endregion Special Member Functions
+
+#pragma region Virtual Methods
+	public:
+		/// <summary>
+		/// Allocates a block of memory.
+		/// </summary>
+		/// <param name="size">Size of the block in bytes.</param>
+		/// <param name="alignment">Required alignment of the block.</param>
+		/// <returns>Pointer to the block.</returns>
+		/// <exception cref="std::bad_alloc">Allocation failed.</exception>
+		virtual void* Allocate(const std::size_t size, const std::size_t alignment=alignof(std::max_align_t)) = 0;
+
+		/// <summary>
+		/// Resizes a block of memory, preserving its contents up to the smaller of the two sizes.
+		/// The contents may be moved with a bitwise copy.
+		/// </summary>
+		/// <param name="memory">Block to be resized, or null to allocate a new block.</param>
+		/// <param name="size">Current size of the block in bytes.</param>
+		/// <param name="newSize">Requested size of the block in bytes.</param>
+		/// <param name="alignment">Required alignment of the block.</param>
+		/// <returns>Pointer to the resized block.</returns>
+		/// <exception cref="std::bad_alloc">Allocation failed.</exception>
+		virtual void* Reallocate(void* memory, const std::size_t size, const std::size_t newSize, const std::size_t alignment=alignof(std::max_align_t)) = 0;
+
+		/// <summary>
+		/// Returns a block of memory to the allocator.
+		/// </summary>
+		/// <param name="memory">Block to be returned. May be null.</param>
+		/// <param name="size">Size of the block in bytes.</param>
+		virtual void Deallocate(void* memory, const std::size_t size) = 0;
+#pragma endregion Virtual Methods
+	};
+}
\ No newline at end of file
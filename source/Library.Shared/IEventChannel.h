@@ -0,0 +1,58 @@
+#pragma once
+
+namespace Library
+{
+	/// <summary>
+	/// Interface for batched message channels flushed once per frame, such as EventChannel.
+	/// Lets a World flush channels of any message type.
+	/// </summary>
+	class IEventChannel
+	{
+#pragma region Special Member Functions
+	public:
+		/// <summary>
+		/// Virtual default destructor.
+		/// </summary>
+		virtual ~IEventChannel() = default;
+
+	protected:
+		/// <summary>
+		/// Default constructor.
+		/// </summary>
+		IEventChannel() = default;
+
+		/// <summary>
+		/// Copy constructor.
+		/// </summary>
+		IEventChannel(const IEventChannel&) = default;
+
+		/// <summary>
+		/// Copy assignment operator.
+		/// </summary>
+		IEventChannel& operator=(const IEventChannel&) = default;
+
+		/// <summary>
+		/// Move constructor.
+		/// </summary>
+		IEventChannel(IEventChannel&&) noexcept = default;
+
+		/// <summary>
+		/// Move assignment operator.
+		/// </summary>
+		IEventChannel& operator=(IEventChannel&&) noexcept = default;
+#pragma endregion Special Member Functions
+
+#pragma region Channel Interface
+	public:
+		/// <summary>
+		/// Delivers every message published since the last Flush to the subscribers, as a single batch.
+		/// </summary>
+		virtual void Flush() = 0;
+
+		/// <summary>
+		/// Discards every message published since the last Flush.
+		/// </summary>
+		virtual void Clear() = 0;
+#pragma endregion Channel Interface
+	};
+}
\ No newline at end of file
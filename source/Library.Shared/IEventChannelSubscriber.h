@@ -0,0 +1,67 @@
+#pragma once
+
+#pragma region Includes
+// Third Party
+#include <gsl/span>
+#pragma endregion Includes
+
+namespace Library
+{
+	// Forward Declarations
+	template<typename MessageT>
+	class EventChannel;
+
+	/// <summary>
+	/// Interface for classes that intend to subscribe to an EventChannel.
+	/// </summary>
+	/// <typeparam name="MessageT">Message type carried by the EventChannel.</typeparam>
+	template<typename MessageT>
+	class IEventChannelSubscriber
+	{
+		friend EventChannel<MessageT>;
+
+#pragma region Special Member Functions
+	public:
+		/// <summary>
+		/// Virtual default destructor.
+		/// </summary>
+		virtual ~IEventChannelSubscriber() = default;
+
+	protected:
+		/// <summary>
+		/// Default constructor.
+		/// </summary>
+		IEventChannelSubscriber() = default;
+
+		/// <summary>
+		/// Copy constructor.
+		/// </summary>
+		IEventChannelSubscriber(const IEventChannelSubscriber&) = default;
+
+		/// <summary>
+		/// Copy assignment operator.
+		/// </summary>
+		IEventChannelSubscriber& operator=(const IEventChannelSubscriber&) = default;
+
+		/// <summary>
+		/// Move constructor.
+		/// </summary>
+		IEventChannelSubscriber(IEventChannelSubscriber&&) noexcept = default;
+
+		/// <summary>
+		/// Move assignment operator.
+		/// </summary>
+		IEventChannelSubscriber& operator=(IEventChannelSubscriber&&) noexcept = default;
+#pragma endregion Special Member Functions
+
+#pragma region Event Notification
+	protected:
+		/// <summary>
+		/// Pure virtual method called once per Flush with every message published since the last Flush.
+		/// Implement to customize the behavior that occurs when the messages are received.
+		/// </summary>
+		/// <param name="messages">Messages in order of publication, valid only for the duration of the call.</param>
+		virtual void Notify(gsl::span<const MessageT> messages)=0;
+#pragma endregion Event Notification
+	};
+}
\ No newline at end of file
@@ -0,0 +1,147 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "JobSystem.h"
+#pragma endregion Includes
+
+namespace Library
+{
+#pragma region Special Members
+	JobSystem::JobSystem(const std::size_t workerCount) :
+		mQueues(std::make_unique<WorkQueue[]>(workerCount + 1)), mQueueCount(workerCount + 1)
+	{
+		mWorkers.Reserve(workerCount);
+
+		for (std::size_t i = 1; i <= workerCount; ++i)
+		{
+			mWorkers.EmplaceBack([this, i] { WorkerLoop(i); });
+		}
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+			mIsRunning = false;
+		}
+
+		mWakeCondition.notify_all();
+
+		for (auto& worker : mWorkers)
+		{
+			worker.join();
+		}
+
+		while (TryRunJob(0));
+	}
+#pragma endregion Special Members
+
+#pragma region Scheduling
+	void JobSystem::Schedule(Job job, Counter& counter)
+	{
+		counter.mPendingCount.fetch_add(1, std::memory_order_relaxed);
+
+		// Counted before it is pushed, so a worker popping it right away never decrements below zero.
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+			++mQueuedCount;
+		}
+
+		WorkQueue& queue = mQueues[QueueIndex()];
+		{
+			std::lock_guard<std::mutex> lock(queue.Mutex);
+			queue.Tasks.push_back({ std::move(job), &counter });
+		}
+
+		mWakeCondition.notify_one();
+	}
+
+	void JobSystem::Wait(Counter& counter)
+	{
+		const std::size_t queueIndex = QueueIndex();
+
+		while (!counter.IsDone())
+		{
+			if (!TryRunJob(queueIndex))
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		if (counter.mHasException.exchange(false))
+		{
+			std::exception_ptr exception = std::move(counter.mException);
+			counter.mException = nullptr;
+			std::rethrow_exception(exception);
+		}
+	}
+#pragma endregion Scheduling
+
+#pragma region Helper Methods
+	bool JobSystem::TryRunJob(const std::size_t queueIndex)
+	{
+		if (mQueuedCount.load(std::memory_order_relaxed) == 0) return false;
+
+		Task task{ nullptr, nullptr };
+
+		for (std::size_t i = 0; i < mQueueCount && task.Tracker == nullptr; ++i)
+		{
+			WorkQueue& queue = mQueues[(queueIndex + i) % mQueueCount];
+			std::lock_guard<std::mutex> lock(queue.Mutex);
+
+			if (!queue.Tasks.empty())
+			{
+				if (i == 0)
+				{
+					task = std::move(queue.Tasks.back());
+					queue.Tasks.pop_back();
+				}
+				else
+				{
+					task = std::move(queue.Tasks.front());
+					queue.Tasks.pop_front();
+				}
+			}
+		}
+
+		if (task.Tracker == nullptr) return false;
+
+		--mQueuedCount;
+
+		try
+		{
+			task.Function();
+		}
+		catch (...)
+		{
+			if (!task.Tracker->mHasException.exchange(true))
+			{
+				task.Tracker->mException = std::current_exception();
+			}
+		}
+
+		task.Tracker->mPendingCount.fetch_sub(1, std::memory_order_release);
+		return true;
+	}
+
+	void JobSystem::WorkerLoop(const std::size_t queueIndex)
+	{
+		sQueueOwner = this;
+		sQueueIndex = queueIndex;
+
+		while (true)
+		{
+			if (TryRunJob(queueIndex)) continue;
+
+			std::unique_lock<std::mutex> lock(mSleepMutex);
+			mWakeCondition.wait(lock, [this] { return !mIsRunning || mQueuedCount > 0; });
+
+			if (!mIsRunning) break;
+		}
+
+		sQueueOwner = nullptr;
+	}
+#pragma endregion Helper Methods
+}
\ No newline at end of file
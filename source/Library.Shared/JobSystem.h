@@ -0,0 +1,229 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// First Party
+#include "Vector.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Work-stealing job scheduler backed by a fixed pool of worker threads.
+	/// Every worker owns a queue, taking its own jobs newest first and stealing the oldest jobs of other queues when it runs dry.
+	/// Threads outside the pool share one extra queue.
+	/// </summary>
+	class JobSystem final
+	{
+#pragma region Type Definitions
+	public:
+		/// <summary>
+		/// Unit of work run by the JobSystem.
+		/// </summary>
+		using Job = std::function<void()>;
+
+		/// <summary>
+		/// Tracks a batch of scheduled jobs, so they can be waited on together.
+		/// Must outlive every job scheduled against it.
+		/// </summary>
+		class Counter final
+		{
+			friend JobSystem;
+
+		public:
+			/// <summary>
+			/// Checks if every job scheduled against the Counter has finished.
+			/// </summary>
+			/// <returns>True if no job is pending, otherwise false.</returns>
+			bool IsDone() const;
+
+		private:
+			/// <summary>
+			/// Number of jobs scheduled but not yet finished.
+			/// </summary>
+			std::atomic<std::size_t> mPendingCount{ 0 };
+
+			/// <summary>
+			/// Set by the first job to throw, so only that exception is kept.
+			/// </summary>
+			std::atomic<bool> mHasException{ false };
+
+			/// <summary>
+			/// First exception thrown by a job, rethrown by Wait.
+			/// </summary>
+			std::exception_ptr mException;
+		};
+
+	private:
+		/// <summary>
+		/// Job queued along with the Counter it reports to.
+		/// </summary>
+		struct Task final
+		{
+			Job Function;
+			Counter* Tracker;
+		};
+
+		/// <summary>
+		/// Queue of Tasks, popped from the back by its owner and stolen from the front by other threads.
+		/// </summary>
+		struct WorkQueue final
+		{
+			std::mutex Mutex;
+			std::deque<Task> Tasks;
+		};
+#pragma endregion Type Definitions
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Default constructor.
+		/// Starts the worker threads.
+		/// </summary>
+		/// <param name="workerCount">Number of worker threads. Zero runs every job on the thread that waits for it.</param>
+		explicit JobSystem(const std::size_t workerCount=DefaultWorkerCount());
+
+		/// <summary>
+		/// Destructor.
+		/// Joins the worker threads, then runs any jobs still queued on the calling thread.
+		/// </summary>
+		~JobSystem();
+
+		/// <summary>
+		/// Deleted copy constructor.
+		/// </summary>
+		JobSystem(const JobSystem& rhs) = delete;
+
+		/// <summary>
+		/// Deleted copy assignment operator.
+		/// </summary>
+		JobSystem& operator=(const JobSystem& rhs) = delete;
+
+		/// <summary>
+		/// Deleted move constructor, since the worker threads refer to the JobSystem.
+		/// </summary>
+		JobSystem(JobSystem&& rhs) = delete;
+
+		/// <summary>
+		/// Deleted move assignment operator, since the worker threads refer to the JobSystem.
+		/// </summary>
+		JobSystem& operator=(JobSystem&& rhs) = delete;
+#pragma endregion Special Members
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the number of worker threads.
+		/// </summary>
+		/// <returns>Number of worker threads.</returns>
+		std::size_t WorkerCount() const;
+
+		/// <summary>
+		/// Gets the default number of worker threads, one less than the hardware thread count so the calling thread has a core.
+		/// </summary>
+		/// <returns>Default number of worker threads.</returns>
+		static std::size_t DefaultWorkerCount();
+#pragma endregion Accessors
+
+#pragma region Scheduling
+	public:
+		/// <summary>
+		/// Queues a job to be run by any thread of the JobSystem.
+		/// Jobs scheduled from a worker go to the queue of that worker.
+		/// </summary>
+		/// <param name="job">Job to be run.</param>
+		/// <param name="counter">Counter tracking the job.</param>
+		void Schedule(Job job, Counter& counter);
+
+		/// <summary>
+		/// Blocks until every job scheduled against the Counter has finished, running queued jobs in the meantime.
+		/// Safe to call from within a job.
+		/// </summary>
+		/// <param name="counter">Counter to be waited on.</param>
+		/// <exception cref="std::exception">Rethrows the first exception thrown by a job of the Counter.</exception>
+		void Wait(Counter& counter);
+#pragma endregion Scheduling
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Gets the queue owned by the calling thread, or the shared queue for threads outside the pool.
+		/// </summary>
+		/// <returns>Index of the queue.</returns>
+		std::size_t QueueIndex() const;
+
+		/// <summary>
+		/// Runs one job, taken from the given queue first, then stolen from the others.
+		/// </summary>
+		/// <param name="queueIndex">Index of the queue owned by the calling thread.</param>
+		/// <returns>True if a job was run, otherwise false.</returns>
+		bool TryRunJob(const std::size_t queueIndex);
+
+		/// <summary>
+		/// Main loop of a worker thread, running jobs until the JobSystem is destroyed.
+		/// </summary>
+		/// <param name="queueIndex">Index of the queue owned by the worker.</param>
+		void WorkerLoop(const std::size_t queueIndex);
+#pragma endregion Helper Methods
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Queue owned by the calling thread, valid while sQueueOwner is the current JobSystem.
+		/// </summary>
+		inline static thread_local std::size_t sQueueIndex{ 0 };
+
+		/// <summary>
+		/// JobSystem whose worker pool the calling thread belongs to, if any.
+		/// </summary>
+		inline static thread_local const JobSystem* sQueueOwner{ nullptr };
+
+		/// <summary>
+		/// One queue per worker, plus the shared queue at index zero.
+		/// </summary>
+		std::unique_ptr<WorkQueue[]> mQueues;
+
+		/// <summary>
+		/// Number of queues.
+		/// </summary>
+		std::size_t mQueueCount;
+
+		/// <summary>
+		/// Worker threads.
+		/// </summary>
+		Vector<std::thread> mWorkers{ Vector<std::thread>::EqualityFunctor() };
+
+		/// <summary>
+		/// Number of jobs queued but not yet taken by a thread.
+		/// </summary>
+		std::atomic<std::size_t> mQueuedCount{ 0 };
+
+		/// <summary>
+		/// Represents whether the worker threads should keep running.
+		/// </summary>
+		std::atomic<bool> mIsRunning{ true };
+
+		/// <summary>
+		/// Mutex guarding idle workers going to sleep.
+		/// </summary>
+		std::mutex mSleepMutex;
+
+		/// <summary>
+		/// Wakes idle workers when a job is queued.
+		/// </summary>
+		std::condition_variable mWakeCondition;
+#pragma endregion Data Members
+	};
+}
+
+// Inline File
+#include "JobSystem.inl"
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+
+// Header
+#include "JobSystem.h"
+
+namespace Library
+{
+#pragma region Counter
+	inline bool JobSystem::Counter::IsDone() const
+	{
+		return mPendingCount.load(std::memory_order_acquire) == 0;
+	}
+#pragma endregion Counter
+
+#pragma region Accessors
+	inline std::size_t JobSystem::WorkerCount() const
+	{
+		return mWorkers.Size();
+	}
+
+	inline std::size_t JobSystem::DefaultWorkerCount()
+	{
+		const std::size_t threadCount = std::thread::hardware_concurrency();
+		return threadCount > 1 ? threadCount - 1 : 0;
+	}
+#pragma endregion Accessors
+
+#pragma region Helper Methods
+	inline std::size_t JobSystem::QueueIndex() const
+	{
+		return sQueueOwner == this ? sQueueIndex : 0;
+	}
+#pragma endregion Helper Methods
+}
\ No newline at end of file
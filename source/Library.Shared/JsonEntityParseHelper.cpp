@@ -131,7 +131,7 @@ namespace Library
 		{
 			if (!value.isObject() || !value.isMember("type"s) || !value.isMember("value"s)) return false;
 			
-			helperData->mStack.Push({ key, Entity::Types::Unknown, "Entity"s, nullptr, *helperData->mRootEntity });
+			helperData->mStack.Push({ key, NameId(key), Entity::Types::Unknown, "Entity"s, nullptr, *helperData->mRootEntity });
 			return true;
 		}
 		
@@ -168,7 +168,7 @@ namespace Library
 
 				if (value.isObject())
 				{
-					const Scope::Data* scopeData = stackFrame.Context.Find(stackFrame.Key);
+					const Scope::Data* scopeData = stackFrame.Context.Find(stackFrame.Name);
 					
 					if (!scopeData || stackFrame.ArrayIndex >= scopeData->Size())
 					{
@@ -208,14 +208,14 @@ namespace Library
 		}
 		else if (value.isObject())
 		{			
-			Entity::Data& entityData = *stackFrame.Context.Find(stackFrame.Key);
+			Entity::Data& entityData = *stackFrame.Context.Find(stackFrame.Name);
 
 			assert(entityData.Type() == Entity::Types::Scope);
 			assert(entityData[stackFrame.ArrayIndex-1].Is(Entity::TypeIdClass()));
 			
 			Entity* entity = static_cast<Entity*>(entityData.Get<Scope*>(entityData.Size() - 1));
 			
-			helperData->mStack.Push({ key, Entity::Types::Unknown, "Entity"s, nullptr, *entity });
+			helperData->mStack.Push({ key, NameId(key), Entity::Types::Unknown, "Entity"s, nullptr, *entity });
 			handled = true;
 		}
 
@@ -240,7 +240,7 @@ namespace Library
 		{
 			if (stackFrame.Value == nullptr)
 			{
-				auto& scopeData = stackFrame.Context[stackFrame.Key];
+				auto& scopeData = stackFrame.Context.Append(stackFrame.Name);
 
 				if (scopeData.Type() == Entity::Types::Unknown)
 				{
@@ -255,7 +255,7 @@ namespace Library
 			}
 			else if (stackFrame.Value->isArray())
 			{
-				auto& scopeData = stackFrame.Context[stackFrame.Key];
+				auto& scopeData = stackFrame.Context.Append(stackFrame.Name);
 
 				if (scopeData.Type() == Entity::Types::Unknown)
 				{
@@ -294,7 +294,7 @@ namespace Library
 			}
 			else
 			{
-				auto& scopeData = stackFrame.Context[stackFrame.Key];
+				auto& scopeData = stackFrame.Context.Append(stackFrame.Name);
 
 				if (scopeData.Type() == Entity::Types::Unknown)
 				{
@@ -34,6 +34,7 @@ namespace Library
 		struct StackFrame final
 		{
 			const std::string& Key;
+			NameId Name;
 			Entity::Types Type;
 			std::string ClassName;
 			const Json::Value* Value;
@@ -0,0 +1,213 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "NameId.h"
+
+// First Party
+#include "Vector.h"
+#pragma endregion Includes
+
+namespace Library
+{
+#pragma region Registry
+	/// <summary>
+	/// Global table of interned names.
+	/// Names are copied into fixed size character blocks that are never moved, and indexed by an open addressing table of identifiers.
+	/// </summary>
+	struct NameId::Registry final
+	{
+		/// <summary>
+		/// Number of names reserved for when the table is constructed.
+		/// </summary>
+		static constexpr std::size_t DefaultCapacity = 4096;
+
+		/// <summary>
+		/// Size in bytes of each block of name characters.
+		/// </summary>
+		static constexpr std::size_t BlockSize = 65536;
+
+		Registry();
+		~Registry();
+		Registry(const Registry&) = delete;
+		Registry(Registry&&) = delete;
+		Registry& operator=(const Registry&) = delete;
+		Registry& operator=(Registry&&) = delete;
+
+		/// <summary>
+		/// Finds the index slot for the given name, either the slot holding its identifier or the empty slot where it belongs.
+		/// </summary>
+		/// <param name="name">Name to be found.</param>
+		/// <param name="hash">Hash code of the name.</param>
+		/// <returns>Reference to the index slot for the name.</returns>
+		IdType& FindSlot(const std::string_view name, const std::size_t hash);
+
+		/// <summary>
+		/// Copies a name into character block storage.
+		/// </summary>
+		/// <param name="name">Name to be copied.</param>
+		/// <returns>View of the stored copy of the name.</returns>
+		std::string_view Store(const std::string_view name);
+
+		/// <summary>
+		/// Doubles the size of the index and reinserts every identifier.
+		/// </summary>
+		void GrowIndex();
+
+		/// <summary>
+		/// Mutex guarding all table state.
+		/// </summary>
+		std::mutex Mutex;
+
+		/// <summary>
+		/// Interned names, indexed by identifier.
+		/// </summary>
+		Vector<std::string_view> Names;
+
+		/// <summary>
+		/// Hash codes of the interned names, indexed by identifier.
+		/// </summary>
+		Vector<std::size_t> Hashes;
+
+		/// <summary>
+		/// Open addressing table of identifiers with a power of two size. Empty slots hold NullId.
+		/// </summary>
+		Vector<IdType> Index;
+
+		/// <summary>
+		/// Blocks of name characters.
+		/// </summary>
+		Vector<char*> Blocks;
+
+		/// <summary>
+		/// Number of characters used in the last block.
+		/// </summary>
+		std::size_t BlockUsed{ 0 };
+	};
+
+	NameId::Registry::Registry() :
+		Names(DefaultCapacity), Hashes(DefaultCapacity)
+	{
+		Index.Resize(DefaultCapacity * 2, NullId);
+		Blocks.EmplaceBack(new char[BlockSize]);
+
+		Names.EmplaceBack();
+		Hashes.EmplaceBack(Hash::StringHash(""));
+	}
+
+	NameId::Registry::~Registry()
+	{
+		for (char* block : Blocks)
+		{
+			delete[] block;
+		}
+	}
+
+	NameId::IdType& NameId::Registry::FindSlot(const std::string_view name, const std::size_t hash)
+	{
+		const std::size_t mask = Index.Size() - 1;
+
+		for (std::size_t slot = hash & mask;; slot = (slot + 1) & mask)
+		{
+			IdType& id = Index[slot];
+
+			if (id == NullId || (Hashes[id] == hash && Names[id] == name))
+			{
+				return id;
+			}
+		}
+	}
+
+	std::string_view NameId::Registry::Store(const std::string_view name)
+	{
+		if (BlockUsed + name.size() > BlockSize)
+		{
+			Blocks.EmplaceBack(new char[std::max(BlockSize, name.size())]);
+			BlockUsed = 0;
+		}
+
+		char* data = Blocks.Back() + BlockUsed;
+		name.copy(data, name.size());
+		BlockUsed += name.size();
+
+		return std::string_view(data, name.size());
+	}
+
+	void NameId::Registry::GrowIndex()
+	{
+		const std::size_t size = Index.Size() * 2;
+
+		Index.Clear();
+		Index.Resize(size, NullId);
+
+		for (IdType id = 1; id < Names.Size(); ++id)
+		{
+			FindSlot(Names[id], Hashes[id]) = id;
+		}
+	}
+#pragma endregion Registry
+
+#pragma region Constructors
+	NameId::NameId(const std::string_view name)
+	{
+		if (name.empty()) return;
+
+		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(name.data());
+		const std::size_t hash = static_cast<std::size_t>(Hash::ByteHash(data, name.size()));
+
+		Registry& registry = GetRegistry();
+		std::scoped_lock<std::mutex> lock(registry.Mutex);
+
+		IdType* slot = &registry.FindSlot(name, hash);
+
+		if (*slot == NullId)
+		{
+			if ((registry.Names.Size() + 1) * 2 > registry.Index.Size())
+			{
+				registry.GrowIndex();
+				slot = &registry.FindSlot(name, hash);
+			}
+
+			*slot = static_cast<IdType>(registry.Names.Size());
+			registry.Names.EmplaceBack(registry.Store(name));
+			registry.Hashes.EmplaceBack(hash);
+		}
+
+		mId = *slot;
+		mHash = hash;
+		mName = registry.Names[mId];
+	}
+
+	NameId NameId::Find(const std::string_view name)
+	{
+		NameId nameId;
+		if (name.empty()) return nameId;
+
+		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(name.data());
+		const std::size_t hash = static_cast<std::size_t>(Hash::ByteHash(data, name.size()));
+
+		Registry& registry = GetRegistry();
+		std::scoped_lock<std::mutex> lock(registry.Mutex);
+
+		const IdType id = registry.FindSlot(name, hash);
+
+		if (id != NullId)
+		{
+			nameId.mId = id;
+			nameId.mHash = hash;
+			nameId.mName = registry.Names[id];
+		}
+
+		return nameId;
+	}
+#pragma endregion Constructors
+
+#pragma region Helper Methods
+	NameId::Registry& NameId::GetRegistry()
+	{
+		static Registry registry;
+		return registry;
+	}
+#pragma endregion Helper Methods
+}
\ No newline at end of file
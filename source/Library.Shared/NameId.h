@@ -0,0 +1,175 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// First Party
+#include "DefaultHash.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Handle to a name interned in a global name table.
+	/// Equality between handles is an integer compare, and the hash code of the name is computed once when it is interned.
+	/// </summary>
+	/// <remarks>
+	/// Interned names live for the duration of the program. The name table reserves its storage up front,
+	/// so interning does not allocate until that capacity is exhausted. Interning is thread safe.
+	/// </remarks>
+	class NameId final
+	{
+#pragma region Type Definitions and Constants
+	public:
+		/// <summary>
+		/// Type of the unique integer identifier for an interned name.
+		/// </summary>
+		using IdType = std::uint32_t;
+
+		/// <summary>
+		/// Identifier of the null NameId, which names the empty string.
+		/// </summary>
+		static constexpr IdType NullId = 0;
+#pragma endregion Type Definitions and Constants
+
+#pragma region Constructors
+	public:
+		/// <summary>
+		/// Default constructor, initializes a null NameId.
+		/// </summary>
+		NameId() = default;
+
+		/// <summary>
+		/// Interns the given name, if necessary, and initializes a NameId handle to it.
+		/// </summary>
+		/// <param name="name">Name to be interned.</param>
+		explicit NameId(const std::string& name);
+
+		/// <summary>
+		/// Interns the given name, if necessary, and initializes a NameId handle to it.
+		/// </summary>
+		/// <param name="name">Null terminated name to be interned.</param>
+		explicit NameId(const char* name);
+
+		/// <summary>
+		/// Interns the given name, if necessary, and initializes a NameId handle to it.
+		/// </summary>
+		/// <param name="name">Name to be interned.</param>
+		explicit NameId(const std::string_view name);
+
+		/// <summary>
+		/// Finds the NameId for the given name without interning it.
+		/// </summary>
+		/// <param name="name">Name to be found.</param>
+		/// <returns>If interned, the NameId for the given name. Otherwise, a null NameId.</returns>
+		static NameId Find(const std::string_view name);
+#pragma endregion Constructors
+
+#pragma region Boolean Operators
+	public:
+		/// <summary>
+		/// Equal operator.
+		/// </summary>
+		/// <param name="rhs">NameId to be compared against.</param>
+		/// <returns>True if both handles refer to the same name, otherwise false.</returns>
+		bool operator==(const NameId& rhs) const noexcept;
+
+		/// <summary>
+		/// Not equal operator.
+		/// </summary>
+		/// <param name="rhs">NameId to be compared against.</param>
+		/// <returns>True if the handles refer to different names, otherwise false.</returns>
+		bool operator!=(const NameId& rhs) const noexcept;
+#pragma endregion Boolean Operators
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the unique integer identifier of the interned name.
+		/// </summary>
+		/// <returns>Unique integer identifier of the interned name.</returns>
+		IdType Id() const;
+
+		/// <summary>
+		/// Gets the precomputed hash code of the interned name.
+		/// </summary>
+		/// <returns>Hash code of the name, equal to the DefaultHash of a std::string with the same characters.</returns>
+		std::size_t Hash() const;
+
+		/// <summary>
+		/// Gets the interned name.
+		/// </summary>
+		/// <returns>View of the interned name, valid for the duration of the program.</returns>
+		std::string_view Name() const;
+
+		/// <summary>
+		/// Checks if the NameId is null, naming the empty string.
+		/// </summary>
+		/// <returns>True if the NameId is null, otherwise false.</returns>
+		bool IsNull() const;
+#pragma endregion Accessors
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Global table of interned names.
+		/// </summary>
+		struct Registry;
+
+		/// <summary>
+		/// Gets the global table of interned names, constructing it on first use.
+		/// </summary>
+		/// <returns>Reference to the global table of interned names.</returns>
+		static Registry& GetRegistry();
+#pragma endregion Helper Methods
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Unique integer identifier of the interned name.
+		/// </summary>
+		IdType mId{ NullId };
+
+		/// <summary>
+		/// Hash code of the interned name.
+		/// </summary>
+		std::size_t mHash{ Hash::StringHash("") };
+
+		/// <summary>
+		/// View of the interned name, owned by the name table.
+		/// </summary>
+		std::string_view mName;
+#pragma endregion Data Members
+	};
+}
+
+namespace Library::Hash
+{
+	/// <summary>
+	/// Default hash functor for NameId values, returning the precomputed hash code.
+	/// </summary>
+	/// <param name="key">Key used to compute the hashcode.</param>
+	/// <returns>Hash code for the given key.</returns>
+	template<>
+	struct DefaultHash<NameId> final
+	{
+		std::size_t operator()(const NameId& key) const;
+	};
+
+	/// <summary>
+	/// Default hash functor for constant NameId values, returning the precomputed hash code.
+	/// </summary>
+	/// <param name="key">Key used to compute the hashcode.</param>
+	/// <returns>Hash code for the given key.</returns>
+	template<>
+	struct DefaultHash<const NameId> final
+	{
+		std::size_t operator()(const NameId& key) const;
+	};
+}
+
+// Inline File
+#include "NameId.inl"
\ No newline at end of file
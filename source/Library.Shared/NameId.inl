@@ -0,0 +1,64 @@
+#pragma once
+
+// Header
+#include "NameId.h"
+
+namespace Library
+{
+#pragma region Constructors
+	inline NameId::NameId(const std::string& name) : NameId(std::string_view(name))
+	{
+	}
+
+	inline NameId::NameId(const char* name) : NameId(std::string_view(name))
+	{
+	}
+#pragma endregion Constructors
+
+#pragma region Boolean Operators
+	inline bool NameId::operator==(const NameId& rhs) const noexcept
+	{
+		return mId == rhs.mId;
+	}
+
+	inline bool NameId::operator!=(const NameId& rhs) const noexcept
+	{
+		return mId != rhs.mId;
+	}
+#pragma endregion Boolean Operators
+
+#pragma region Accessors
+	inline NameId::IdType NameId::Id() const
+	{
+		return mId;
+	}
+
+	inline std::size_t NameId::Hash() const
+	{
+		return mHash;
+	}
+
+	inline std::string_view NameId::Name() const
+	{
+		return mName;
+	}
+
+	inline bool NameId::IsNull() const
+	{
+		return mId == NullId;
+	}
+#pragma endregion Accessors
+}
+
+namespace Library::Hash
+{
+	inline std::size_t DefaultHash<NameId>::operator()(const NameId& key) const
+	{
+		return key.Hash();
+	}
+
+	inline std::size_t DefaultHash<const NameId>::operator()(const NameId& key) const
+	{
+		return key.Hash();
+	}
+}
\ No newline at end of file
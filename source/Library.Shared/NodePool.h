@@ -0,0 +1,180 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <utility>
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Fixed size allocator for objects of a single type, used for container nodes.
+	/// Memory is allocated in chunks that double in capacity up to MaxChunkCapacity.
+	/// Destroyed objects are kept on a free list and reused by later calls to Create.
+	/// </summary>
+	/// <typeparam name="T">Type of the objects allocated from the pool.</typeparam>
+	/// <remarks>Not thread safe. Memory is only returned to the system by Clear or on destruction.</remarks>
+	template<typename T>
+	class NodePool final
+	{
+#pragma region Type Definitions and Constants
+	public:
+		/// <summary>
+		/// Number of objects in the first chunk allocated by the pool.
+		/// </summary>
+		static constexpr std::size_t MinChunkCapacity = 1;
+
+		/// <summary>
+		/// Maximum number of objects in each chunk allocated by the pool.
+		/// </summary>
+		static constexpr std::size_t MaxChunkCapacity = 256;
+
+	private:
+		/// <summary>
+		/// Storage for a single object, reused as a free list link when the object is destroyed.
+		/// </summary>
+		union Slot
+		{
+			Slot* Next;
+			alignas(T) std::byte Storage[sizeof(T)];
+		};
+
+		/// <summary>
+		/// Header of a block of Slot values allocated together.
+		/// </summary>
+		struct Chunk final
+		{
+			Chunk* Next;
+			std::size_t Capacity;
+		};
+
+		static_assert(alignof(Slot) <= alignof(std::max_align_t), "NodePool does not support over-aligned types.");
+
+		/// <summary>
+		/// Offset from the start of a Chunk to its first Slot.
+		/// </summary>
+		static constexpr std::size_t SlotOffset = (sizeof(Chunk) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+#pragma endregion Type Definitions and Constants
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Default constructor. Does not allocate.
+		/// </summary>
+		NodePool() = default;
+
+		/// <summary>
+		/// Destructor. Releases all chunks.
+		/// </summary>
+		/// <remarks>All objects must be destroyed before the pool.</remarks>
+		~NodePool();
+
+		NodePool(const NodePool&) = delete;
+		NodePool& operator=(const NodePool&) = delete;
+
+		/// <summary>
+		/// Move constructor. Takes ownership of all chunks, so objects created from the right hand side remain valid.
+		/// </summary>
+		/// <param name="rhs">NodePool to be moved.</param>
+		NodePool(NodePool&& rhs) noexcept;
+
+		/// <summary>
+		/// Move assignment operator. Releases the current chunks and takes ownership of the right hand side chunks.
+		/// </summary>
+		/// <param name="rhs">NodePool to be moved.</param>
+		/// <returns>Reference to the modified NodePool.</returns>
+		NodePool& operator=(NodePool&& rhs) noexcept;
+#pragma endregion Special Members
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the number of live objects created from the pool.
+		/// </summary>
+		/// <returns>Number of live objects.</returns>
+		std::size_t Size() const;
+
+		/// <summary>
+		/// Gets the number of chunks allocated by the pool, which is the number of heap allocations made.
+		/// </summary>
+		/// <returns>Number of chunks allocated.</returns>
+		std::size_t ChunkCount() const;
+#pragma endregion Accessors
+
+#pragma region Modifiers
+	public:
+		/// <summary>
+		/// Constructs an object in pooled memory.
+		/// </summary>
+		/// <param name="args">Arguments forwarded to the object constructor.</param>
+		/// <returns>Pointer to the newly constructed object.</returns>
+		/// <exception cref="std::bad_alloc">Allocation failed.</exception>
+		template<typename... Args>
+		T* Create(Args&&... args);
+
+		/// <summary>
+		/// Destroys an object created from the pool and returns its memory to the free list.
+		/// </summary>
+		/// <param name="object">Object to be destroyed. Must have been created from this pool.</param>
+		void Destroy(T* object);
+
+		/// <summary>
+		/// Releases all chunks.
+		/// </summary>
+		/// <remarks>All objects must be destroyed before calling Clear.</remarks>
+		void Clear();
+#pragma endregion Modifiers
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Allocates a new chunk, doubling the capacity of the previous chunk up to MaxChunkCapacity.
+		/// </summary>
+		/// <exception cref="std::bad_alloc">Allocation failed.</exception>
+		void AllocateChunk();
+
+		/// <summary>
+		/// Gets the Slot at an index in a chunk.
+		/// </summary>
+		/// <param name="chunk">Chunk containing the Slot.</param>
+		/// <param name="index">Index of the Slot within the chunk.</param>
+		/// <returns>Pointer to the Slot.</returns>
+		static Slot* GetSlot(Chunk* chunk, const std::size_t index);
+#pragma endregion Helper Methods
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Most recently allocated chunk, the head of a list of all chunks.
+		/// </summary>
+		Chunk* mChunks{ nullptr };
+
+		/// <summary>
+		/// Head of the list of Slot values freed by Destroy.
+		/// </summary>
+		Slot* mFreeList{ nullptr };
+
+		/// <summary>
+		/// Number of Slot values in the most recent chunk that have never been used.
+		/// </summary>
+		std::size_t mUnusedCount{ 0 };
+
+		/// <summary>
+		/// Number of live objects.
+		/// </summary>
+		std::size_t mSize{ 0 };
+
+		/// <summary>
+		/// Number of chunks allocated.
+		/// </summary>
+		std::size_t mChunkCount{ 0 };
+#pragma endregion Data Members
+	};
+}
+
+// Inline File
+#include "NodePool.inl"
\ No newline at end of file
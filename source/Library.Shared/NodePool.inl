@@ -0,0 +1,162 @@
+#pragma once
+
+// Header
+#include "NodePool.h"
+
+namespace Library
+{
+#pragma region Special Members
+	template<typename T>
+	inline NodePool<T>::~NodePool()
+	{
+		Clear();
+	}
+
+	template<typename T>
+	inline NodePool<T>::NodePool(NodePool&& rhs) noexcept :
+		mChunks(rhs.mChunks), mFreeList(rhs.mFreeList), mUnusedCount(rhs.mUnusedCount), mSize(rhs.mSize), mChunkCount(rhs.mChunkCount)
+	{
+		rhs.mChunks = nullptr;
+		rhs.mFreeList = nullptr;
+		rhs.mUnusedCount = 0;
+		rhs.mSize = 0;
+		rhs.mChunkCount = 0;
+	}
+
+	template<typename T>
+	inline NodePool<T>& NodePool<T>::operator=(NodePool&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Clear();
+
+			mChunks = rhs.mChunks;
+			mFreeList = rhs.mFreeList;
+			mUnusedCount = rhs.mUnusedCount;
+			mSize = rhs.mSize;
+			mChunkCount = rhs.mChunkCount;
+
+			rhs.mChunks = nullptr;
+			rhs.mFreeList = nullptr;
+			rhs.mUnusedCount = 0;
+			rhs.mSize = 0;
+			rhs.mChunkCount = 0;
+		}
+
+		return *this;
+	}
+#pragma endregion Special Members
+
+#pragma region Accessors
+	template<typename T>
+	inline std::size_t NodePool<T>::Size() const
+	{
+		return mSize;
+	}
+
+	template<typename T>
+	inline std::size_t NodePool<T>::ChunkCount() const
+	{
+		return mChunkCount;
+	}
+#pragma endregion Accessors
+
+#pragma region Modifiers
+	template<typename T>
+	template<typename... Args>
+	inline T* NodePool<T>::Create(Args&&... args)
+	{
+		Slot* slot;
+
+		if (mFreeList != nullptr)
+		{
+			slot = mFreeList;
+			mFreeList = slot->Next;
+		}
+		else
+		{
+			if (mUnusedCount == 0)
+			{
+				AllocateChunk();
+			}
+
+			slot = GetSlot(mChunks, mChunks->Capacity - mUnusedCount);
+			--mUnusedCount;
+		}
+
+		T* object;
+
+		try
+		{
+			object = new(slot->Storage)T(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			slot->Next = mFreeList;
+			mFreeList = slot;
+			throw;
+		}
+
+		++mSize;
+		return object;
+	}
+
+	template<typename T>
+	inline void NodePool<T>::Destroy(T* object)
+	{
+		if (object == nullptr) return;
+
+		object->~T();
+
+		Slot* slot = reinterpret_cast<Slot*>(object);
+		slot->Next = mFreeList;
+		mFreeList = slot;
+
+		--mSize;
+	}
+
+	template<typename T>
+	inline void NodePool<T>::Clear()
+	{
+		while (mChunks != nullptr)
+		{
+			Chunk* next = mChunks->Next;
+			std::free(mChunks);
+			mChunks = next;
+		}
+
+		mFreeList = nullptr;
+		mUnusedCount = 0;
+		mSize = 0;
+		mChunkCount = 0;
+	}
+#pragma endregion Modifiers
+
+#pragma region Helper Methods
+	template<typename T>
+	inline void NodePool<T>::AllocateChunk()
+	{
+		const std::size_t capacity = mChunks ? std::min(mChunks->Capacity * 2, MaxChunkCapacity) : MinChunkCapacity;
+
+		Chunk* chunk = static_cast<Chunk*>(std::malloc(SlotOffset + capacity * sizeof(Slot)));
+
+		if (chunk == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		chunk->Next = mChunks;
+		chunk->Capacity = capacity;
+
+		mChunks = chunk;
+		mUnusedCount = capacity;
+		++mChunkCount;
+	}
+
+	template<typename T>
+	inline typename NodePool<T>::Slot* NodePool<T>::GetSlot(Chunk* chunk, const std::size_t index)
+	{
+		return reinterpret_cast<Slot*>(reinterpret_cast<std::byte*>(chunk) + SlotOffset) + index;
+	}
+#pragma endregion Helper Methods
+}
\ No newline at end of file
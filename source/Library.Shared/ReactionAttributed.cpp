@@ -13,6 +13,7 @@
 #include "EventPublisher.h"
 #include "Event.h"
 #include "World.h"
+#include "StackAllocator.h"
 #pragma endregion Includes
 
 using namespace std::string_literals;
@@ -29,6 +30,17 @@ namespace Library
 
 		return signatures;
 	}
+
+	FlatHashMap<NameId, Vector<ReactionAttributed*>> ReactionAttributed::sReactionIndex;
+	std::size_t ReactionAttributed::sReactionCount{ 0 };
+	std::mutex ReactionAttributed::sIndexMutex;
+	ReactionAttributed::SubtypeDispatcher ReactionAttributed::sDispatcher;
+
+	std::size_t ReactionAttributed::ReactionCount()
+	{
+		std::scoped_lock<std::mutex> lock(sIndexMutex);
+		return sReactionCount;
+	}
 #pragma endregion
 
 
@@ -36,41 +48,88 @@ namespace Library
 	ReactionAttributed::ReactionAttributed(std::string name, Subtype subtype) : Reaction(TypeIdClass(), std::move(name)),
 		mSubtype(std::move(subtype))
 	{
-		Event<EventMessageAttributed>::Subscribe(*this);
+		AddToIndex();
 	}
 
 	ReactionAttributed::~ReactionAttributed()
 	{
 		try
 		{
-			Event<EventMessageAttributed>::Unsubscribe(*this);
+			RemoveFromIndex();
 		}
 		catch (...)
 		{
-			std::cerr	<< "ReactionAttributed instance unsubscribe from Event<EventMessageAttributed> on destruction."s
-						<< "It could not be found in the Event's subscriber list."s << std::endl;
+			std::cerr	<< "ReactionAttributed instance could not be removed from the subtype index on destruction."s << std::endl;
 		}
 	}
 
-	ReactionAttributed::ReactionAttributed(const ReactionAttributed& rhs) : Reaction(rhs)
+	ReactionAttributed::ReactionAttributed(const ReactionAttributed& rhs) : Reaction(rhs),
+		mSubtype(rhs.mSubtype)
 	{
-		Event<EventMessageAttributed>::Subscribe(*this);
+		AddToIndex();
 	}
 
-	ReactionAttributed::ReactionAttributed(ReactionAttributed&& rhs) noexcept : Reaction(std::move(rhs))
+	ReactionAttributed::ReactionAttributed(ReactionAttributed&& rhs) noexcept : Reaction(std::move(rhs)),
+		mSubtype(std::move(rhs.mSubtype))
 	{
 		try
 		{
-			Event<EventMessageAttributed>::Subscribe(*this);
+			AddToIndex();
 		}
 		catch (...)
 		{
-			std::cerr	<< "ReactionAttributed instance subscription to Event<EventMessageAttributed> failed."s
-						<< "It is already found on the Event's subscriber list. (Impossible)"s << std::endl;
+			std::cerr	<< "ReactionAttributed instance could not be added to the subtype index."s << std::endl;
+		}
+	}
+
+	ReactionAttributed& ReactionAttributed::operator=(const ReactionAttributed& rhs)
+	{
+		if (this != &rhs)
+		{
+			Reaction::operator=(rhs);
+			mParameters = rhs.mParameters;
+			mSubtype = rhs.mSubtype;
+			UpdateIndex();
 		}
+
+		return *this;
+	}
+
+	ReactionAttributed& ReactionAttributed::operator=(ReactionAttributed&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Reaction::operator=(std::move(rhs));
+			mParameters = std::move(rhs.mParameters);
+			mSubtype = std::move(rhs.mSubtype);
+
+			try
+			{
+				UpdateIndex();
+			}
+			catch (...)
+			{
+				std::cerr	<< "ReactionAttributed instance could not be re-indexed."s << std::endl;
+			}
+		}
+
+		return *this;
 	}
 #pragma endregion Special Members
 
+#pragma region Accessors
+	const ReactionAttributed::Subtype& ReactionAttributed::GetSubtype() const
+	{
+		return mSubtype;
+	}
+
+	void ReactionAttributed::SetSubtype(Subtype subtype)
+	{
+		mSubtype = std::move(subtype);
+		UpdateIndex();
+	}
+#pragma endregion Accessors
+
 #pragma region Virtual Copy Constructor
 	gsl::owner<Scope*> ReactionAttributed::Clone() const
 	{
@@ -79,27 +138,74 @@ namespace Library
 #pragma endregion Virtual Copy Constructor
 
 #pragma region Event Subscriber Overrides
+	void ReactionAttributed::SubtypeDispatcher::Notify(EventPublisher& eventPublisher)
+	{
+		assert(eventPublisher.Is(Event<EventMessageAttributed>::TypeIdClass()));
+		const EventMessageAttributed& message = static_cast<Event<EventMessageAttributed>&>(eventPublisher).Message;
+
+		if (!message.GetWorld()) return;
+
+		const NameId subtypeId = NameId::Find(message.GetSubtype());
+		if (subtypeId.IsNull() && !message.GetSubtype().empty()) return;
+
+		Vector<ReactionAttributed*> reactions(StackAllocator::ThreadLocal());
+		{
+			std::scoped_lock<std::mutex> lock(sIndexMutex);
+
+			const auto entry = sReactionIndex.Find(subtypeId);
+			if (entry == sReactionIndex.end()) return;
+
+			reactions.Reserve(entry->second.Size());
+
+			for (ReactionAttributed* reaction : entry->second)
+			{
+				reactions.EmplaceBack(reaction);
+			}
+		}
+
+		for (ReactionAttributed* reaction : reactions)
+		{
+			reaction->React(message);
+		}
+	}
+
 	void ReactionAttributed::Notify(EventPublisher& eventPublisher)
 	{
 		assert(eventPublisher.Is(Event<EventMessageAttributed>::TypeIdClass()));
-		auto message = static_cast<Event<EventMessageAttributed>*>(&eventPublisher)->Message;
+		const EventMessageAttributed& message = static_cast<Event<EventMessageAttributed>&>(eventPublisher).Message;
 		
 		if (mSubtype == message.GetSubtype() && message.GetWorld())
-		{			
-			Scope parameters;
-
-			message.ForEachAuxiliary([&](const Attribute& attribute) 
-            {
-                mParameters[attribute.first] = attribute.second; 
-            });
-					
-			Entity::Update(message.GetWorld()->GetWorldState());
-			
-			mParameters.Clear();
+		{
+			React(message);
 		}
 	}
+
+	void ReactionAttributed::React(const EventMessageAttributed& message)
+	{
+		message.ForEachAuxiliary([this](const ConstAttribute& attribute) 
+		{
+			mParameters[attribute.first] = attribute.second; 
+		});
+				
+		Entity::Update(message.GetWorld()->GetWorldState());
+		
+		mParameters.Clear();
+	}
 #pragma endregion Event Subscriber Overrides
 
+#pragma region Action List Overrides
+	void ReactionAttributed::Initialize(WorldState& worldState)
+	{
+		UpdateIndex();
+		Entity::Initialize(worldState);
+	}
+
+	void ReactionAttributed::Update(WorldState&)
+	{
+		UpdateIndex();
+	}
+#pragma endregion Action List Overrides
+
 #pragma region Scope Overrides
 	ReactionAttributed::Data* ReactionAttributed::Find(const Key& key)
 	{
@@ -112,5 +218,72 @@ namespace Library
 		
 		return result ? result : Entity::Find(key);
 	}
+
+	ReactionAttributed::Data* ReactionAttributed::Find(const NameId& key)
+	{
+		Data* result = nullptr;
+
+		if (!mParameters.IsEmpty())
+		{
+			result = mParameters.Find(key);
+		}
+		
+		return result ? result : Entity::Find(key);
+	}
 #pragma endregion Scope Overrides
+
+#pragma region Helper Methods
+	void ReactionAttributed::AddToIndex()
+	{
+		mSubtypeId = NameId(mSubtype);
+
+		std::scoped_lock<std::mutex> lock(sIndexMutex);
+
+		auto entry = sReactionIndex.Find(mSubtypeId);
+
+		if (entry == sReactionIndex.end())
+		{
+			entry = sReactionIndex.Emplace(mSubtypeId, Vector<ReactionAttributed*>()).first;
+		}
+
+		entry->second.EmplaceBack(this);
+
+		if (sReactionCount++ == 0)
+		{
+			Event<EventMessageAttributed>::Subscribe(sDispatcher);
+		}
+	}
+
+	void ReactionAttributed::RemoveFromIndex()
+	{
+		std::scoped_lock<std::mutex> lock(sIndexMutex);
+
+		const auto entry = sReactionIndex.Find(mSubtypeId);
+		if (entry == sReactionIndex.end()) return;
+
+		Vector<ReactionAttributed*>& reactions = entry->second;
+		const auto reaction = reactions.Find(this);
+		if (reaction == reactions.end()) return;
+
+		reactions.Remove(reaction);
+
+		if (reactions.IsEmpty())
+		{
+			sReactionIndex.Remove(entry);
+		}
+
+		if (--sReactionCount == 0)
+		{
+			Event<EventMessageAttributed>::Unsubscribe(sDispatcher);
+		}
+	}
+
+	void ReactionAttributed::UpdateIndex()
+	{
+		if (mSubtype == mSubtypeId.Name()) return;
+
+		RemoveFromIndex();
+		AddToIndex();
+	}
+#pragma endregion Helper Methods
 }
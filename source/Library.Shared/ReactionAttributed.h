@@ -1,12 +1,24 @@
 #pragma once
 
 #pragma region Includes
+// Standard
+#include <mutex>
+
 // First Party
 #include "Reaction.h"
+#include "FlatHashMap.h"
+#include "NameId.h"
 #pragma endregion Includes
 
 namespace Library
 {
+	// Forward Declarations
+	class EventMessageAttributed;
+
+	/// <summary>
+	/// Reaction responding to EventMessageAttributed instances of a given subtype.
+	/// Instances are indexed by their interned subtype, so a published message only reaches the matching reactions.
+	/// </summary>
 	class ReactionAttributed final : public Reaction
 	{
 		RTTI_DECLARATIONS(ReactionAttributed, Reaction)
@@ -17,6 +29,20 @@ namespace Library
 		/// Type used to distinguish EventMessageAttributed instances.
 		/// </summary>
 		using Subtype = std::string;
+
+	private:
+		/// <summary>
+		/// Single subscriber to Event&lt;EventMessageAttributed&gt;, forwarding each message to the reactions indexed under its subtype.
+		/// Subscribed while at least one ReactionAttributed exists.
+		/// </summary>
+		struct SubtypeDispatcher final : public IEventSubscriber
+		{
+			/// <summary>
+			/// Forwards the message of an Event&lt;EventMessageAttributed&gt; to the reactions of its subtype.
+			/// </summary>
+			/// <param name="eventPublisher">Reference to an Event as an EventPublisher.</param>
+			virtual void Notify(EventPublisher& eventPublisher) override;
+		};
 #pragma endregion Type Definitions
 
 #pragma region Static Members
@@ -31,6 +57,33 @@ namespace Library
 		/// Getter for the class SignatureList, used for registration with the TypeManager.
 		/// </summary>
 		static const SignatureList& Signatures();
+
+		/// <summary>
+		/// Gets the number of ReactionAttributed instances currently indexed.
+		/// </summary>
+		/// <returns>Number of live ReactionAttributed instances.</returns>
+		static std::size_t ReactionCount();
+
+	private:
+		/// <summary>
+		/// Reactions indexed by their interned subtype.
+		/// </summary>
+		static FlatHashMap<NameId, Vector<ReactionAttributed*>> sReactionIndex;
+
+		/// <summary>
+		/// Number of indexed reactions.
+		/// </summary>
+		static std::size_t sReactionCount;
+
+		/// <summary>
+		/// Mutex guarding the reaction index.
+		/// </summary>
+		static std::mutex sIndexMutex;
+
+		/// <summary>
+		/// Subscriber delivering Event&lt;EventMessageAttributed&gt; instances through the reaction index.
+		/// </summary>
+		static SubtypeDispatcher sDispatcher;
 #pragma endregion Static Members
 
 #pragma region Special Members
@@ -58,7 +111,7 @@ namespace Library
 		/// </summary>
 		/// <param name="rhs">ReactionAttributed to be copied.</param>
 		/// <returns>Newly copied into left hand side ReactionAttributed.</returns>
-		ReactionAttributed& operator=(const ReactionAttributed& rhs) = default;
+		ReactionAttributed& operator=(const ReactionAttributed& rhs);
 
 		/// <summary>
 		/// Move constructor.
@@ -71,9 +124,26 @@ namespace Library
 		/// </summary>
 		/// <param name="rhs">ReactionAttributed to be moved.</param>
 		/// <returns>Newly moved into left hand side ReactionAttributed.</returns>
-		ReactionAttributed& operator=(ReactionAttributed&& rhs) noexcept = default;
+		ReactionAttributed& operator=(ReactionAttributed&& rhs) noexcept;
 #pragma endregion Special Members
 
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the EventMessageAttributed subtype to which this Reaction responds.
+		/// </summary>
+		/// <returns>Subtype of this Reaction.</returns>
+		const Subtype& GetSubtype() const;
+
+		/// <summary>
+		/// Sets the EventMessageAttributed subtype to which this Reaction responds, and re-indexes the Reaction.
+		/// The Subtype attribute may also be written through its Datum, such as by the JSON parser. Such writes are
+		/// indexed by the next Initialize, or as a fallback by the next Update, so events published before either are not delivered.
+		/// </summary>
+		/// <param name="subtype">New subtype of this Reaction.</param>
+		void SetSubtype(Subtype subtype);
+#pragma endregion Accessors
+
 #pragma region Virtual Copy Constructor
 	public:
 		/// <summary>
@@ -91,8 +161,32 @@ namespace Library
 		/// <param name="eventPublisher">Reference to an Event as an EventPublisher.</param>
 		/// <remarks>Overrides must be thread safe.</remarks>
 		virtual void Notify(EventPublisher& eventPublisher) override;
+
+		/// <summary>
+		/// Runs the Reaction for a message, with the auxiliary attributes of the message as parameters.
+		/// The subtype of the message is assumed to match.
+		/// </summary>
+		/// <param name="message">Message to react to.</param>
+		void React(const EventMessageAttributed& message);
 #pragma endregion Event Subscriber Overrides
 
+#pragma region Action List Overrides
+	public:
+		/// <summary>
+		/// Re-indexes the Reaction if its Subtype attribute was written directly since construction,
+		/// so a loaded Reaction receives events from the first frame.
+		/// </summary>
+		/// <param name="worldState">Reference to the current WorldState.</param>
+		virtual void Initialize(WorldState& worldState) override;
+
+		/// <summary>
+		/// Re-indexes the Reaction if its Subtype attribute was written directly since the last update.
+		/// Fallback for Datum writes made after Initialize.
+		/// </summary>
+		/// <param name="worldState">Reference to the current WorldState.</param>
+		virtual void Update(WorldState& worldState) override;
+#pragma endregion Action List Overrides
+
 #pragma region Scope Overrides
 	public:
 		/// <summary>
@@ -102,8 +196,34 @@ namespace Library
 		/// <param name="key">Key value associated with the Data value to be found.</param>
 		/// <returns>If found, a pointer to the Data value. Otherwise, nullptr.</returns>
 		virtual Data* Find(const Key& key) override;
+
+		/// <summary>
+		/// Override for the Scope Find method to first look in the parameter stack for an Attribute.
+		/// Finds the Data value associated with the given interned name, if it exists.
+		/// </summary>
+		/// <param name="key">Interned name associated with the Data value to be found.</param>
+		/// <returns>If found, a pointer to the Data value. Otherwise, nullptr.</returns>
+		virtual Data* Find(const NameId& key) override;
 #pragma endregion Scope Overrides
 
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Adds the Reaction to the index under its current subtype.
+		/// </summary>
+		void AddToIndex();
+
+		/// <summary>
+		/// Removes the Reaction from the index, using the subtype it was indexed under.
+		/// </summary>
+		void RemoveFromIndex();
+
+		/// <summary>
+		/// Moves the Reaction to the index entry of its current subtype, if it changed.
+		/// </summary>
+		void UpdateIndex();
+#pragma endregion Helper Methods
+
 #pragma region Data Members
 	private:
 		/// <summary>
@@ -118,6 +238,11 @@ namespace Library
 		/// String to specify a EventMessageAttributed subtype to which this Reaction should respond.
 		/// </summary>
 		std::string mSubtype;
+
+		/// <summary>
+		/// Interned subtype under which this Reaction is currently indexed.
+		/// </summary>
+		NameId mSubtypeId;
 #pragma endregion Data Members
 	};
 
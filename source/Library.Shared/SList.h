@@ -5,11 +5,13 @@
 #include <functional>
 
 #include "DefaultEquality.h"
+#include "NodePool.h"
 
 namespace Library
 {
 	/// <summary>
 	/// Represents a generic singly linked list.
+	/// Nodes are allocated from a NodePool owned by the SList, so pushing and popping elements rarely touches the heap.
 	/// </summary>
 	/// <typeparam name="T">Data type of elements in a SList.</typeparam>
 	template <typename T>
@@ -36,7 +38,7 @@ namespace Library
 			/// <summary>
 			/// Pointer to the next Node in the list.
 			/// </summary>
-			std::shared_ptr<Node> Next;
+			Node* Next;
 
 			/// <summary>
 			/// Data stored in the Node.
@@ -46,11 +48,11 @@ namespace Library
 			/// <summary>
 			/// Specialized constructor that constructs the data from an argument list parameter.
 			/// </summary>
-			/// <param name="next">Shared pointer to the next Node in the list.</param>
+			/// <param name="next">Pointer to the next Node in the list.</param>
 			/// <param name="args">Argument list used to construct the stored Data.</param>
 			/// <typeparam name="Args">Variadic argument list for constructing stored Data.</typeparam>
 			template<typename... Args>
-			explicit Node(const std::shared_ptr<Node>& next, Args&&... args);
+			explicit Node(Node* next, Args&&... args);
 		};
 #pragma endregion Type Definitions
 
@@ -111,7 +113,7 @@ namespace Library
 			/// </summary>
 			/// <param name="owner">Source SList for the Iterator's values.</param>
 			/// <param name="node">Current element of the SList referenced by the Iterator.</param>
-			Iterator(const SList<T>& owner, const std::shared_ptr<Node>& node=nullptr);
+			Iterator(const SList<T>& owner, Node* node=nullptr);
 
 		public:
 			/// <summary>
@@ -166,9 +168,9 @@ namespace Library
 			const SList* mOwner{ nullptr };
 
 			/// <summary>
-			/// Node reference that contains the current element referenced by the Iterator instance.
+			/// Node that contains the current element referenced by the Iterator instance.
 			/// </summary>
-			std::shared_ptr<Node> mNode{ nullptr };
+			Node* mNode{ nullptr };
 		};
 #pragma endregion Iterator
 
@@ -235,7 +237,7 @@ namespace Library
 			/// </summary>
 			/// <param name="owner">Source SList for the ConstIterator's values.</param>
 			/// <param name="node">Current element of the SList referenced by the ConstIterator, defaulted to a nullptr value.</param>
-			ConstIterator(const SList& owner, const std::shared_ptr<Node>& node=nullptr);
+			ConstIterator(const SList& owner, Node* node=nullptr);
 
 		public:
 			/// <summary>
@@ -290,9 +292,9 @@ namespace Library
 			const SList* mOwner{ nullptr };
 
 			/// <summary>
-			/// Node reference that contains the current element referenced by the ConstIterator instance.
+			/// Node that contains the current element referenced by the ConstIterator instance.
 			/// </summary>
-			std::shared_ptr<Node> mNode{ nullptr };
+			Node* mNode{ nullptr };
 		};
 #pragma endregion ConstIterator
 
@@ -307,7 +309,7 @@ namespace Library
 
 		/// <summary>
 		/// Destructor. 
-		/// Clears all existing node references.
+		/// Destroys all elements and releases the node pool.
 		/// </summary>
 		~SList();
 
@@ -329,6 +331,8 @@ namespace Library
 		/// <summary>
 		/// Move constructor.
 		/// Takes a SList as a parameter and moves the data to the constructed SList.
+		/// The node pool is moved with the data, so element addresses are unchanged, but Iterator values into rhs are invalidated:
+		/// they still refer to rhs as their owner, so the moved-to SList rejects them.
 		/// </summary>
 		/// <param name="rhs">SList to be moved.</param>
 		SList(SList&& rhs) noexcept;
@@ -575,7 +579,7 @@ namespace Library
 		bool Remove(const Iterator& it);
 
 		/// <summary>
-		/// Removes all elements from the SList and resets the size to zero.
+		/// Removes all elements from the SList, resets the size to zero, and releases the node pool memory.
 		/// </summary>
 		void Clear();
 #pragma endregion Modifiers
@@ -590,12 +594,17 @@ namespace Library
 		/// <summary>
 		/// First element in the SList.
 		/// </summary>
-		std::shared_ptr<Node> mFront{ nullptr };
+		Node* mFront{ nullptr };
 
 		/// <summary>
 		/// Last element in the SList.
 		/// </summary>
-		std::shared_ptr<Node> mBack{ nullptr };
+		Node* mBack{ nullptr };
+
+		/// <summary>
+		/// Allocator for the nodes of the SList.
+		/// </summary>
+		NodePool<Node> mNodePool;
 
 		/// <summary>
 		/// Functor for evaluating the equality of two values in the SList.
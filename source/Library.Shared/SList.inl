@@ -8,7 +8,7 @@ namespace Library
 #pragma region Node
 	template<typename T>
 	template<typename... Args>
-	inline Library::SList<T>::Node::Node(const std::shared_ptr<Node>& next, Args&&... args) :
+	inline Library::SList<T>::Node::Node(Node* next, Args&&... args) :
 		Next(next), Data(std::forward<Args>(args)...)
 	{
 	}
@@ -16,7 +16,7 @@ namespace Library
 
 #pragma region Iterator
 	template<typename T>
-	inline SList<T>::Iterator::Iterator(const SList& owner, const std::shared_ptr<Node>& node) :
+	inline SList<T>::Iterator::Iterator(const SList& owner, Node* node) :
 		mOwner(&owner), mNode(node)
 	{
 	}
@@ -90,7 +90,7 @@ namespace Library
 	}
 
 	template<typename T>
-	inline SList<T>::ConstIterator::ConstIterator(const SList& owner, const std::shared_ptr<Node>& node) :
+	inline SList<T>::ConstIterator::ConstIterator(const SList& owner, Node* node) :
 		mOwner(&owner), mNode(node)
 	{
 	}
@@ -199,7 +199,7 @@ namespace Library
 
 	template<typename T>
 	inline SList<T>::SList(SList&& rhs) noexcept :
-		mSize(rhs.mSize), mFront(rhs.mFront), mBack(rhs.mBack), mEqualityFunctor(rhs.mEqualityFunctor)
+		mSize(rhs.mSize), mFront(rhs.mFront), mBack(rhs.mBack), mNodePool(std::move(rhs.mNodePool)), mEqualityFunctor(rhs.mEqualityFunctor)
 	{
 		rhs.mSize = 0;
 		rhs.mFront = nullptr;
@@ -216,6 +216,7 @@ namespace Library
 			mSize = rhs.mSize;
 			mFront = rhs.mFront;
 			mBack = rhs.mBack;
+			mNodePool = std::move(rhs.mNodePool);
 			mEqualityFunctor = rhs.mEqualityFunctor;
 
 			rhs.mSize = 0;
@@ -416,7 +417,7 @@ namespace Library
 	template<typename ...Args>
 	inline T& SList<T>::EmplaceFront(Args&& ...args)
 	{
-		mFront = std::make_shared<Node>(mFront, std::forward<Args>(args)...);
+		mFront = mNodePool.Create(mFront, std::forward<Args>(args)...);
 
 		if (mSize == 0)
 		{
@@ -444,7 +445,7 @@ namespace Library
 	template<typename... Args>
 	inline T& SList<T>::EmplaceBack(Args&&... args)
 	{
-		auto newNode = std::make_shared<Node>(nullptr, std::forward<Args>(args)...);
+		Node* newNode = mNodePool.Create(nullptr, std::forward<Args>(args)...);
 
 		if (mSize == 0)
 		{
@@ -489,10 +490,16 @@ namespace Library
 			return Iterator(*this, mBack);
 		}
 
-		auto newNode = std::make_shared<Node>(nullptr, std::forward<Args>(args)...);
-		newNode->Next = position.mNode->Next;
+		Node* newNode = mNodePool.Create(position.mNode->Next, std::forward<Args>(args)...);
 		position.mNode->Next = newNode;
 
+		if (position.mNode == mBack)
+		{
+			mBack = newNode;
+		}
+
+		mSize++;
+
 		return Iterator(*this, newNode);
 	}
 	
@@ -513,7 +520,9 @@ namespace Library
 	{
 		if (mSize > 0)
 		{
+			Node* front = mFront;
 			mFront = mFront->Next;
+			mNodePool.Destroy(front);
 			mSize--;
 
 			if (mSize <= 1)
@@ -528,7 +537,7 @@ namespace Library
 	{
 		if (mSize > 1)
 		{
-			std::shared_ptr<Node> newBack = mFront;
+			Node* newBack = mFront;
 
 			while (newBack->Next != mBack)
 			{
@@ -536,6 +545,7 @@ namespace Library
 			}
 
 			newBack->Next = nullptr;
+			mNodePool.Destroy(mBack);
 			mBack = newBack;
 			mSize--;
 			
@@ -546,6 +556,7 @@ namespace Library
 		}
 		else if (mSize == 1)
 		{
+			mNodePool.Destroy(mFront);
 			mFront = nullptr;
 			mBack = nullptr;
 			mSize = 0;
@@ -576,10 +587,11 @@ namespace Library
 			}
 			else
 			{
-				std::shared_ptr<Node> next = it.mNode->Next;
+				Node* next = it.mNode->Next;
 				it.mNode->Data.~T();
 				new(&it.mNode->Data)T(std::move(next->Data));
 				it.mNode->Next = next->Next;
+				mNodePool.Destroy(next);
 
 				if (it.mNode->Next == nullptr)
 				{
@@ -598,6 +610,15 @@ namespace Library
 	template<typename T>
 	inline void SList<T>::Clear()
 	{
+		while (mFront != nullptr)
+		{
+			Node* next = mFront->Next;
+			mNodePool.Destroy(mFront);
+			mFront = next;
+		}
+
+		mNodePool.Clear();
+
 		mSize = 0;
 		mFront = nullptr;
 		mBack = nullptr;
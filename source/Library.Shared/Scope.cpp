@@ -16,81 +16,47 @@ namespace Library
 {
 #pragma region Constructors, Destructor, Assignment
 	Scope::Scope(const std::size_t capacity) :
-		mPairPtrs(capacity), mTable(std::max(Table::DefaultBucketCount, Math::FindNextPrime(capacity)))
+		mPairPtrs(capacity), mTable(std::in_place, std::max(Table::DefaultBucketCount, Math::FindNextPrime(capacity)))
+	{
+	}
+
+	Scope::Scope(const SlotIndex& slotIndex) :
+		mSlotIndex(&slotIndex), mSlots(std::make_unique<Data[]>(slotIndex.Size()))
 	{
 	}
 
 	Scope::~Scope()
 	{		
-		Clear();
+		Release();
 	}
 
-	Scope::Scope(const Scope& rhs) :
-		mPairPtrs(rhs.mPairPtrs.Size()), mTable(rhs.mTable.BucketCount())
+	Scope::Scope(const Scope& rhs)
 	{
-		for (const auto& tableEntryPtr : rhs.mPairPtrs)
-		{
-			if (tableEntryPtr->second.Type() == Types::Scope)
-			{
-				Data data;
-				data.SetType(Types::Scope);
-				
-				for (std::size_t i = 0; i < tableEntryPtr->second.Size(); ++i)
-				{
-					mChildren.EmplaceBack(tableEntryPtr->second[i].Clone());
-					mChildren.Back()->mParent = this;
-					data.EmplaceBack<Scope*>(mChildren.Back());
-				}
-
-				mPairPtrs.EmplaceBack(&(*mTable.TryEmplace(tableEntryPtr->first, data).first));
-			}
-			else
-			{
-				mPairPtrs.EmplaceBack(&(*mTable.Emplace(*tableEntryPtr).first));
-			}
-		}
+		CopyAttributes(rhs);
 	}
 
 	Scope& Scope::operator=(const Scope& rhs)
 	{
 		Clear();
 
-		mTable = Table(rhs.mTable.BucketCount());
-		
 		mPairPtrs.ShrinkToFit();
-		mPairPtrs.Reserve(rhs.mPairPtrs.Size());
-
-		for (const auto& tableEntryPtr : rhs.mPairPtrs)
-		{
-			if (tableEntryPtr->second.Type() == Types::Scope)
-			{
-				Data data;
-				data.SetType(Types::Scope);
-				
-				for (std::size_t i = 0; i < tableEntryPtr->second.Size(); ++i)
-				{
-					mChildren.EmplaceBack(tableEntryPtr->second[i].Clone());
-					mChildren.Back()->mParent = this;
-					data.EmplaceBack<Scope*>(mChildren.Back());
-				}
-
-				mPairPtrs.EmplaceBack(&(*mTable.TryEmplace(tableEntryPtr->first, data).first));
-			}
-			else
-			{
-				mPairPtrs.EmplaceBack(&(*mTable.Emplace(*tableEntryPtr).first));
-			}
-		}
+		CopyAttributes(rhs);
 
 		return *this;
 	}
 
 	Scope::Scope(Scope&& rhs) noexcept :
-		mPairPtrs(std::move(rhs.mPairPtrs)), mParent(rhs.mParent), mTable(std::move(rhs.mTable)), mChildren(std::move(rhs.mChildren))
+		mPairPtrs(std::move(rhs.mPairPtrs)), mParent(rhs.mParent), mSlotIndex(rhs.mSlotIndex), mSlots(std::move(rhs.mSlots)), 
+		mTable(std::move(rhs.mTable)), mChildren(std::move(rhs.mChildren))
 	{
+		rhs.mSlotIndex = nullptr;
+		rhs.mTable.reset();
+		rhs.AdvanceGeneration();
+
 		for (auto& child : mChildren)
 		{
 			child->mParent = this;
+			child->AdvanceGeneration();
 		}
 
 		if (rhs.mParent)
@@ -115,13 +81,20 @@ namespace Library
 		Clear();
 
 		mParent = rhs.mParent;
+		mSlotIndex = rhs.mSlotIndex;
+		mSlots = std::move(rhs.mSlots);
 		mTable = std::move(rhs.mTable);
 		mPairPtrs = std::move(rhs.mPairPtrs);
 		mChildren = std::move(rhs.mChildren);
 
+		rhs.mSlotIndex = nullptr;
+		rhs.mTable.reset();
+		rhs.AdvanceGeneration();
+
 		for (auto& child : mChildren)
 		{
 			child->mParent = this;
+			child->AdvanceGeneration();
 		}
 
 		if (rhs.mParent)
@@ -138,8 +111,8 @@ namespace Library
 		return *this;
 	}
 
-	Scope::Scope(std::initializer_list<Attribute> rhs, const std::size_t capacity) :
-		mPairPtrs(capacity), mTable(std::max(Table::DefaultBucketCount, Math::FindNextPrime(capacity)))
+	Scope::Scope(std::initializer_list<Entry> rhs, const std::size_t capacity) :
+		mPairPtrs(capacity), mTable(std::in_place, std::max(Table::DefaultBucketCount, Math::FindNextPrime(capacity)))
 	{
 		for (const auto& tableEntry : rhs)
 		{
@@ -159,23 +132,23 @@ namespace Library
 					mChildren.Back()->mParent = this;
 					data.EmplaceBack<Scope*>(mChildren.Back());
 
-					auto [it, isNew] = mTable.TryEmplace(tableEntry.first, Data(mChildren.Back()));
+					auto [it, isNew] = mTable->TryEmplace(tableEntry.first, Data(mChildren.Back()));
 					if (isNew) mPairPtrs.EmplaceBack(&(*it));
 					else it->second.EmplaceBack<Scope*>(mChildren.Back());
 				}
 			}
 			else
 			{
-				mPairPtrs.EmplaceBack(&(*mTable.Emplace(tableEntry).first));
+				mPairPtrs.EmplaceBack(&(*mTable->Emplace(tableEntry).first));
 			}
 		}
 	}
 
-	Scope& Scope::operator=(std::initializer_list<Attribute> rhs)
+	Scope& Scope::operator=(std::initializer_list<Entry> rhs)
 	{
 		Clear();
 		
-		mTable = Table(Math::FindNextPrime(rhs.size()));
+		mTable.emplace(Math::FindNextPrime(rhs.size()));
 
 		mPairPtrs.ShrinkToFit();
 		mPairPtrs.Reserve(rhs.size());
@@ -198,14 +171,14 @@ namespace Library
 					mChildren.Back()->mParent = this;
 					data.EmplaceBack<Scope*>(mChildren.Back());
 
-					auto [it, isNew] = mTable.TryEmplace(tableEntry.first, Data(mChildren.Back()));
+					auto [it, isNew] = mTable->TryEmplace(tableEntry.first, Data(mChildren.Back()));
 					if (isNew) mPairPtrs.EmplaceBack(&(*it));
 					else it->second.EmplaceBack<Scope*>(mChildren.Back());
 				}
 			}
 			else
 			{
-				mPairPtrs.EmplaceBack(&(*mTable.Emplace(tableEntry).first));
+				mPairPtrs.EmplaceBack(&(*mTable->Emplace(tableEntry).first));
 			}
 		}
 
@@ -218,16 +191,59 @@ namespace Library
 	}
 #pragma endregion Constructors, Destructor, Assignment
 
+#pragma region Slot Index
+	std::size_t Scope::SlotIndex::Append(const Key& key)
+	{
+		if (key.empty()) throw std::runtime_error("Name cannot be empty.");
+
+		const auto [it, isNew] = mSlots.TryEmplace(key, mKeys.Size());
+		if (!isNew) return it->second;
+
+		mSlotIds.TryEmplace(NameId(key).Id(), mKeys.Size());
+		mKeys.PushBack(key);
+
+		if (mKeys.Size() > mSlots.BucketCount())
+		{
+			mSlots.Rehash(Math::FindNextPrime(2 * mKeys.Size()));
+		}
+
+		return mKeys.Size() - 1;
+	}
+#pragma endregion Slot Index
+
+#pragma region Attribute Reference
+	void Scope::AttributeRef::Refresh()
+	{
+		mSearched.Clear();
+		mOwner = nullptr;
+		mData = nullptr;
+
+		for (Scope* scope = mOrigin; scope != nullptr; scope = scope->mParent)
+		{
+			mSearched.EmplaceBack(SearchedScope{ scope, scope->mGeneration.load(std::memory_order_relaxed) });
+			mData = scope->Find(mName);
+
+			if (mData)
+			{
+				mOwner = scope;
+				break;
+			}
+		}
+	}
+#pragma endregion Attribute Reference
+
 #pragma region Boolean Operators
 	bool Scope::operator==(const Scope& rhs) const noexcept
 	{
-		if (this == &rhs)								return true;
-		if (mPairPtrs.Size() != rhs.mPairPtrs.Size())	return false;
+		if (this == &rhs)				return true;
+		if (Size() != rhs.Size())		return false;
 
-		for (const auto& pairPtr : mPairPtrs)
+		for (std::size_t i = 0; i < Size(); ++i)
 		{
-			const Data* rhsData = rhs.Find(pairPtr->first);
-			if (!rhsData || pairPtr->second != *rhsData) return false;
+			const ConstAttribute attribute = AttributeAt(i);
+
+			const Data* rhsData = rhs.Find(attribute.first);
+			if (!rhsData || attribute.second != *rhsData) return false;
 		}
 
 		return true;
@@ -241,41 +257,32 @@ namespace Library
 
 #pragma region Size and Capacity
 	void Scope::Reserve(const std::size_t capacity)
-	{		
-		if (Math::FindNextPrime(capacity) > mTable.BucketCount())
-		{
-			Scope newScope = Scope(capacity);
+	{
+		const std::size_t slotCount = SlotCount();
+		if (capacity <= slotCount) return;
 
-			for (const auto& pairPtr : mPairPtrs)
-			{
-				newScope.Append(pairPtr->first) = std::move(pairPtr->second);
-			}
+		const std::size_t tableCapacity = capacity - slotCount;
 
-			*this = std::move(newScope);
-		}
-		else
+		if (!mTable || Math::FindNextPrime(tableCapacity) > mTable->BucketCount())
 		{
-			mPairPtrs.Reserve(capacity);
+			RehashTable(TableBucketCount(tableCapacity));
 		}
+
+		mPairPtrs.Reserve(tableCapacity);
 	}
 
 	void Scope::ShrinkToFit()
 	{
-		if (Math::FindNextPrime(mPairPtrs.Size()) < mTable.BucketCount())
+		if (mPairPtrs.IsEmpty())
 		{
-			Scope tmp = Scope(mPairPtrs.Size());
-
-			for (const auto& pairPtr : mPairPtrs)
-			{
-				tmp.Append(pairPtr->first) = std::move(pairPtr->second);
-			}
-
-			*this = std::move(tmp);
+			mTable.reset();
 		}
-		else
+		else if (TableBucketCount(mPairPtrs.Size()) < mTable->BucketCount())
 		{
-			mPairPtrs.ShrinkToFit();
+			RehashTable(TableBucketCount(mPairPtrs.Size()));
 		}
+
+		mPairPtrs.ShrinkToFit();
 	}
 #pragma endregion Size and Capacity
 
@@ -295,8 +302,13 @@ namespace Library
 
 	Scope::Data* Scope::Find(const Key& key)
 	{
-		Table::Iterator it = mTable.Find(key);
-		return it != mTable.end() ? &it->second : nullptr;
+		const std::size_t slot = FindSlot(key);
+		if (slot != SlotIndex::NotFound) return &mSlots[slot];
+
+		if (!mTable) return nullptr;
+
+		Table::Iterator it = mTable->Find(key);
+		return it != mTable->end() ? &it->second : nullptr;
 	}
 
 	const Scope::Data* Scope::Find(const Key& key) const
@@ -304,17 +316,35 @@ namespace Library
 		return const_cast<Scope*>(this)->Find(key);
 	}
 
+	Scope::Data* Scope::Find(const NameId& key)
+	{
+		const std::size_t slot = FindSlot(key);
+		if (slot != SlotIndex::NotFound) return &mSlots[slot];
+
+		if (!mTable) return nullptr;
+
+		Table::Iterator it = mTable->FindHashed(key.Name(), key.Hash());
+		return it != mTable->end() ? &it->second : nullptr;
+	}
+
+	const Scope::Data* Scope::Find(const NameId& key) const
+	{
+		return const_cast<Scope*>(this)->Find(key);
+	}
+
 	std::pair<Scope::Data*, std::size_t> Scope::FindScope(const Scope& scope)
 	{
-		for (auto& pairPtr : mPairPtrs)
+		for (std::size_t attributeIndex = 0; attributeIndex < Size(); ++attributeIndex)
 		{
-			if (pairPtr->second.Type() == Types::Scope)
+			Data& data = (*this)[attributeIndex];
+
+			if (data.Type() == Types::Scope)
 			{
-				for (std::size_t i = 0; i < pairPtr->second.Size(); ++i)
+				for (std::size_t i = 0; i < data.Size(); ++i)
 				{
-					if (&scope == pairPtr->second.Get<Data::ScopePointer>(i))
+					if (&scope == data.Get<Data::ScopePointer>(i))
 					{
-						return { &pairPtr->second, i };
+						return { &data, i };
 					}
 				}
 			}
@@ -325,24 +355,32 @@ namespace Library
 
 	std::pair<const Scope::Data*, std::size_t> Scope::FindScope(const Scope& scope) const
 	{
-		for (auto& pairPtr : mPairPtrs)
+		return const_cast<Scope*>(this)->FindScope(scope);
+	}
+
+	Scope::Data* Scope::Search(const Key& key, Scope** scopePtrOut)
+	{
+		Data* result = nullptr;
+		Scope* parent = this;
+
+		while (parent != nullptr)
 		{
-			if (pairPtr->second.Type() == Types::Scope)
-			{
-				for (std::size_t i = 0; i < pairPtr->second.Size(); ++i)
-				{
-					if (&scope == pairPtr->second.Get<Data::ScopePointer>(i))
-					{
-						return { &pairPtr->second, i };
-					}
-				}
-			}
+			result = parent->Find(key);
+			if (result) break;
+			
+			parent = parent->mParent;
 		}
 
-		return { nullptr, 0 };
+		if (scopePtrOut) *scopePtrOut = parent;
+		return result;
 	}
 
-	Scope::Data* Scope::Search(const Key& key, Scope** scopePtrOut)
+	const Scope::Data* Scope::Search(const Key& key, const Scope** scopePtrOut) const
+	{
+		return const_cast<Scope*>(this)->Search(key, const_cast<Scope**>(scopePtrOut));
+	}
+
+	Scope::Data* Scope::Search(const NameId& key, Scope** scopePtrOut)
 	{
 		Data* result = nullptr;
 		Scope* parent = this;
@@ -359,35 +397,56 @@ namespace Library
 		return result;
 	}
 
-	const Scope::Data* Scope::Search(const Key& key, const Scope** scopePtrOut) const
+	const Scope::Data* Scope::Search(const NameId& key, const Scope** scopePtrOut) const
 	{
 		return const_cast<Scope*>(this)->Search(key, const_cast<Scope**>(scopePtrOut));
 	}
 
 	Scope::Data* Scope::SearchChildren(const Key& key, Scope** scopePtrOut)
 	{
-		return SearchChildrenHelper({ this }, key, scopePtrOut);
+		SmallVector<Scope*, 32> queue;
+		queue.EmplaceBack(this);
+
+		for (std::size_t i = 0; i < queue.Size(); ++i)
+		{
+			Scope* scope = queue[i];
+			Data* result = scope->Find(key);
+
+			if (result)
+			{
+				if (scopePtrOut) *scopePtrOut = scope;
+				return result;
+			}
+
+			for (auto& child : scope->mChildren)
+			{
+				queue.EmplaceBack(child);
+			}
+		}
+
+		if (scopePtrOut) *scopePtrOut = nullptr;
+		return nullptr;
 	}
 
 	const Scope::Data* Scope::SearchChildren(const Key& key, const Scope** scopePtrOut) const
 	{
-		const Vector queue = { const_cast<Scope*>(this) };
-		return SearchChildrenHelper(queue, key, const_cast<Scope**>(scopePtrOut));
+		return const_cast<Scope*>(this)->SearchChildren(key, const_cast<Scope**>(scopePtrOut));
 	}
 
 	void Scope::ForEachAttribute(const std::function<void(Attribute&)>& functor)
 	{
-		for (auto& pair : mPairPtrs)
+		for (std::size_t i = 0; i < Size(); ++i)
 		{
-			functor(*pair);
+			Attribute attribute = AttributeAt(i);
+			functor(attribute);
 		}
 	}
 
-	void Scope::ForEachAttribute(const std::function<void(const Attribute&)>& functor) const
+	void Scope::ForEachAttribute(const std::function<void(const ConstAttribute&)>& functor) const
 	{
-		for (const auto& pair : mPairPtrs)
+		for (std::size_t i = 0; i < Size(); ++i)
 		{
-			functor(*pair);
+			functor(AttributeAt(i));
 		}
 	}
 #pragma endregion Accessors
@@ -397,12 +456,26 @@ namespace Library
 	{
 		if (key.empty()) throw std::runtime_error("Name cannot be empty.");
 
-		auto [it, isNew] = mTable.TryEmplace(key, Data());
-		if (isNew) mPairPtrs.EmplaceBack(&(*it));
+		const std::size_t slot = FindSlot(key);
+		if (slot != SlotIndex::NotFound) return mSlots[slot];
+
+		auto [it, isNew] = EnsureTable().TryEmplace(key, Data());
+
+		if (isNew)
+		{
+			mPairPtrs.EmplaceBack(&(*it));
+			AdvanceGeneration();
+		}
 
 		return it->second;
 	}
 
+	Scope::Data& Scope::Append(const NameId& key)
+	{
+		Data* data = Scope::Find(key);
+		return data ? *data : Append(Key(key.Name()));
+	}
+
 	Scope& Scope::AppendScope(const Key& key, const std::size_t capacity)
 	{
 		if (key.empty()) throw std::runtime_error("Name cannot be empty.");
@@ -424,7 +497,8 @@ namespace Library
 		}
 		else
 		{
-			mPairPtrs.EmplaceBack(&(*mTable.TryEmplace(key, Data(mChildren.Back())).first));
+			mPairPtrs.EmplaceBack(&(*EnsureTable().TryEmplace(key, Data(mChildren.Back())).first));
+			AdvanceGeneration();
 		}
 
 		return *child;
@@ -439,6 +513,7 @@ namespace Library
 		data->RemoveAt(index);
 		mChildren.Remove(&child);
 		child.mParent = nullptr;
+		child.AdvanceGeneration();
 
 		return &child;
 	}
@@ -458,6 +533,7 @@ namespace Library
 	
 		Scope* orphan = child.mParent ? child.mParent->Orphan(child) : &child;
 		orphan->mParent = this;
+		orphan->AdvanceGeneration();
 		mChildren.EmplaceBack(orphan);
 
 		if (data)
@@ -466,7 +542,8 @@ namespace Library
 		}
 		else
 		{
-			mPairPtrs.EmplaceBack(&(*mTable.TryEmplace(key, Data(mChildren.Back())).first));
+			mPairPtrs.EmplaceBack(&(*EnsureTable().TryEmplace(key, Data(mChildren.Back())).first));
+			AdvanceGeneration();
 		}
 
 		return *mChildren.Back();
@@ -474,9 +551,20 @@ namespace Library
 
 	void Scope::Clear()
 	{
-		mTable.Clear();
+		AdvanceGeneration();
+		Release();
+	}
+#pragma endregion Modifiers
+
+#pragma region Helper Methods
+	void Scope::Release()
+	{
+		if (mTable) mTable->Clear();
 		mPairPtrs.Clear();
 
+		mSlotIndex = nullptr;
+		mSlots.reset();
+
 		for (auto& child : mChildren)
 		{
 			if (child != nullptr)
@@ -489,35 +577,76 @@ namespace Library
 
 		mChildren.Clear();
 	}
-#pragma endregion Modifiers
 
-#pragma region Helper Methods
-	Scope::Data* Scope::SearchChildrenHelper(const Vector<Scope*>& queue, const Key& key, Scope** scopePtrOut)
+	void Scope::CopyAttributes(const Scope& rhs)
 	{
-		Vector<Scope*> newQueue;
+		mSlotIndex = rhs.mSlotIndex;
 
-		for (auto& scopePtr : queue)
+		if (mSlotIndex)
 		{
-			Data* result = scopePtr->Find(key);
+			mSlots = std::make_unique<Data[]>(mSlotIndex->Size());
 
-			if (result)
+			for (std::size_t slot = 0; slot < mSlotIndex->Size(); ++slot)
 			{
-				if (scopePtrOut) *scopePtrOut = scopePtr;
-				return result;
+				mSlots[slot] = rhs.mSlots[slot];
+				CloneChildren(mSlots[slot]);
 			}
+		}
 
-			newQueue.Reserve(scopePtr->mChildren.Size());
+		if (!rhs.mTable)
+		{
+			mTable.reset();
+			return;
+		}
 
-			for (auto& child : scopePtr->mChildren)
-			{
-				newQueue.EmplaceBack(child);
-			}
+		mTable.emplace(*rhs.mTable);
+		mPairPtrs.Reserve(rhs.mPairPtrs.Size());
+
+		for (const auto& pairPtr : rhs.mPairPtrs)
+		{
+			Entry& entry = *mTable->Find(pairPtr->first);
+			CloneChildren(entry.second);
+			mPairPtrs.EmplaceBack(&entry);
 		}
+	}
 
-		if (newQueue.Size() > 0) return SearchChildrenHelper(newQueue, key, scopePtrOut);
+	void Scope::CloneChildren(Data& data)
+	{
+		if (data.Type() != Types::Scope) return;
 
-		if (scopePtrOut) *scopePtrOut = nullptr;
-		return nullptr;
+		for (std::size_t i = 0; i < data.Size(); ++i)
+		{
+			mChildren.EmplaceBack(data[i].Clone());
+			mChildren.Back()->mParent = this;
+			data.Get<Scope*>(i) = mChildren.Back();
+		}
+	}
+
+	Scope::Table& Scope::EnsureTable()
+	{
+		if (!mTable) mTable.emplace(TableBucketCount(0));
+		return *mTable;
+	}
+
+	std::size_t Scope::TableBucketCount(const std::size_t capacity) const
+	{
+		return std::max(mSlotIndex ? OverflowBucketCount : Table::DefaultBucketCount, Math::FindNextPrime(capacity));
+	}
+
+	void Scope::RehashTable(const std::size_t bucketCount)
+	{
+		Table table(bucketCount);
+		SmallVector<Entry*, 4> pairPtrs(mPairPtrs.Size());
+
+		for (const auto& pairPtr : mPairPtrs)
+		{
+			pairPtrs.EmplaceBack(&(*table.TryEmplace(pairPtr->first, std::move(pairPtr->second)).first));
+		}
+
+		mTable = std::move(table);
+		mPairPtrs = std::move(pairPtrs);
+
+		AdvanceGeneration();
 	}
 #pragma endregion Helper Methods
 	
@@ -527,22 +656,22 @@ namespace Library
 		std::ostringstream oss;
 		oss << "Scope(";
 
-		for (std::size_t pairIndex = 0; pairIndex < mPairPtrs.Size(); ++pairIndex)
+		for (std::size_t pairIndex = 0; pairIndex < Size(); ++pairIndex)
 		{
-			const auto& pairPtr = mPairPtrs[pairIndex];
+			const ConstAttribute attribute = AttributeAt(pairIndex);
 
-			oss << "'" << pairPtr->first << "':{ ";
+			oss << "'" << attribute.first << "':{ ";
 
-			for (std::size_t dataIndex = 0; dataIndex < pairPtr->second.Size(); ++dataIndex)
+			for (std::size_t dataIndex = 0; dataIndex < attribute.second.Size(); ++dataIndex)
 			{
-				oss << pairPtr->second.ToString(dataIndex);
+				oss << attribute.second.ToString(dataIndex);
 
-				if (dataIndex < pairPtr->second.Size() - 1) oss << ",";
+				if (dataIndex < attribute.second.Size() - 1) oss << ",";
 			}
 			
 			oss << " }";
 
-			if (pairIndex < pairPtr->second.Size() - 1) oss << ",";
+			if (pairIndex < attribute.second.Size() - 1) oss << ",";
 		}
 
 		oss << ")";
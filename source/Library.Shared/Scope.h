@@ -3,15 +3,22 @@
 #pragma region Includes
 // Standard
 #include <string>
+#include <memory>
+#include <optional>
+#include <atomic>
+#include <cstdint>
 
 // Third Party
 #include <gsl/gsl>
 
 // First Party
 #include "RTTI.h"
+#include "NameId.h"
 #include "HashMap.h"
+#include "FlatHashMap.h"
 #include "Datum.h"
 #include "Vector.h"
+#include "SmallVector.h"
 #include "SList.h"
 #pragma endregion Includes
 
@@ -47,9 +54,185 @@ namespace Library
 		using Table = HashMap<Key, Data>;
 
 		/// <summary>
-		/// Attribute type defining a key and data value pair.
+		/// Table entry type owning a key and data value pair.
 		/// </summary>
-		using Attribute = Table::Pair;
+		using Entry = Table::Pair;
+
+		/// <summary>
+		/// Attribute type referencing the key and data value of a table entry or slot.
+		/// </summary>
+		using Attribute = std::pair<const Key&, Data&>;
+
+		/// <summary>
+		/// Attribute type referencing the key and constant data value of a table entry or slot.
+		/// </summary>
+		using ConstAttribute = std::pair<const Key&, const Data&>;
+
+		/// <summary>
+		/// Minimum bucket count of the table holding the Attributes not found in the SlotIndex of a Scope.
+		/// </summary>
+		static constexpr std::size_t OverflowBucketCount{ 7 };
+
+		/// <summary>
+		/// Read-only mapping of keys to slots, shared by every Scope constructed from it.
+		/// Keys are stored once in the index, so each Scope only holds a dense array of Data values for them.
+		/// </summary>
+		class SlotIndex final
+		{
+		public:
+			/// <summary>
+			/// Value returned by Find for keys without a slot.
+			/// </summary>
+			static constexpr std::size_t NotFound{ SIZE_MAX };
+
+			/// <summary>
+			/// Gets the number of slots.
+			/// </summary>
+			/// <returns>Number of slots.</returns>
+			std::size_t Size() const;
+
+			/// <summary>
+			/// Gets the key of a slot.
+			/// </summary>
+			/// <param name="slot">Slot of the key.</param>
+			/// <returns>Key of the slot.</returns>
+			/// <exception cref="std::out_of_range">Index is out of bounds.</exception>
+			const Key& operator[](const std::size_t slot) const;
+
+			/// <summary>
+			/// Gets the slot of a key.
+			/// </summary>
+			/// <param name="key">Key to be found.</param>
+			/// <returns>Slot of the key, or NotFound.</returns>
+			std::size_t Find(const Key& key) const;
+
+			/// <summary>
+			/// Gets the slot of an interned name, an integer lookup on its identifier.
+			/// </summary>
+			/// <param name="key">Interned name to be found.</param>
+			/// <returns>Slot of the name, or NotFound.</returns>
+			std::size_t Find(const NameId& key) const;
+
+			/// <summary>
+			/// Appends a slot for a key, if it does not already have one, and interns the key.
+			/// Keys are the prescribed Attribute names of a type, so the set of interned names stays bounded.
+			/// </summary>
+			/// <param name="key">Key to be appended.</param>
+			/// <returns>Slot of the key.</returns>
+			/// <exception cref="std::runtime_error">Key value cannot be empty.</exception>
+			std::size_t Append(const Key& key);
+
+		private:
+			/// <summary>
+			/// Key of each slot.
+			/// </summary>
+			Vector<Key> mKeys;
+
+			/// <summary>
+			/// Slot of each key.
+			/// </summary>
+			HashMap<Key, std::size_t> mSlots;
+
+			/// <summary>
+			/// Slot of each key, by the identifier of its interned name.
+			/// </summary>
+			FlatHashMap<NameId::IdType, std::size_t> mSlotIds;
+		};
+
+		/// <summary>
+		/// Handle to an Attribute found by searching a Scope and its ancestors, as returned by Resolve.
+		/// Caches the owning Scope and Data value, along with the generation of every Scope searched to find them,
+		/// and searches again only after one of those Scopes has changed shape. Changes elsewhere in the tree keep it cached.
+		/// Must not outlive the Scope it was resolved from.
+		/// </summary>
+		class AttributeRef final
+		{
+			friend Scope;
+
+		public:
+			/// <summary>
+			/// Default constructor, referencing no Attribute.
+			/// </summary>
+			AttributeRef() = default;
+
+			/// <summary>
+			/// Gets the Data value of the Attribute, searching again if it is not current.
+			/// </summary>
+			/// <returns>If found, a pointer to the Data value of the Attribute. Otherwise, nullptr.</returns>
+			Data* Get();
+
+			/// <summary>
+			/// Gets the Scope owning the Attribute, searching again if it is not current.
+			/// </summary>
+			/// <returns>If found, a pointer to the Scope owning the Attribute. Otherwise, nullptr.</returns>
+			Scope* Owner();
+
+			/// <summary>
+			/// Gets the Scope the search starts from.
+			/// </summary>
+			/// <returns>Pointer to the Scope the Attribute was resolved from, or nullptr.</returns>
+			Scope* Origin() const;
+
+			/// <summary>
+			/// Gets the interned name of the Attribute.
+			/// </summary>
+			/// <returns>Interned name of the Attribute.</returns>
+			const NameId& Name() const;
+
+			/// <summary>
+			/// Checks whether the cached result is current, meaning no Scope searched to find it has changed shape since.
+			/// </summary>
+			/// <returns>True if the cached result is current, otherwise false.</returns>
+			bool IsCurrent() const;
+
+		private:
+			/// <summary>
+			/// Scope searched to find the Attribute, and its generation at the time.
+			/// </summary>
+			struct SearchedScope final
+			{
+				const Scope* Searched;
+				std::uint64_t Generation;
+			};
+
+			/// <summary>
+			/// Specialized constructor used by Resolve.
+			/// </summary>
+			/// <param name="origin">Scope the search starts from.</param>
+			/// <param name="name">Interned name of the Attribute.</param>
+			AttributeRef(Scope& origin, const NameId& name);
+
+			/// <summary>
+			/// Searches the origin and its ancestors again, recording the generation of each Scope searched.
+			/// </summary>
+			void Refresh();
+
+			/// <summary>
+			/// Scope the search starts from.
+			/// </summary>
+			Scope* mOrigin{ nullptr };
+
+			/// <summary>
+			/// Interned name of the Attribute.
+			/// </summary>
+			NameId mName;
+
+			/// <summary>
+			/// Scope owning the Attribute, if found.
+			/// </summary>
+			Scope* mOwner{ nullptr };
+
+			/// <summary>
+			/// Data value of the Attribute, if found.
+			/// </summary>
+			Data* mData{ nullptr };
+
+			/// <summary>
+			/// Scopes searched to find the Attribute, from the origin up to the owner, or the root if not found.
+			/// Empty until the first search.
+			/// </summary>
+			SmallVector<SearchedScope, 8> mSearched;
+		};
 #pragma endregion Type Definitions and Constants
 
 #pragma region Constructors, Destructor, Assignment
@@ -104,7 +287,7 @@ namespace Library
 		/// <param name="capacity">Capacity to initialize for the Scope.</param>
 		/// <exception cref="std::runtime_error">Duplicate names found in the initializer list.</exception>
 		/// <remarks>Data values are copied.</remarks>
-		Scope(std::initializer_list<Attribute> rhs, const std::size_t capacity=0);
+		Scope(std::initializer_list<Entry> rhs, const std::size_t capacity=0);
 
 		/// <summary>
 		/// Initializer list assignment operator.
@@ -113,7 +296,7 @@ namespace Library
 		/// <returns>Reference to the modified Scope containing the new pairs.</returns>
 		/// <exception cref="std::runtime_error">Duplicate names found in the initializer list.</exception>
 		/// <remarks>Data values are copied.</remarks>
-		Scope& operator=(std::initializer_list<Attribute> rhs);
+		Scope& operator=(std::initializer_list<Entry> rhs);
 
 		/// <summary>
 		/// Creates a heap allocated copy of the current Scope.
@@ -121,6 +304,14 @@ namespace Library
 		/// <returns>Pointer to a newly heap allocated Scope copy.</returns>
 		/// <remarks>Override in derived classes to support copy construction and assignment as a nested Scope.</remarks>
 		virtual gsl::owner<Scope*> Clone() const;
+
+	protected:
+		/// <summary>
+		/// Constructor storing the Attributes of a SlotIndex in slots, rather than in the table.
+		/// Only Attributes not found in the SlotIndex are appended to the table, which is allocated on first use.
+		/// </summary>
+		/// <param name="slotIndex">SlotIndex shared with other instances, which must outlive the Scope.</param>
+		explicit Scope(const SlotIndex& slotIndex);
 #pragma endregion Constructors, Destructor, Assignment
 
 #pragma region Boolean Operators
@@ -162,6 +353,12 @@ namespace Library
 		/// <remarks>This is not equivalent to the max size. It is the max size before new memory will be allocated.</remarks>
 		std::size_t Capacity() const;
 
+		/// <summary>
+		/// Gets the number of Attribute values stored in slots, which always come first.
+		/// </summary>
+		/// <returns>Number of Attribute values stored in slots.</returns>
+		std::size_t SlotCount() const;
+
 		/// <summary>
 		/// Reserves memory for a given number of elements.
 		/// </summary>
@@ -248,6 +445,22 @@ namespace Library
 		/// <returns>If found, a pointer to the Data value. Otherwise, nullptr.</returns>
 		const Data* Find(const Key& key) const;
 
+		/// <summary>
+		/// Finds the Data value associated with the given interned name, if it exists.
+		/// Uses the precomputed hash code of the name rather than hashing the key.
+		/// </summary>
+		/// <param name="key">Interned name associated with the Data value to be found.</param>
+		/// <returns>If found, a pointer to the Data value. Otherwise, nullptr.</returns>
+		virtual Data* Find(const NameId& key);
+
+		/// <summary>
+		/// Finds the Data value associated with the given interned name, if it exists.
+		/// Uses the precomputed hash code of the name rather than hashing the key.
+		/// </summary>
+		/// <param name="key">Interned name associated with the Data value to be found.</param>
+		/// <returns>If found, a pointer to the Data value. Otherwise, nullptr.</returns>
+		const Data* Find(const NameId& key) const;
+
 		/// <summary>
 		/// Gets a pointer to the constant Key value for the Attribute at the given index, if it exists.
 		/// </summary>
@@ -285,6 +498,22 @@ namespace Library
 		/// <returns>If found, a pointer to the Data value of the Attribute. Otherwise, nullptr.</returns>
 		const Data* Search(const Key& key, const Scope** scopePtrOut=nullptr) const;
 
+		/// <summary>
+		/// Searches the scope and its ancestors for an Attribute with the given interned name.
+		/// </summary>
+		/// <param name="key">Interned name of the Attribute to be found.</param>
+		/// <param name="scopePtrOut">Output parameter that points to the Scope which owns the found Attribute.</param>
+		/// <returns>If found, a pointer to the Data value of the Attribute. Otherwise, nullptr.</returns>
+		Data* Search(const NameId& key, Scope** scopePtrOut=nullptr);
+
+		/// <summary>
+		/// Searches the scope and its ancestors for an Attribute with the given interned name.
+		/// </summary>
+		/// <param name="key">Interned name of the Attribute to be found.</param>
+		/// <param name="scopePtrOut">Output parameter that points to the Scope which owns the found Attribute.</param>
+		/// <returns>If found, a pointer to the Data value of the Attribute. Otherwise, nullptr.</returns>
+		const Data* Search(const NameId& key, const Scope** scopePtrOut=nullptr) const;
+
 		/// <summary>
 		/// Performs a breadth-first search on the scope and its children for a Attribute with a matching Key value.
 		/// </summary>
@@ -301,6 +530,20 @@ namespace Library
 		/// <returns>If found, a pointer to the Data value of the Attribute. Otherwise, nullptr.</returns>
 		const Data* SearchChildren(const Key& key, const Scope** scopePtrOut=nullptr) const;
 
+		/// <summary>
+		/// Resolves an Attribute the way Search does, into a handle that keeps the result until any Scope changes shape.
+		/// </summary>
+		/// <param name="key">Interned name of the Attribute to be found.</param>
+		/// <returns>Handle to the Attribute, which may not be found.</returns>
+		AttributeRef Resolve(const NameId& key);
+
+		/// <summary>
+		/// Resolves an Attribute the way Search does, into a handle that keeps the result until any Scope changes shape.
+		/// </summary>
+		/// <param name="key">Key value of the Attribute to be found.</param>
+		/// <returns>Handle to the Attribute, which may not be found.</returns>
+		AttributeRef Resolve(const Key& key);
+
 		/// <summary>
 		/// Performs an action iteratively on each Attribute in the Scope.
 		/// </summary>
@@ -311,7 +554,38 @@ namespace Library
 		/// Performs an action iteratively on each Attribute in the Scope.
 		/// </summary>
 		/// <param name="functor">Function object to be called on each Attribute.</param>
-		void ForEachAttribute(const std::function<void(const Attribute&)>& functor) const;
+		void ForEachAttribute(const std::function<void(const ConstAttribute&)>& functor) const;
+
+	protected:
+		/// <summary>
+		/// Gets the Attribute at the given index.
+		/// </summary>
+		/// <param name="index">Index of the Attribute.</param>
+		/// <returns>Attribute at the given index.</returns>
+		/// <exception cref="std::out_of_range">Index is out of bounds.</exception>
+		Attribute AttributeAt(const std::size_t index);
+
+		/// <summary>
+		/// Gets the Attribute at the given index.
+		/// </summary>
+		/// <param name="index">Index of the Attribute.</param>
+		/// <returns>Attribute at the given index.</returns>
+		/// <exception cref="std::out_of_range">Index is out of bounds.</exception>
+		ConstAttribute AttributeAt(const std::size_t index) const;
+
+		/// <summary>
+		/// Gets the slot of the Attribute with the given Key value.
+		/// </summary>
+		/// <param name="key">Key value of the Attribute.</param>
+		/// <returns>Slot of the Attribute, or SlotIndex::NotFound if it is not stored in a slot.</returns>
+		std::size_t FindSlot(const Key& key) const;
+
+		/// <summary>
+		/// Gets the slot of the Attribute with the given interned name.
+		/// </summary>
+		/// <param name="key">Interned name of the Attribute.</param>
+		/// <returns>Slot of the Attribute, or SlotIndex::NotFound if it is not stored in a slot.</returns>
+		std::size_t FindSlot(const NameId& key) const;
 #pragma endregion Accessors
 
 #pragma region Modifiers
@@ -324,6 +598,14 @@ namespace Library
 		/// <exception cref="std::runtime_error">Key value cannot be empty.</exception>
 		Data& Append(const Key& key);
 
+		/// <summary>
+		/// Appends a Attribute to the Scope with the given interned name and a default data value.
+		/// </summary>
+		/// <param name="key">Interned name for the Attribute to be accessed or appended.</param>
+		/// <returns>Reference to the Data value of the appended Attribute.</returns>
+		/// <exception cref="std::runtime_error">Key value cannot be empty.</exception>
+		Data& Append(const NameId& key);
+
 		/// <summary>
 		/// Appends a Attribute to the Scope with the given key and a default Scope value, as a child.
 		/// </summary>
@@ -350,7 +632,7 @@ namespace Library
 		Scope& Adopt(Scope& child, const Key& key);
 
 		/// <summary>
-		/// Clears all members of the scope.
+		/// Clears all members of the scope, including slots.
 		/// </summary>
 		void Clear();
 #pragma endregion Modifiers
@@ -358,14 +640,48 @@ namespace Library
 #pragma region Helper Methods
 	private:
 		/// <summary>
-		/// SearchChildren helper method. 
-		/// Performs a breadth-first search on the Scope and its children for a Attribute with a matching Key value.
+		/// Advances the generation of the Scope, so every AttributeRef that searched it searches again on its next use.
+		/// Called whenever the Scope gains or loses Attributes, its Data values move, or it changes parent.
 		/// </summary>
-		/// <param name="queue">Queue of Scope values to be searched.</param>
-		/// <param name="key">Key value of the Attribute to be found.</param>
-		/// <param name="scopePtrOut">Output parameter that points to the Scope which owns the found Attribute.</param>
-		/// <returns>If found, a pointer to the Data value of the Attribute. Otherwise, nullptr.</returns>
-		static Data* SearchChildrenHelper(const Vector<Scope*>& queue, const Key& key, Scope** scopePtrOut=nullptr);
+		void AdvanceGeneration();
+
+		/// <summary>
+		/// Removes every Attribute and deletes every child Scope, without advancing the generation.
+		/// Used by the destructor, since only handles resolved from its subtree, which is deleted along with it, could have searched it.
+		/// </summary>
+		void Release();
+
+		/// <summary>
+		/// Copies the slots and table entries of another Scope, cloning its child Scopes.
+		/// The table is copy constructed, so its buckets and entries are copied in a single pass and its functors are shared.
+		/// </summary>
+		/// <param name="rhs">Scope to be copied.</param>
+		void CopyAttributes(const Scope& rhs);
+
+		/// <summary>
+		/// Replaces the Scope pointers of a copied Data value with clones adopted as children of this Scope.
+		/// </summary>
+		/// <param name="data">Data value copied from another Scope.</param>
+		void CloneChildren(Data& data);
+
+		/// <summary>
+		/// Gets the table, allocating it if necessary.
+		/// </summary>
+		/// <returns>Reference to the table.</returns>
+		Table& EnsureTable();
+
+		/// <summary>
+		/// Gets the bucket count of a table sized for the given number of entries.
+		/// </summary>
+		/// <param name="capacity">Number of entries.</param>
+		/// <returns>Bucket count of the table.</returns>
+		std::size_t TableBucketCount(const std::size_t capacity) const;
+
+		/// <summary>
+		/// Moves the table entries into a table with a new bucket count, keeping their order.
+		/// </summary>
+		/// <param name="bucketCount">Bucket count of the new table.</param>
+		void RehashTable(const std::size_t bucketCount);
 #pragma endregion Helper Methods
 
 #pragma region RTTI Overrides
@@ -387,9 +703,9 @@ namespace Library
 #pragma region Data Members
 	protected:
 		/// <summary>
-		/// Vector of references to the TableEntryType values.
+		/// Vector of references to the table entries in order, held inline for small Scopes.
 		/// </summary>
-		Vector<Attribute*> mPairPtrs;
+		SmallVector<Entry*, 4> mPairPtrs;
 
 	private:
 		/// <summary>
@@ -398,14 +714,29 @@ namespace Library
 		Scope* mParent{ nullptr };
 
 		/// <summary>
-		/// Table containing TableEntryType values.
+		/// SlotIndex of the Attributes stored in slots, if any.
+		/// </summary>
+		const SlotIndex* mSlotIndex{ nullptr };
+
+		/// <summary>
+		/// Data values of the Attributes in the SlotIndex, in slot order.
+		/// </summary>
+		std::unique_ptr<Data[]> mSlots;
+
+		/// <summary>
+		/// Table containing the entries of Attributes not stored in slots, unset until first needed when using slots.
+		/// </summary>
+		std::optional<Table> mTable;
+
+		/// <summary>
+		/// Vector containing child Scopes, held inline for up to four children.
 		/// </summary>
-		Table mTable;
+		SmallVector<Scope*, 4> mChildren;
 
 		/// <summary>
-		/// SList containing child Scopes.
+		/// Generation of the Scope, advanced whenever it changes shape. Atomic, since jobs may read it while searching ancestors.
 		/// </summary>
-		Vector<Scope*> mChildren;
+		std::atomic<std::uint64_t> mGeneration{ 0 };
 #pragma endregion Data Members
 	};
 }
@@ -5,20 +5,90 @@
 
 namespace Library
 {
+#pragma region Slot Index
+	inline std::size_t Scope::SlotIndex::Size() const
+	{
+		return mKeys.Size();
+	}
+
+	inline const Scope::Key& Scope::SlotIndex::operator[](const std::size_t slot) const
+	{
+		return mKeys[slot];
+	}
+
+	inline std::size_t Scope::SlotIndex::Find(const Key& key) const
+	{
+		const auto it = mSlots.Find(key);
+		return it != mSlots.end() ? it->second : NotFound;
+	}
+
+	inline std::size_t Scope::SlotIndex::Find(const NameId& key) const
+	{
+		const auto it = mSlotIds.Find(key.Id());
+		return it != mSlotIds.end() ? it->second : NotFound;
+	}
+#pragma endregion Slot Index
+
+#pragma region Attribute Reference
+	inline Scope::AttributeRef::AttributeRef(Scope& origin, const NameId& name) :
+		mOrigin(&origin), mName(name)
+	{
+	}
+
+	inline Scope::Data* Scope::AttributeRef::Get()
+	{
+		if (!IsCurrent()) Refresh();
+		return mData;
+	}
+
+	inline Scope* Scope::AttributeRef::Owner()
+	{
+		if (!IsCurrent()) Refresh();
+		return mOwner;
+	}
+
+	inline Scope* Scope::AttributeRef::Origin() const
+	{
+		return mOrigin;
+	}
+
+	inline const NameId& Scope::AttributeRef::Name() const
+	{
+		return mName;
+	}
+
+	inline bool Scope::AttributeRef::IsCurrent() const
+	{
+		if (mSearched.IsEmpty()) return false;
+
+		for (const SearchedScope& searched : mSearched)
+		{
+			if (searched.Searched->mGeneration.load(std::memory_order_relaxed) != searched.Generation) return false;
+		}
+
+		return true;
+	}
+#pragma endregion Attribute Reference
+
 #pragma region Size and Capacity
 	inline std::size_t Scope::Size() const
 	{
-		return mTable.Size();
+		return SlotCount() + (mTable ? mTable->Size() : 0);
 	}
 
 	inline bool Scope::IsEmpty() const
 	{
-		return mTable.IsEmpty();
+		return Size() == 0;
 	}
 
 	inline std::size_t Scope::Capacity() const
 	{
-		return mPairPtrs.Capacity();
+		return SlotCount() + mPairPtrs.Capacity();
+	}
+
+	inline std::size_t Scope::SlotCount() const
+	{
+		return mSlotIndex ? mSlotIndex->Size() : 0;
 	}
 #pragma endregion Size and Capacity
 
@@ -49,17 +119,62 @@ namespace Library
 
 	inline Scope::Data& Scope::operator[](const std::size_t index)
 	{
-		return mPairPtrs[index]->second;
+		return AttributeAt(index).second;
 	}
 
 	inline const Scope::Data& Scope::operator[](const std::size_t index) const
 	{
-		return mPairPtrs[index]->second;
+		return AttributeAt(index).second;
 	}
 
 	inline const std::string* Scope::FindName(const std::size_t index) const
 	{
-		return index < mPairPtrs.Size() ? &mPairPtrs[index]->first : nullptr;
+		return index < Size() ? &AttributeAt(index).first : nullptr;
+	}
+
+	inline Scope::Attribute Scope::AttributeAt(const std::size_t index)
+	{
+		const std::size_t slotCount = SlotCount();
+		if (index < slotCount) return { (*mSlotIndex)[index], mSlots[index] };
+
+		Entry& entry = *mPairPtrs[index - slotCount];
+		return { entry.first, entry.second };
+	}
+
+	inline Scope::ConstAttribute Scope::AttributeAt(const std::size_t index) const
+	{
+		const std::size_t slotCount = SlotCount();
+		if (index < slotCount) return { (*mSlotIndex)[index], mSlots[index] };
+
+		const Entry& entry = *mPairPtrs[index - slotCount];
+		return { entry.first, entry.second };
+	}
+
+	inline std::size_t Scope::FindSlot(const Key& key) const
+	{
+		return mSlotIndex ? mSlotIndex->Find(key) : SlotIndex::NotFound;
+	}
+
+	inline std::size_t Scope::FindSlot(const NameId& key) const
+	{
+		return mSlotIndex ? mSlotIndex->Find(key) : SlotIndex::NotFound;
+	}
+
+	inline Scope::AttributeRef Scope::Resolve(const NameId& key)
+	{
+		return AttributeRef(*this, key);
+	}
+
+	inline Scope::AttributeRef Scope::Resolve(const Key& key)
+	{
+		return AttributeRef(*this, NameId(key));
 	}
 #pragma endregion Accessors
+
+#pragma region Helper Methods
+	inline void Scope::AdvanceGeneration()
+	{
+		mGeneration.fetch_add(1, std::memory_order_relaxed);
+	}
+#pragma endregion Helper Methods
 }
\ No newline at end of file
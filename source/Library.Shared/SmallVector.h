@@ -0,0 +1,365 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <initializer_list>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Represents a generic Vector list that holds up to N elements inside the object itself.
+	/// Memory is only taken from the heap once the capacity grows past N, and is given back when it shrinks to fit within N.
+	/// </summary>
+	/// <typeparam name="T">Data type of elements in a SmallVector. Elements are relocated with a bitwise copy, as in Vector.</typeparam>
+	/// <typeparam name="N">Number of elements held in the inline buffer.</typeparam>
+	template <typename T, std::size_t N>
+	class SmallVector final
+	{
+		static_assert(N > 0, "SmallVector requires an inline capacity.");
+
+#pragma region Type Definitions
+	public:
+		/// <summary>
+		/// Value type for std::iterator_trait.
+		/// </summary>
+		using value_type = T;
+
+		/// <summary>
+		/// Iterator type. Elements are contiguous, so a pointer serves as a random access iterator.
+		/// </summary>
+		using Iterator = T*;
+
+		/// <summary>
+		/// Const iterator type.
+		/// </summary>
+		using ConstIterator = const T*;
+
+		/// <summary>
+		/// Number of elements held in the inline buffer.
+		/// </summary>
+		static constexpr std::size_t InlineCapacity = N;
+#pragma endregion Type Definitions
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Default constructor.
+		/// </summary>
+		/// <param name="capacity">Default capacity for the SmallVector.</param>
+		explicit SmallVector(const std::size_t capacity=0);
+
+		/// <summary>
+		/// Destructor.
+		/// Clears all existing elements.
+		/// </summary>
+		~SmallVector();
+
+		/// <summary>
+		/// Copy constructor.
+		/// </summary>
+		/// <param name="rhs">SmallVector to be copied.</param>
+		SmallVector(const SmallVector& rhs);
+
+		/// <summary>
+		/// Copy assignment operator.
+		/// </summary>
+		/// <param name="rhs">SmallVector whose values are copied.</param>
+		/// <returns>Modified SmallVector with copied values.</returns>
+		SmallVector& operator=(const SmallVector& rhs);
+
+		/// <summary>
+		/// Move constructor.
+		/// Heap memory is taken over, inline elements are relocated into the new inline buffer.
+		/// </summary>
+		/// <param name="rhs">SmallVector to be moved.</param>
+		SmallVector(SmallVector&& rhs) noexcept;
+
+		/// <summary>
+		/// Move assignment operator.
+		/// Heap memory is taken over, inline elements are relocated into the inline buffer.
+		/// </summary>
+		/// <param name="rhs">SmallVector whose values are moved.</param>
+		/// <returns>Modified SmallVector with moved values.</returns>
+		SmallVector& operator=(SmallVector&& rhs) noexcept;
+
+		/// <summary>
+		/// Initializer list constructor.
+		/// </summary>
+		/// <param name="rhs">Value list for initializing a new SmallVector.</param>
+		SmallVector(std::initializer_list<T> rhs);
+#pragma endregion Special Members
+
+#pragma region Boolean Operators
+	public:
+		/// <summary>
+		/// Equals operator.
+		/// </summary>
+		/// <param name="rhs">SmallVector on the right hand side to be compared to the left.</param>
+		/// <returns>True when the sizes and values are equal, otherwise false.</returns>
+		bool operator==(const SmallVector& rhs) const;
+
+		/// <summary>
+		/// Not equal operator.
+		/// </summary>
+		/// <param name="rhs">SmallVector on the right hand side to be compared to the left.</param>
+		/// <returns>True when the sizes or values are not equal, otherwise false.</returns>
+		bool operator!=(const SmallVector& rhs) const;
+#pragma endregion Boolean Operators
+
+#pragma region Size and Capacity
+	public:
+		/// <summary>
+		/// Getter method for the number of elements in the SmallVector.
+		/// </summary>
+		/// <returns>Number of initialized elements.</returns>
+		std::size_t Size() const;
+
+		/// <summary>
+		/// Checks if the SmallVector contains no elements.
+		/// </summary>
+		/// <returns>True if the SmallVector contains no elements, otherwise false.</returns>
+		bool IsEmpty() const;
+
+		/// <summary>
+		/// Getter method for the max number of elements reserved.
+		/// </summary>
+		/// <returns>Max number of elements reserved.</returns>
+		std::size_t Capacity() const;
+
+		/// <summary>
+		/// Checks if the elements are held in the inline buffer.
+		/// </summary>
+		/// <returns>True if the capacity fits in the inline buffer, otherwise false.</returns>
+		bool IsInline() const;
+
+		/// <summary>
+		/// Reserves memory for the specified capacity, preserving any existing elements.
+		/// </summary>
+		/// <param name="capacity">Max number of elements to reserve.</param>
+		/// <exception cref="std::bad_alloc">Failed memory allocation.</exception>
+		void Reserve(const std::size_t capacity);
+
+		/// <summary>
+		/// Reduces the capacity of the SmallVector to fit the content size.
+		/// Moves the elements back into the inline buffer if they fit.
+		/// </summary>
+		/// <exception cref="std::bad_alloc">Failed memory reallocation.</exception>
+		void ShrinkToFit();
+#pragma endregion Size and Capacity
+
+#pragma region Iterator Accessors
+	public:
+		/// <summary>
+		/// Gets an Iterator pointing to the first element in the SmallVector.
+		/// </summary>
+		/// <returns>Iterator to the first element.</returns>
+		Iterator begin();
+
+		/// <summary>
+		/// Gets a ConstIterator pointing to the first element in the SmallVector.
+		/// </summary>
+		/// <returns>ConstIterator to the first element.</returns>
+		ConstIterator begin() const;
+
+		/// <summary>
+		/// Gets a ConstIterator pointing to the first element in the SmallVector.
+		/// </summary>
+		/// <returns>ConstIterator to the first element.</returns>
+		ConstIterator cbegin() const;
+
+		/// <summary>
+		/// Gets an Iterator pointing past the last element in the SmallVector.
+		/// </summary>
+		/// <returns>Iterator past the last element.</returns>
+		Iterator end();
+
+		/// <summary>
+		/// Gets a ConstIterator pointing past the last element in the SmallVector.
+		/// </summary>
+		/// <returns>ConstIterator past the last element.</returns>
+		ConstIterator end() const;
+
+		/// <summary>
+		/// Gets a ConstIterator pointing past the last element in the SmallVector.
+		/// </summary>
+		/// <returns>ConstIterator past the last element.</returns>
+		ConstIterator cend() const;
+
+		/// <summary>
+		/// Searches the SmallVector for a given value.
+		/// </summary>
+		/// <param name="value">Value to search for.</param>
+		/// <returns>Iterator referencing the value, if found. Otherwise an Iterator to the end.</returns>
+		Iterator Find(const T& value);
+
+		/// <summary>
+		/// Searches the SmallVector for a given value.
+		/// </summary>
+		/// <param name="value">Value to search for.</param>
+		/// <returns>ConstIterator referencing the value, if found. Otherwise a ConstIterator to the end.</returns>
+		ConstIterator Find(const T& value) const;
+#pragma endregion Iterator Accessors
+
+#pragma region Element Accessors
+	public:
+		/// <summary>
+		/// Getter method for the first element in the SmallVector.
+		/// </summary>
+		/// <returns>Reference to the first element.</returns>
+		/// <exception cref="runtime_error">Thrown when called on an empty SmallVector.</exception>
+		T& Front();
+
+		/// <summary>
+		/// Getter method for the first element in the SmallVector, as a constant.
+		/// </summary>
+		/// <returns>Const reference to the first element.</returns>
+		/// <exception cref="runtime_error">Thrown when called on an empty SmallVector.</exception>
+		const T& Front() const;
+
+		/// <summary>
+		/// Getter method for the last element in the SmallVector.
+		/// </summary>
+		/// <returns>Reference to the last element.</returns>
+		/// <exception cref="runtime_error">Thrown when called on an empty SmallVector.</exception>
+		T& Back();
+
+		/// <summary>
+		/// Getter method for the last element in the SmallVector, as a constant.
+		/// </summary>
+		/// <returns>Const reference to the last element.</returns>
+		/// <exception cref="runtime_error">Thrown when called on an empty SmallVector.</exception>
+		const T& Back() const;
+
+		/// <summary>
+		/// Retrieves a reference to the element at the specified index.
+		/// </summary>
+		/// <param name="index">Position of an element in the SmallVector.</param>
+		/// <returns>Reference to the element at the given index.</returns>
+		/// <exception cref="out_of_range">Index is out of bounds.</exception>
+		T& At(const std::size_t index);
+
+		/// <summary>
+		/// Retrieves a const reference to the element at the specified index.
+		/// </summary>
+		/// <param name="index">Position of an element in the SmallVector.</param>
+		/// <returns>Const reference to the element at the given index.</returns>
+		/// <exception cref="out_of_range">Index is out of bounds.</exception>
+		const T& At(const std::size_t index) const;
+
+		/// <summary>
+		/// Offset dereference operator.
+		/// </summary>
+		/// <param name="index">Position of an element in the SmallVector.</param>
+		/// <returns>Reference to the element at the given index.</returns>
+		/// <exception cref="out_of_range">Index is out of bounds.</exception>
+		T& operator[](const std::size_t index);
+
+		/// <summary>
+		/// Offset dereference operator.
+		/// </summary>
+		/// <param name="index">Position of an element in the SmallVector.</param>
+		/// <returns>Const reference to the element at the given index.</returns>
+		/// <exception cref="out_of_range">Index is out of bounds.</exception>
+		const T& operator[](const std::size_t index) const;
+#pragma endregion Element Accessors
+
+#pragma region Modifiers
+	public:
+		/// <summary>
+		/// Adds an element constructed from the given arguments to the back of the SmallVector.
+		/// </summary>
+		/// <param name="args">Argument list used to construct the element.</param>
+		/// <typeparam name="Args">Variadic list for constructor arguments.</typeparam>
+		/// <returns>Reference to the new element.</returns>
+		template<typename... Args>
+		T& EmplaceBack(Args&&... args);
+
+		/// <summary>
+		/// Adds an element to the back of the SmallVector.
+		/// </summary>
+		/// <param name="data">Value to be added.</param>
+		void PushBack(const T& data);
+
+		/// <summary>
+		/// Adds an element to the back of the SmallVector.
+		/// </summary>
+		/// <param name="data">Value to be added.</param>
+		void PushBack(T&& data);
+
+		/// <summary>
+		/// Removes the last element from the SmallVector.
+		/// </summary>
+		void PopBack();
+
+		/// <summary>
+		/// Removes the first element equal to the given value.
+		/// </summary>
+		/// <param name="value">Value to be removed.</param>
+		/// <returns>True on successful remove, false otherwise.</returns>
+		bool Remove(const T& value);
+
+		/// <summary>
+		/// Removes the element referenced by the given Iterator.
+		/// </summary>
+		/// <param name="it">Iterator referencing the element to be removed.</param>
+		/// <returns>True on successful remove, false otherwise.</returns>
+		/// <exception cref="runtime_error">Invalid Iterator.</exception>
+		bool Remove(const Iterator it);
+
+		/// <summary>
+		/// Removes all elements and resets the size to zero. The capacity is unchanged.
+		/// </summary>
+		void Clear();
+#pragma endregion Modifiers
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Gets the inline buffer as an element pointer.
+		/// </summary>
+		/// <returns>Pointer to the first inline element.</returns>
+		T* InlineData();
+
+		/// <summary>
+		/// Frees heap memory, if any, and points the SmallVector back at its empty inline buffer.
+		/// </summary>
+		void ReleaseStorage();
+
+		/// <summary>
+		/// Takes the elements of another SmallVector, leaving it empty.
+		/// </summary>
+		/// <param name="rhs">SmallVector whose elements are taken.</param>
+		void MoveFrom(SmallVector& rhs) noexcept;
+#pragma endregion Helper Methods
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Pointer to the elements, either the inline buffer or a heap block.
+		/// </summary>
+		T* mData{ InlineData() };
+
+		/// <summary>
+		/// Number of elements in the SmallVector.
+		/// </summary>
+		std::size_t mSize{ 0 };
+
+		/// <summary>
+		/// Number of elements reserved, but not necessarily initialized.
+		/// </summary>
+		std::size_t mCapacity{ 0 };
+
+		/// <summary>
+		/// Buffer holding the elements while the capacity fits in N.
+		/// </summary>
+		alignas(T) std::byte mInlineStorage[sizeof(T) * N];
+#pragma endregion Data Members
+	};
+}
+
+// Inline File
+#include "SmallVector.inl"
\ No newline at end of file
@@ -0,0 +1,410 @@
+#pragma once
+
+// Header
+#include "SmallVector.h"
+
+namespace Library
+{
+#pragma region Special Members
+	template<typename T, std::size_t N>
+	inline SmallVector<T, N>::SmallVector(const std::size_t capacity)
+	{
+		Reserve(capacity);
+	}
+
+	template<typename T, std::size_t N>
+	inline SmallVector<T, N>::~SmallVector()
+	{
+		Clear();
+		ReleaseStorage();
+	}
+
+	template<typename T, std::size_t N>
+	inline SmallVector<T, N>::SmallVector(const SmallVector& rhs)
+	{
+		Reserve(rhs.mSize);
+
+		for (const auto& value : rhs)
+		{
+			new(mData + mSize++)T(value);
+		}
+	}
+
+	template<typename T, std::size_t N>
+	inline SmallVector<T, N>& SmallVector<T, N>::operator=(const SmallVector& rhs)
+	{
+		if (this != &rhs)
+		{
+			Clear();
+			Reserve(rhs.mSize);
+
+			for (const auto& value : rhs)
+			{
+				new(mData + mSize++)T(value);
+			}
+		}
+
+		return *this;
+	}
+
+	template<typename T, std::size_t N>
+	inline SmallVector<T, N>::SmallVector(SmallVector&& rhs) noexcept
+	{
+		MoveFrom(rhs);
+	}
+
+	template<typename T, std::size_t N>
+	inline SmallVector<T, N>& SmallVector<T, N>::operator=(SmallVector&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Clear();
+			ReleaseStorage();
+			MoveFrom(rhs);
+		}
+
+		return *this;
+	}
+
+	template<typename T, std::size_t N>
+	inline SmallVector<T, N>::SmallVector(std::initializer_list<T> rhs)
+	{
+		Reserve(rhs.size());
+
+		for (const auto& value : rhs)
+		{
+			new(mData + mSize++)T(value);
+		}
+	}
+#pragma endregion Special Members
+
+#pragma region Boolean Operators
+	template<typename T, std::size_t N>
+	inline bool SmallVector<T, N>::operator==(const SmallVector& rhs) const
+	{
+		return mSize == rhs.mSize && std::equal(begin(), end(), rhs.begin());
+	}
+
+	template<typename T, std::size_t N>
+	inline bool SmallVector<T, N>::operator!=(const SmallVector& rhs) const
+	{
+		return !(operator==(rhs));
+	}
+#pragma endregion Boolean Operators
+
+#pragma region Size and Capacity
+	template<typename T, std::size_t N>
+	inline std::size_t SmallVector<T, N>::Size() const
+	{
+		return mSize;
+	}
+
+	template<typename T, std::size_t N>
+	inline bool SmallVector<T, N>::IsEmpty() const
+	{
+		return mSize == 0;
+	}
+
+	template<typename T, std::size_t N>
+	inline std::size_t SmallVector<T, N>::Capacity() const
+	{
+		return mCapacity;
+	}
+
+	template<typename T, std::size_t N>
+	inline bool SmallVector<T, N>::IsInline() const
+	{
+		return mData == reinterpret_cast<const T*>(mInlineStorage);
+	}
+
+	template<typename T, std::size_t N>
+	inline void SmallVector<T, N>::Reserve(const std::size_t capacity)
+	{
+		if (capacity > mCapacity)
+		{
+			if (capacity > N)
+			{
+				if (IsInline())
+				{
+					T* newData = static_cast<T*>(std::malloc(capacity * sizeof(T)));
+					if (!newData) throw std::bad_alloc();
+
+					std::memcpy(newData, mData, mSize * sizeof(T));
+					mData = newData;
+				}
+				else
+				{
+					T* newData = static_cast<T*>(std::realloc(mData, capacity * sizeof(T)));
+					if (!newData) throw std::bad_alloc();
+
+					mData = newData;
+				}
+			}
+
+			mCapacity = capacity;
+		}
+	}
+
+	template<typename T, std::size_t N>
+	inline void SmallVector<T, N>::ShrinkToFit()
+	{
+		if (!IsInline() && mSize <= N)
+		{
+			T* heapData = mData;
+			mData = InlineData();
+
+			std::memcpy(mData, heapData, mSize * sizeof(T));
+			std::free(heapData);
+		}
+		else if (!IsInline() && mSize < mCapacity)
+		{
+			T* newData = static_cast<T*>(std::realloc(mData, mSize * sizeof(T)));
+			if (!newData) throw std::bad_alloc();
+
+			mData = newData;
+		}
+
+		mCapacity = mSize;
+	}
+#pragma endregion Size and Capacity
+
+#pragma region Iterator Accessors
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::Iterator SmallVector<T, N>::begin()
+	{
+		return mData;
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::ConstIterator SmallVector<T, N>::begin() const
+	{
+		return mData;
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::ConstIterator SmallVector<T, N>::cbegin() const
+	{
+		return mData;
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::Iterator SmallVector<T, N>::end()
+	{
+		return mData + mSize;
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::ConstIterator SmallVector<T, N>::end() const
+	{
+		return mData + mSize;
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::ConstIterator SmallVector<T, N>::cend() const
+	{
+		return mData + mSize;
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::Iterator SmallVector<T, N>::Find(const T& value)
+	{
+		return std::find(begin(), end(), value);
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::ConstIterator SmallVector<T, N>::Find(const T& value) const
+	{
+		return std::find(begin(), end(), value);
+	}
+#pragma endregion Iterator Accessors
+
+#pragma region Element Accessors
+	template<typename T, std::size_t N>
+	inline T& SmallVector<T, N>::Front()
+	{
+		if (mSize == 0)
+		{
+			throw std::runtime_error("List is empty.");
+		}
+
+		return mData[0];
+	}
+
+	template<typename T, std::size_t N>
+	inline const T& SmallVector<T, N>::Front() const
+	{
+		if (mSize == 0)
+		{
+			throw std::runtime_error("List is empty.");
+		}
+
+		return mData[0];
+	}
+
+	template<typename T, std::size_t N>
+	inline T& SmallVector<T, N>::Back()
+	{
+		if (mSize == 0)
+		{
+			throw std::runtime_error("List is empty.");
+		}
+
+		return mData[mSize - 1];
+	}
+
+	template<typename T, std::size_t N>
+	inline const T& SmallVector<T, N>::Back() const
+	{
+		if (mSize == 0)
+		{
+			throw std::runtime_error("List is empty.");
+		}
+
+		return mData[mSize - 1];
+	}
+
+	template<typename T, std::size_t N>
+	inline T& SmallVector<T, N>::At(const std::size_t index)
+	{
+		if (index >= mSize)
+		{
+			throw std::out_of_range("Index is out of bounds.");
+		}
+
+		return mData[index];
+	}
+
+	template<typename T, std::size_t N>
+	inline const T& SmallVector<T, N>::At(const std::size_t index) const
+	{
+		if (index >= mSize)
+		{
+			throw std::out_of_range("Index is out of bounds.");
+		}
+
+		return mData[index];
+	}
+
+	template<typename T, std::size_t N>
+	inline T& SmallVector<T, N>::operator[](const std::size_t index)
+	{
+		return At(index);
+	}
+
+	template<typename T, std::size_t N>
+	inline const T& SmallVector<T, N>::operator[](const std::size_t index) const
+	{
+		return At(index);
+	}
+#pragma endregion Element Accessors
+
+#pragma region Modifiers
+	template<typename T, std::size_t N>
+	template<typename ...Args>
+	inline T& SmallVector<T, N>::EmplaceBack(Args&& ...args)
+	{
+		if (mCapacity <= mSize)
+		{
+			Reserve(mCapacity < N ? N : mCapacity + std::max(mCapacity / 2, std::size_t(1)));
+		}
+
+		return *new(mData + mSize++)T(std::forward<Args>(args)...);
+	}
+
+	template<typename T, std::size_t N>
+	inline void SmallVector<T, N>::PushBack(const T& data)
+	{
+		EmplaceBack(data);
+	}
+
+	template<typename T, std::size_t N>
+	inline void SmallVector<T, N>::PushBack(T&& data)
+	{
+		EmplaceBack(std::move(data));
+	}
+
+	template<typename T, std::size_t N>
+	inline void SmallVector<T, N>::PopBack()
+	{
+		if (mSize > 0)
+		{
+			mData[--mSize].~T();
+		}
+	}
+
+	template<typename T, std::size_t N>
+	inline bool SmallVector<T, N>::Remove(const T& value)
+	{
+		return Remove(Find(value));
+	}
+
+	template<typename T, std::size_t N>
+	inline bool SmallVector<T, N>::Remove(const Iterator it)
+	{
+		if (it < begin() || it > end()) throw std::runtime_error("Invalid iterator.");
+
+		if (it == end())
+		{
+			return false;
+		}
+
+		it->~T();
+		std::memmove(it, it + 1, sizeof(T) * (end() - it - 1));
+		--mSize;
+
+		return true;
+	}
+
+	template<typename T, std::size_t N>
+	inline void SmallVector<T, N>::Clear()
+	{
+		for (std::size_t i = 0; i < mSize; ++i)
+		{
+			mData[i].~T();
+		}
+
+		mSize = 0;
+	}
+#pragma endregion Modifiers
+
+#pragma region Helper Methods
+	template<typename T, std::size_t N>
+	inline T* SmallVector<T, N>::InlineData()
+	{
+		return reinterpret_cast<T*>(mInlineStorage);
+	}
+
+	template<typename T, std::size_t N>
+	inline void SmallVector<T, N>::ReleaseStorage()
+	{
+		if (!IsInline())
+		{
+			std::free(mData);
+			mData = InlineData();
+		}
+
+		mCapacity = 0;
+	}
+
+	template<typename T, std::size_t N>
+	inline void SmallVector<T, N>::MoveFrom(SmallVector& rhs) noexcept
+	{
+		if (rhs.IsInline())
+		{
+			mData = InlineData();
+			std::memcpy(mData, rhs.mData, rhs.mSize * sizeof(T));
+		}
+		else
+		{
+			mData = rhs.mData;
+			rhs.mData = rhs.InlineData();
+		}
+
+		mSize = rhs.mSize;
+		mCapacity = rhs.mCapacity;
+
+		rhs.mSize = 0;
+		rhs.mCapacity = 0;
+	}
+#pragma endregion Helper Methods
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "StackAllocator.h"
+
+// First Party
+#include "HeapAllocator.h"
+#pragma endregion Includes
+
+namespace Library
+{
+#pragma region Special Members
+	StackAllocator::StackAllocator(void* buffer, const std::size_t capacity) :
+		mBuffer(static_cast<std::byte*>(buffer)), mCapacity(capacity)
+	{
+	}
+#pragma endregion Special Members
+
+#pragma region Instance
+	StackAllocator& StackAllocator::ThreadLocal()
+	{
+		alignas(std::max_align_t) thread_local std::byte buffer[ThreadLocalCapacity];
+		thread_local StackAllocator instance(buffer, ThreadLocalCapacity);
+		return instance;
+	}
+#pragma endregion Instance
+
+#pragma region Accessors
+	std::size_t StackAllocator::Capacity() const
+	{
+		return mCapacity;
+	}
+
+	std::size_t StackAllocator::Size() const
+	{
+		return mTop;
+	}
+
+	bool StackAllocator::Owns(const void* memory) const
+	{
+		const std::byte* data = static_cast<const std::byte*>(memory);
+		return data >= mBuffer && data < mBuffer + mCapacity;
+	}
+#pragma endregion Accessors
+
+#pragma region IAllocator Overrides
+	void* StackAllocator::Allocate(const std::size_t size, const std::size_t alignment)
+	{
+		assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+		const std::size_t blockAlignment = std::max(alignment, alignof(Header));
+		const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(mBuffer);
+		const std::size_t offset = ((base + mTop + sizeof(Header) + blockAlignment - 1) & ~(blockAlignment - 1)) - base;
+
+		if (offset + size > mCapacity)
+		{
+			return HeapAllocator::Instance().Allocate(size, alignment);
+		}
+
+		GetHeader(offset) = { mLast, mTop, false };
+
+		mLast = offset;
+		mTop = offset + size;
+
+		return mBuffer + offset;
+	}
+
+	void* StackAllocator::Reallocate(void* memory, const std::size_t size, const std::size_t newSize, const std::size_t alignment)
+	{
+		if (memory == nullptr)
+		{
+			return Allocate(newSize, alignment);
+		}
+
+		if (!Owns(memory))
+		{
+			return HeapAllocator::Instance().Reallocate(memory, size, newSize, alignment);
+		}
+
+		const std::size_t offset = static_cast<std::byte*>(memory) - mBuffer;
+
+		if (offset == mLast && offset + newSize <= mCapacity && newSize > 0)
+		{
+			mTop = offset + newSize;
+			return memory;
+		}
+
+		void* newMemory = nullptr;
+
+		if (newSize > 0)
+		{
+			newMemory = Allocate(newSize, alignment);
+			std::memcpy(newMemory, memory, std::min(size, newSize));
+		}
+
+		Deallocate(memory, size);
+
+		return newMemory;
+	}
+
+	void StackAllocator::Deallocate(void* memory, const std::size_t size)
+	{
+		if (memory == nullptr) return;
+
+		if (!Owns(memory))
+		{
+			HeapAllocator::Instance().Deallocate(memory, size);
+			return;
+		}
+
+		GetHeader(static_cast<std::byte*>(memory) - mBuffer).IsFreed = true;
+
+		while (mLast != NoBlock && GetHeader(mLast).IsFreed)
+		{
+			const Header& header = GetHeader(mLast);
+			mTop = header.Start;
+			mLast = header.Previous;
+		}
+	}
+#pragma endregion IAllocator Overrides
+
+#pragma region Helper Methods
+	StackAllocator::Header& StackAllocator::GetHeader(const std::size_t offset)
+	{
+		return *reinterpret_cast<Header*>(mBuffer + offset - sizeof(Header));
+	}
+#pragma endregion Helper Methods
+}
\ No newline at end of file
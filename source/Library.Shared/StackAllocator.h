@@ -0,0 +1,164 @@
+#pragma once
+
+#pragma region Includes
+// First Party
+#include "IAllocator.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Stack allocator over a fixed buffer, for short lived scratch memory.
+	/// Blocks are released in any order, but their memory is only reclaimed once every block above them is released.
+	/// Requests that do not fit in the buffer are served by the HeapAllocator.
+	/// </summary>
+	/// <remarks>Not thread safe. Use ThreadLocal for an instance private to the calling thread.</remarks>
+	class StackAllocator final : public IAllocator
+	{
+#pragma region Type Definitions and Constants
+	public:
+		/// <summary>
+		/// Size in bytes of the buffer of each thread local StackAllocator.
+		/// </summary>
+		static constexpr std::size_t ThreadLocalCapacity = 65536;
+
+	private:
+		/// <summary>
+		/// Bookkeeping stored in front of every block in the buffer.
+		/// </summary>
+		struct Header final
+		{
+			/// <summary>
+			/// Offset of the block below this one, or NoBlock.
+			/// </summary>
+			std::size_t Previous;
+
+			/// <summary>
+			/// Offset of the top of the stack before this block was allocated.
+			/// </summary>
+			std::size_t Start;
+
+			/// <summary>
+			/// Whether the block has been released.
+			/// </summary>
+			bool IsFreed;
+		};
+
+		/// <summary>
+		/// Sentinel offset for no block.
+		/// </summary>
+		static constexpr std::size_t NoBlock = static_cast<std::size_t>(-1);
+#pragma endregion Type Definitions and Constants
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Specialized constructor.
+		/// </summary>
+		/// <param name="buffer">Memory managed by the allocator. Must outlive the allocator.</param>
+		/// <param name="capacity">Size of the buffer in bytes.</param>
+		StackAllocator(void* buffer, const std::size_t capacity);
+
+		/// <summary>
+		/// Default destructor.
+		/// </summary>
+		~StackAllocator() = default;
+#pragma endregion Special Members
+
+#pragma region Instance
+	public:
+		/// <summary>
+		/// Gets the StackAllocator private to the calling thread.
+		/// Its buffer is thread local storage, so it never touches the heap unless the buffer overflows.
+		/// </summary>
+		/// <returns>Reference to the thread local StackAllocator.</returns>
+		/// <remarks>Memory from the thread local StackAllocator must be released on the same thread.</remarks>
+		static StackAllocator& ThreadLocal();
+#pragma endregion Instance
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the size in bytes of the buffer.
+		/// </summary>
+		/// <returns>Size of the buffer.</returns>
+		std::size_t Capacity() const;
+
+		/// <summary>
+		/// Gets the number of bytes of the buffer in use, including headers and padding of released blocks not yet reclaimed.
+		/// </summary>
+		/// <returns>Number of bytes in use.</returns>
+		std::size_t Size() const;
+
+		/// <summary>
+		/// Checks whether a block was allocated from the buffer, rather than the heap.
+		/// </summary>
+		/// <param name="memory">Block to be checked.</param>
+		/// <returns>True if the block lies in the buffer, otherwise false.</returns>
+		bool Owns(const void* memory) const;
+#pragma endregion Accessors
+
+#pragma region IAllocator Overrides
+	public:
+		/// <summary>
+		/// Allocates a block of memory from the top of the stack.
+		/// </summary>
+		/// <param name="size">Size of the block in bytes.</param>
+		/// <param name="alignment">Required alignment of the block, a power of two.</param>
+		/// <returns>Pointer to the block.</returns>
+		/// <exception cref="std::bad_alloc">Allocation failed.</exception>
+		virtual void* Allocate(const std::size_t size, const std::size_t alignment=alignof(std::max_align_t)) override;
+
+		/// <summary>
+		/// Resizes a block of memory. The top block is resized in place when it fits.
+		/// </summary>
+		/// <param name="memory">Block to be resized, or null to allocate a new block.</param>
+		/// <param name="size">Current size of the block in bytes.</param>
+		/// <param name="newSize">Requested size of the block in bytes.</param>
+		/// <param name="alignment">Required alignment of the block, a power of two.</param>
+		/// <returns>Pointer to the resized block.</returns>
+		/// <exception cref="std::bad_alloc">Allocation failed.</exception>
+		virtual void* Reallocate(void* memory, const std::size_t size, const std::size_t newSize, const std::size_t alignment=alignof(std::max_align_t)) override;
+
+		/// <summary>
+		/// Releases a block of memory, and reclaims every released block on the top of the stack.
+		/// </summary>
+		/// <param name="memory">Block to be released. May be null.</param>
+		/// <param name="size">Size of the block in bytes.</param>
+		virtual void Deallocate(void* memory, const std::size_t size) override;
+#pragma endregion IAllocator Overrides
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Gets the header of a block in the buffer.
+		/// </summary>
+		/// <param name="offset">Offset of the block in the buffer.</param>
+		/// <returns>Reference to the block header.</returns>
+		Header& GetHeader(const std::size_t offset);
+#pragma endregion Helper Methods
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Memory managed by the allocator.
+		/// </summary>
+		std::byte* mBuffer;
+
+		/// <summary>
+		/// Size in bytes of the buffer.
+		/// </summary>
+		std::size_t mCapacity;
+
+		/// <summary>
+		/// Offset of the first unused byte in the buffer.
+		/// </summary>
+		std::size_t mTop{ 0 };
+
+		/// <summary>
+		/// Offset of the top block in the buffer, or NoBlock.
+		/// </summary>
+		std::size_t mLast{ NoBlock };
+#pragma endregion Data Members
+	};
+}
\ No newline at end of file
@@ -12,6 +12,11 @@
 namespace Library
 {
 #pragma region Signature
+	Signature::Signature(const std::string& key, const Datum::Types type, const bool isInternal, const std::size_t size, const std::size_t offset) :
+		Key(key), Type(type), IsInternal(isInternal), Size(size), Offset(offset)
+	{
+	}
+
 	bool Signature::operator==(const Signature& rhs) const noexcept
 	{
 		return Key == rhs.Key
@@ -53,6 +58,12 @@ namespace Library
 		return it != mRegistry.end() ? &it->second : nullptr;
 	}
 
+	const TypeLayout* TypeManager::FindLayout(const IdType typeId) const
+	{
+		const auto it = mRegistry.Find(typeId);
+		return it != mRegistry.end() ? it->second.Layout.get() : nullptr;
+	}
+
 	bool TypeManager::IsRegistered(const IdType typeId) const
 	{
 		return mRegistry.Find(typeId) != mRegistry.end();
@@ -73,4 +84,53 @@ namespace Library
 		mRegistry.Clear();
 	}
 #pragma endregion Registry
+
+#pragma region Helper Methods
+	std::shared_ptr<const TypeLayout> TypeManager::CreateLayout(const TypeLayout* parentLayout, const SignatureList& signatures)
+	{
+		auto layout = std::make_shared<TypeLayout>();
+
+		if (parentLayout)
+		{
+			layout->Signatures = parentLayout->Signatures;
+			layout->Slots = parentLayout->Slots;
+		}
+		else
+		{
+			layout->Slots.Append("this");
+		}
+
+		layout->Signatures.Reserve(layout->Signatures.Size() + signatures.Size());
+
+		for (const auto& signature : signatures)
+		{
+			const std::size_t index = layout->Slots.Find(signature.Key);
+
+			if (index == TypeLayout::NotFound)
+			{
+				layout->Slots.Append(std::string(signature.Key.Name()));
+				layout->Signatures.PushBack(signature);
+			}
+			else if (index < TypeLayout::FirstIndex)
+			{
+				throw std::runtime_error("Attribute key is reserved.");
+			}
+			else
+			{
+				layout->Signatures[index - TypeLayout::FirstIndex] = signature;
+			}
+		}
+
+		layout->Signatures.ShrinkToFit();
+
+		for (std::size_t i = 0; i < layout->Signatures.Size(); ++i)
+		{
+			if (!layout->Signatures[i].IsInternal) layout->External.PushBack(i);
+		}
+
+		layout->External.ShrinkToFit();
+
+		return layout;
+	}
+#pragma endregion Helper Methods
 }
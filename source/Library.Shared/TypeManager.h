@@ -1,6 +1,9 @@
 #pragma once
 
 #pragma region Includes
+// Standard
+#include <memory>
+
 // First Party
 #include "RTTI.h"
 #include "HashMap.h"
@@ -17,12 +20,30 @@ namespace Library
 	/// </summary>
 	struct Signature
 	{
+#pragma region Constructors
+	public:
+		/// <summary>
+		/// Default constructor.
+		/// </summary>
+		Signature() = default;
+
+		/// <summary>
+		/// Constructor that interns the Attribute key.
+		/// </summary>
+		/// <param name="key">Key value of the Attribute.</param>
+		/// <param name="type">Type of the Attribute data value.</param>
+		/// <param name="isInternal">Type of storage for the Attribute data.</param>
+		/// <param name="size">Number of elements in the Attribute data.</param>
+		/// <param name="offset">Offset of a class data member serving as external memory, if storage is external.</param>
+		Signature(const std::string& key, const Datum::Types type, const bool isInternal, const std::size_t size, const std::size_t offset=0);
+#pragma endregion Constructors
+
 #pragma region Data Members
 	public:
 		/// <summary>
-		/// Key value of the Attribute.
+		/// Interned key value of the Attribute.
 		/// </summary>
-		std::string Key;
+		NameId Key;
 
 		/// <summary>
 		/// Type of the Attribute data value.
@@ -68,6 +89,69 @@ namespace Library
 	/// </summary>
 	using SignatureList = Vector<Signature>;
 
+	/// <summary>
+	/// Flattened, immutable attribute layout of a registered type, compiled once by TypeManager::Register.
+	/// Holds the signatures of the type and all of its ancestors in Attribute order, so instances are populated
+	/// and their external storage rebound by a single pass, without walking the parent chain.
+	/// </summary>
+	struct TypeLayout final
+	{
+#pragma region Type Definitions, Constants
+	public:
+		/// <summary>
+		/// Attribute index of the first prescribed Attribute, following the "this" Attribute.
+		/// </summary>
+		static constexpr std::size_t FirstIndex{ 1 };
+
+		/// <summary>
+		/// Value returned by IndexOf for keys that are not prescribed.
+		/// </summary>
+		static constexpr std::size_t NotFound{ Scope::SlotIndex::NotFound };
+#pragma endregion Type Definitions, Constants
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the number of Attributes prescribed by the layout, including the "this" Attribute.
+		/// </summary>
+		/// <returns>Number of prescribed Attributes.</returns>
+		std::size_t PrescribedCount() const;
+
+		/// <summary>
+		/// Gets the Attribute index of a prescribed key, including "this".
+		/// </summary>
+		/// <param name="key">Interned key of the Attribute.</param>
+		/// <returns>Attribute index of the key, or NotFound if it is not prescribed.</returns>
+		std::size_t IndexOf(const NameId& key) const;
+
+		/// <summary>
+		/// Gets the Attribute index of a prescribed key, including "this".
+		/// </summary>
+		/// <param name="key">Key of the Attribute.</param>
+		/// <returns>Attribute index of the key, or NotFound if it is not prescribed.</returns>
+		std::size_t IndexOf(const std::string& key) const;
+#pragma endregion Accessors
+
+#pragma region Data Members
+	public:
+		/// <summary>
+		/// Signatures of the type and its ancestors, ancestors first. A key prescribed again by a descendant keeps its position.
+		/// </summary>
+		SignatureList Signatures;
+
+		/// <summary>
+		/// Positions in Signatures of the Attributes stored externally, in order.
+		/// </summary>
+		Vector<std::size_t> External;
+
+		/// <summary>
+		/// Slot of the "this" Attribute followed by each prescribed key, so slots are Attribute indices.
+		/// Shared by every instance of the type, which only stores the Data values of the slots.
+		/// </summary>
+		Scope::SlotIndex Slots;
+#pragma endregion Data Members
+	};
+
 	/// <summary>
 	/// Data registered for each type.
 	/// </summary>
@@ -75,6 +159,7 @@ namespace Library
 	{
 		const SignatureList& Signatures;
 		RTTI::IdType ParentTypeId;
+		std::shared_ptr<const TypeLayout> Layout;
 	};
 #pragma endregion Signature
 
@@ -137,6 +222,14 @@ namespace Library
 		/// <returns>Pointer to the TypeInfo of the given Attributed IdType.</returns>
 		const TypeInfo* Find(const IdType typeId) const;
 
+		/// <summary>
+		/// Finds the flattened attribute layout for a given type.
+		/// </summary>
+		/// <param name="typeId">IdType for the Attributed derived class whose layout will be retrieved.</param>
+		/// <returns>Pointer to the TypeLayout of the given Attributed IdType, or null if it is not registered.</returns>
+		/// <remarks>The TypeLayout lives until the type is deregistered.</remarks>
+		const TypeLayout* FindLayout(const IdType typeId) const;
+
 		/// <summary>
 		/// Checks if a given Attributed derived class has been registered.
 		/// </summary>
@@ -150,6 +243,7 @@ namespace Library
 		/// <typeparam name="T">Typename of an Attribute derived class to be registered.</typeparam>
 		/// <exception cref="std::runtime_error">Parent type is not registered.</exception>
 		/// <exception cref="std::runtime_error">Type registered more than once.</exception>
+		/// <exception cref="std::runtime_error">Attribute key is reserved.</exception>
 		template<typename T>
 		void Register();
 
@@ -182,6 +276,18 @@ namespace Library
 		void Clear();
 #pragma endregion Registry
 
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Compiles the flattened attribute layout of a type from the layout of its parent and its own signatures.
+		/// </summary>
+		/// <param name="parentLayout">Layout of the parent type, or null if the parent is Attributed.</param>
+		/// <param name="signatures">Signatures of the type.</param>
+		/// <returns>Newly compiled TypeLayout.</returns>
+		/// <exception cref="std::runtime_error">Attribute key is reserved.</exception>
+		static std::shared_ptr<const TypeLayout> CreateLayout(const TypeLayout* parentLayout, const SignatureList& signatures);
+#pragma endregion Helper Methods
+
 #pragma region Data Members
 	private:
 		/// <summary>
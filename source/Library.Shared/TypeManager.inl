@@ -5,23 +5,42 @@
 
 namespace Library
 {
+#pragma region Type Layout
+	inline std::size_t TypeLayout::PrescribedCount() const
+	{
+		return FirstIndex + Signatures.Size();
+	}
+
+	inline std::size_t TypeLayout::IndexOf(const NameId& key) const
+	{
+		return Slots.Find(key);
+	}
+
+	inline std::size_t TypeLayout::IndexOf(const std::string& key) const
+	{
+		return Slots.Find(key);
+	}
+#pragma endregion Type Layout
+
 #pragma region Registry
 	template<typename T>
 	inline void TypeManager::Register()
 	{
-		if (T::Base::TypeIdClass() != Attributed::TypeIdClass() && !mRegistry.ContainsKey(T::Base::TypeIdClass()))
+		const TypeLayout* parentLayout = nullptr;
+
+		if (T::Base::TypeIdClass() != Attributed::TypeIdClass())
 		{
-			throw std::runtime_error("Parent type is not registered.");
+			parentLayout = FindLayout(T::Base::TypeIdClass());
+			if (!parentLayout) throw std::runtime_error("Parent type is not registered.");
 		}
 
-		const TypeInfo typeInfo = { T::Signatures(), T::Base::TypeIdClass() };
-		
-		const bool isNew = mRegistry.TryEmplace(T::TypeIdClass(), typeInfo).second;
-
-		if (!isNew)
+		if (mRegistry.ContainsKey(T::TypeIdClass()))
 		{
 			throw std::runtime_error("Type registered more than once.");
 		}
+
+		const TypeInfo typeInfo = { T::Signatures(), T::Base::TypeIdClass(), CreateLayout(parentLayout, T::Signatures()) };
+		mRegistry.TryEmplace(T::TypeIdClass(), typeInfo);
 	}
 
 	inline float TypeManager::RegistryLoadFactor() const
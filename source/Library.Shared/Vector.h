@@ -10,12 +10,14 @@
 
 // First Party
 #include "DefaultEquality.h"
+#include "HeapAllocator.h"
 #pragma endregion Includes
 
 namespace Library
 {
 	/// <summary>
 	/// Represents a generic Vector list.
+	/// Element memory comes from an IAllocator, which is the HeapAllocator unless one is passed on construction.
 	/// </summary>
 	/// <typeparam name="T">Data type of elements in a Vector.</typeparam>
 	template <typename T>
@@ -530,6 +532,15 @@ namespace Library
 		/// <param name="equalityFunctor">Default equality functor.</param>
 		explicit Vector(const EqualityFunctor& equalityFunctor);
 
+		/// <summary>
+		/// Specialized constructor that allocates element memory from the given allocator.
+		/// </summary>
+		/// <param name="allocator">Allocator for element memory. Must outlive the Vector's memory.</param>
+		/// <param name="capacity">Default capacity for the vector.</param>
+		/// <param name="equalityFunctor">Default equality functor.</param>
+		/// <param name="reserveFunctor">Default reserve strategy functor.</param>
+		explicit Vector(IAllocator& allocator, const std::size_t capacity=0, const EqualityFunctor& equalityFunctor=DefaultEquality<T>(), const ReserveFunctor& reserveFunctor=DefaultReserveFunctor());
+
 		/// <summary>
 		/// Destructor. 
 		/// Clears all existing elements.
@@ -539,6 +550,7 @@ namespace Library
 		/// <summary>
 		/// Copy constructor.
 		/// Takes in a Vector as a parameter, then copies the data values to the constructed Vector.
+		/// The copy allocates from the HeapAllocator, since the allocator of rhs may be short lived.
 		/// </summary>
 		/// <param name="rhs">Vector to be copied.</param>
 		Vector(const Vector& rhs);
@@ -546,6 +558,7 @@ namespace Library
 		/// <summary>
 		/// Copy assignment operator.
 		/// Copies the data values from the right hand side (rhs) value to the left hand side.
+		/// The left hand side keeps its allocator.
 		/// </summary>
 		/// <param name="rhs">Vector whose values are copied.</param>
 		/// <returns>Modified Vector with copied values.</returns>
@@ -553,14 +566,14 @@ namespace Library
 
 		/// <summary>
 		/// Move constructor.
-		/// Takes a Vector as a parameter and moves the data to the constructed Vector.
+		/// Takes a Vector as a parameter and moves the data to the constructed Vector, along with its allocator.
 		/// </summary>
 		/// <param name="rhs">Vector to be moved.</param>
 		Vector(Vector&& rhs) noexcept;
 
 		/// <summary>
 		/// Move assignment operator.
-		/// Moves the data values from the right hand side (rhs) value to the left hand side.
+		/// Moves the data values from the right hand side (rhs) value to the left hand side, along with its allocator.
 		/// </summary>
 		/// <param name="rhs">Vector whose values are copied.</param>
 		/// <returns>Modified Vector with copied values.</returns>
@@ -649,6 +662,12 @@ namespace Library
 		/// </summary>
 		/// <exception cref="runtime_error">Failed memory reallocation.</exception>
 		void ShrinkToFit();
+
+		/// <summary>
+		/// Gets the allocator for the element memory of the Vector.
+		/// </summary>
+		/// <returns>Reference to the allocator.</returns>
+		IAllocator& GetAllocator() const;
 #pragma endregion Size and Capacity
 
 #pragma region Iterator Accessors
@@ -875,6 +894,11 @@ namespace Library
 		/// Functor for evaluating the capacity reserve strategy during resize during element insert.
 		/// </summary>
 		std::shared_ptr<ReserveFunctor> mReserveFunctor;
+
+		/// <summary>
+		/// Allocator for the element memory.
+		/// </summary>
+		IAllocator* mAllocator{ &HeapAllocator::Instance() };
 #pragma endregion Data Members
 	};
 }
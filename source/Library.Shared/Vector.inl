@@ -406,6 +406,16 @@ namespace Library
 	{
 	}
 
+	template<typename T>
+	inline Vector<T>::Vector(IAllocator& allocator, const std::size_t capacity, const EqualityFunctor& equalityFunctor, const ReserveFunctor& reserveFunctor) :
+		mEqualityFunctor(std::make_shared<EqualityFunctor>(equalityFunctor)), mReserveFunctor(std::make_shared<ReserveFunctor>(reserveFunctor)), mAllocator(&allocator)
+	{
+		if (capacity > 0)
+		{
+			Reserve(capacity);
+		}
+	}
+
 	template<typename T>
 	inline Vector<T>::~Vector()
 	{
@@ -413,7 +423,7 @@ namespace Library
 
 		if (mData != nullptr)
 		{
-			free(mData);
+			mAllocator->Deallocate(mData, mCapacity * sizeof(T));
 			mData = nullptr;
 		}
 
@@ -455,7 +465,7 @@ namespace Library
 
 	template<typename T>
 	inline Vector<T>::Vector(Vector&& rhs) noexcept :
-		mData(rhs.mData), mSize(rhs.mSize), mCapacity(rhs.mCapacity), mEqualityFunctor(rhs.mEqualityFunctor), mReserveFunctor(rhs.mReserveFunctor)
+		mData(rhs.mData), mSize(rhs.mSize), mCapacity(rhs.mCapacity), mEqualityFunctor(rhs.mEqualityFunctor), mReserveFunctor(rhs.mReserveFunctor), mAllocator(rhs.mAllocator)
 	{
 		rhs.mData = nullptr;
 		rhs.mSize = 0;
@@ -470,7 +480,7 @@ namespace Library
 			if (mCapacity > 0)
 			{
 				Clear();
-				free(mData);
+				mAllocator->Deallocate(mData, mCapacity * sizeof(T));
 			}
 
 			mData = rhs.mData;
@@ -478,6 +488,7 @@ namespace Library
 			mCapacity = rhs.mCapacity;
 			mReserveFunctor = rhs.mReserveFunctor;
 			mEqualityFunctor = rhs.mEqualityFunctor;
+			mAllocator = rhs.mAllocator;
 
 			rhs.mData = nullptr;
 			rhs.mSize = 0;
@@ -569,10 +580,7 @@ namespace Library
 	{
 		if (capacity > mCapacity)
 		{
-			void* newMemory = realloc(mData, capacity * sizeof(T));
-			if (!newMemory) throw std::bad_alloc();
-			
-			mData = static_cast<T*>(newMemory);
+			mData = static_cast<T*>(mAllocator->Reallocate(mData, mCapacity * sizeof(T), capacity * sizeof(T), alignof(T)));
 			mCapacity = capacity;
 		}
 	}
@@ -628,19 +636,22 @@ namespace Library
 	{
 		if (mSize == 0)
 		{
-			free(mData);
+			mAllocator->Deallocate(mData, mCapacity * sizeof(T));
 			mData = nullptr;
 		}
 		else if (mSize < mCapacity)
 		{
-			void* newMemory = realloc(mData, mSize * sizeof(T));
-			if (!newMemory) throw std::bad_alloc();
-
-			mData = static_cast<T*>(newMemory);
+			mData = static_cast<T*>(mAllocator->Reallocate(mData, mCapacity * sizeof(T), mSize * sizeof(T), alignof(T)));
 		}
 
 		mCapacity = mSize;
 	}
+
+	template<typename T>
+	inline IAllocator& Vector<T>::GetAllocator() const
+	{
+		return *mAllocator;
+	}
 #pragma endregion Size and Capacity
 
 #pragma region Iterator Accessors
@@ -866,7 +877,7 @@ namespace Library
 			if (mEqualityFunctor->operator()(mData[i], value))
 			{
 				mData[i].~T();
-				std::memmove(&mData[i], &mData[i + 1], sizeof(T) * (mSize - i));
+				std::memmove(&mData[i], &mData[i + 1], sizeof(T) * (mSize - i - 1));
 
 				--mSize;
 				return true;
@@ -892,7 +903,7 @@ namespace Library
 			else
 			{
 				mData[it.mIndex].~T();
-				std::memmove(&mData[it.mIndex], &mData[it.mIndex + 1], sizeof(T) * (mSize - it.mIndex));
+				std::memmove(&mData[it.mIndex], &mData[it.mIndex + 1], sizeof(T) * (mSize - it.mIndex - 1));
 				--mSize;
 			}
 
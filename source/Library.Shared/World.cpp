@@ -6,11 +6,25 @@
 #include "World.h"
 
 // Standard
+#include <thread>
 #include <utility>
 
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#include <timeapi.h>
+#pragma comment(lib, "winmm.lib")
+#endif
+
 // First Party
 #include "Entity.h"
 #include "EventQueue.h"
+#include "JobSystem.h"
 #pragma endregion Includes
 
 namespace Library
@@ -20,14 +34,19 @@ namespace Library
 		mWorldState.World = this;
 		mWorldState.GameTime = gameTime;
 		mWorldState.EventQueue = eventQueue;
+		mWorldState.FrameAllocator = &mFrameAllocator;
+		mWorldState.ComponentStore = &mComponentStore;
 	}
 
 	World::World(const World& rhs) : Entity(rhs),
-		mGameClock(rhs.mGameClock)
+		mGameClock(rhs.mGameClock), mEventChannels(rhs.mEventChannels)
 	{
 			mWorldState.World = this;
 			mWorldState.GameTime = rhs.mWorldState.GameTime;
 			mWorldState.EventQueue = rhs.mWorldState.EventQueue;
+			mWorldState.JobSystem = rhs.mWorldState.JobSystem;
+			mWorldState.FrameAllocator = &mFrameAllocator;
+			mWorldState.ComponentStore = &mComponentStore;
 	}
 
 	World& World::operator=(const World& rhs)
@@ -37,29 +56,41 @@ namespace Library
 			Entity::operator=(rhs);
 
 			mGameClock = rhs.mGameClock;
+			mEventChannels = rhs.mEventChannels;
 			mWorldState.GameTime = rhs.mWorldState.GameTime;
 			mWorldState.EventQueue = rhs.mWorldState.EventQueue;
+			mWorldState.JobSystem = rhs.mWorldState.JobSystem;
 		}
 		
 		return *this;
 	}
 	
-	World::World(World&& rhs) noexcept : Entity(std::move(rhs))
+	World::World(World&& rhs) noexcept : Entity(std::move(rhs)),
+		mComponentStore(std::move(rhs.mComponentStore)), mEventChannels(std::move(rhs.mEventChannels))
 	{
 		mWorldState.World = this;
 		mWorldState.GameTime = rhs.mWorldState.GameTime;
 		mWorldState.EventQueue = rhs.mWorldState.EventQueue;
+		mWorldState.JobSystem = rhs.mWorldState.JobSystem;
+		mWorldState.FrameAllocator = &mFrameAllocator;
+		mWorldState.ComponentStore = &mComponentStore;
 		rhs.mWorldState.GameTime = nullptr;
 		rhs.mWorldState.EventQueue = nullptr;
+		rhs.mWorldState.JobSystem = nullptr;
 	}
 
 	World& World::operator=(World&& rhs) noexcept
 	{
 		mWorldState.GameTime = rhs.mWorldState.GameTime;
 		mWorldState.EventQueue = rhs.mWorldState.EventQueue;
+		mWorldState.JobSystem = rhs.mWorldState.JobSystem;
 
 		rhs.mWorldState.GameTime = nullptr;
 		rhs.mWorldState.EventQueue = nullptr;
+		rhs.mWorldState.JobSystem = nullptr;
+
+		mComponentStore = std::move(rhs.mComponentStore);
+		mEventChannels = std::move(rhs.mEventChannels);
 
 		Entity::operator=(std::move(rhs));
 
@@ -84,20 +115,103 @@ namespace Library
 			mWorldState.RenderingManager,
 			mWorldState.GameTime,
 			mWorldState.EventQueue,
+			mWorldState.FrameAllocator,
+			mWorldState.ComponentStore,
+			mWorldState.JobSystem,
 			mWorldState.World,
 			mWorldState.Sector,
-			mWorldState.Entity
+			mWorldState.Entity,
+			mWorldState.InterpolationAlpha
 		};
 	}
 
+	ComponentStore& World::GetComponentStore()
+	{
+		return mComponentStore;
+	}
+
+	const ComponentStore& World::GetComponentStore() const
+	{
+		return mComponentStore;
+	}
+
+	void World::SetJobSystem(JobSystem* jobSystem)
+	{
+		mWorldState.JobSystem = jobSystem;
+	}
+
+	void World::AddEventChannel(IEventChannel& eventChannel)
+	{
+		if (mEventChannels.Find(&eventChannel) != mEventChannels.end())
+		{
+			throw std::runtime_error("Event channel already added.");
+		}
+
+		mEventChannels.PushBack(&eventChannel);
+	}
+
+	bool World::RemoveEventChannel(IEventChannel& eventChannel)
+	{
+		return mEventChannels.Remove(&eventChannel);
+	}
+
 	void World::Run()
 	{
+		Run(RunSettings());
+	}
+
+	void World::Run(const RunSettings& settings)
+	{
+		using Clock = std::chrono::high_resolution_clock;
+
+		const bool isFixedTimestep = settings.FixedTimestep > Duration::zero();
+		Duration accumulator{ Duration::zero() };
+		Clock::time_point previousTime = Clock::now();
+
+		const TimerResolution timerResolution(settings.MinFrameTime > Duration::zero() || isFixedTimestep);
+		const Duration spinMargin = timerResolution.SpinMargin();
+
 		IsRunning = true;
-		
+
 		while (IsRunning)
 		{
-			Update();
+			const Clock::time_point frameTime = Clock::now();
+
+			if (isFixedTimestep)
+			{
+				accumulator += frameTime - previousTime;
+				previousTime = frameTime;
+
+				for (std::size_t step = 0; IsRunning && step < settings.MaxStepsPerFrame && accumulator >= settings.FixedTimestep; ++step)
+				{
+					Update(settings.FixedTimestep);
+					accumulator -= settings.FixedTimestep;
+				}
+
+				accumulator %= settings.FixedTimestep;
+				mWorldState.InterpolationAlpha = std::chrono::duration<float>(accumulator) / std::chrono::duration<float>(settings.FixedTimestep);
+			}
+			else
+			{
+				Update();
+			}
+
+			if (settings.FrameCallback)
+			{
+				settings.FrameCallback(mWorldState);
+			}
+
+			if (settings.MinFrameTime > Duration::zero())
+			{
+				WaitUntil(frameTime + settings.MinFrameTime, spinMargin);
+			}
+			else if (isFixedTimestep)
+			{
+				WaitUntil(frameTime + (settings.FixedTimestep - accumulator), spinMargin);
+			}
 		}
+
+		mWorldState.InterpolationAlpha = 0.0f;
 	}
 
 	void World::Stop()
@@ -125,21 +239,57 @@ namespace Library
 		if (mWorldState.GameTime)
 		{
 			mGameClock.UpdateGameTime(*mWorldState.GameTime);
-		
-			if (mWorldState.EventQueue)
-			{
-				mWorldState.EventQueue->Update(*mWorldState.GameTime);
-			}
 		}
 
-		ForEachChild([this](Entity& sector)
+		Simulate();
+	}
+
+	void World::Update(const Duration& step)
+	{
+		if (mWorldState.GameTime)
 		{
-			mWorldState.Sector = &sector;
-			mWorldState.Sector->Update(mWorldState);
-		});
+			mGameClock.AdvanceGameTime(*mWorldState.GameTime, step);
+		}
+
+		Simulate();
+	}
+
+	void World::Simulate()
+	{
+		mFrameAllocator.Reset();
+
+		if (mWorldState.GameTime && mWorldState.EventQueue)
+		{
+			mWorldState.EventQueue->Update(*mWorldState.GameTime);
+		}
+
+		for (auto* eventChannel : mEventChannels)
+		{
+			eventChannel->Flush();
+		}
+
+		if (mWorldState.JobSystem)
+		{
+			ForEachChild(*mWorldState.JobSystem, [this](Entity& sector)
+			{
+				WorldState sectorState = mWorldState;
+				sectorState.Sector = &sector;
+				sector.Update(sectorState);
+			}, false);
+		}
+		else
+		{
+			ForEachChild([this](Entity& sector)
+			{
+				mWorldState.Sector = &sector;
+				mWorldState.Sector->Update(mWorldState);
+			});
+		}
 
 		mWorldState.Sector = nullptr;
 
+		mComponentStore.Update(mWorldState);
+
 		UpdatePendingChildren();
 	}
 
@@ -149,6 +299,11 @@ namespace Library
 		{
 			mWorldState.EventQueue->Clear();
 		}
+
+		for (auto* eventChannel : mEventChannels)
+		{
+			eventChannel->Clear();
+		}
 		
 		ForEachChild([this](Entity& sector)
 		{
@@ -161,6 +316,44 @@ namespace Library
 		UpdatePendingChildren();
 	}
 
+	void World::WaitUntil(const std::chrono::high_resolution_clock::time_point& time, const Duration& spinMargin)
+	{
+		if (time - std::chrono::high_resolution_clock::now() > spinMargin)
+		{
+			std::this_thread::sleep_until(time - spinMargin);
+		}
+
+		while (std::chrono::high_resolution_clock::now() < time)
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	World::TimerResolution::TimerResolution([[maybe_unused]] const bool isRequired)
+	{
+#if defined(_WIN32)
+		mIsRaised = isRequired && timeBeginPeriod(1) == TIMERR_NOERROR;
+#endif
+	}
+
+	World::TimerResolution::~TimerResolution()
+	{
+#if defined(_WIN32)
+		if (mIsRaised) timeEndPeriod(1);
+#endif
+	}
+
+	World::Duration World::TimerResolution::SpinMargin() const
+	{
+		using namespace std::chrono_literals;
+
+#if defined(_WIN32)
+		if (!mIsRaised) return 16ms;
+#endif
+
+		return 2ms;
+	}
+
 	std::string World::ToString() const
 	{
 		std::ostringstream oss;
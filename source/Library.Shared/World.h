@@ -1,10 +1,17 @@
 #pragma once
 
 #pragma region Includes
+// Standard
+#include <chrono>
+#include <functional>
+
 // First Party
 #include "Entity.h"
+#include "ComponentStore.h"
+#include "FrameAllocator.h"
 #include "GameClock.h"
 #include "WorldState.h"
+#include "IEventChannel.h"
 #pragma endregion Includes
 
 namespace Library
@@ -16,6 +23,83 @@ namespace Library
 	{
 		RTTI_DECLARATIONS(World, Entity)
 
+#pragma region Type Definitions
+	public:
+		/// <summary>
+		/// Type definition for a duration of real or simulated time.
+		/// </summary>
+		using Duration = std::chrono::high_resolution_clock::duration;
+
+		/// <summary>
+		/// Scheduling options for Run.
+		/// </summary>
+		struct RunSettings final
+		{
+			/// <summary>
+			/// Simulated time advanced by each Update. When zero, every frame runs one Update with the real elapsed time.
+			/// Otherwise real time is accumulated, and each frame runs as many fixed Updates as fit in it,
+			/// so the simulation advances in identical steps regardless of the frame rate.
+			/// </summary>
+			Duration FixedTimestep{ Duration::zero() };
+
+			/// <summary>
+			/// Minimum real time of a frame, capping the frame rate. When zero with a FixedTimestep, frames wait for the next step to be due.
+			/// Waiting sleeps, then yields for the last stretch, so the loop does not spin a core.
+			/// On Windows, Run raises the system timer resolution to one millisecond while waiting is enabled, so sleeps do not overshoot.
+			/// </summary>
+			Duration MinFrameTime{ Duration::zero() };
+
+			/// <summary>
+			/// Maximum number of fixed Updates run to catch up in a single frame.
+			/// Time accumulated beyond it is dropped, slowing the simulation down instead of falling further behind.
+			/// </summary>
+			std::size_t MaxStepsPerFrame{ 5 };
+
+			/// <summary>
+			/// Called once per frame after its Updates, with the InterpolationAlpha of the WorldState set, such as to render. May be empty.
+			/// </summary>
+			std::function<void(WorldState&)> FrameCallback;
+		};
+
+	private:
+		/// <summary>
+		/// Raises the system timer resolution to one millisecond while in scope, so sleeps wake close to their deadline.
+		/// Only has an effect on Windows, where the default resolution is about 15.6 milliseconds.
+		/// </summary>
+		class TimerResolution final
+		{
+		public:
+			/// <summary>
+			/// Raises the timer resolution, if requested.
+			/// </summary>
+			/// <param name="isRequired">Whether the caller will wait at all, otherwise the resolution is left alone.</param>
+			explicit TimerResolution(const bool isRequired);
+
+			/// <summary>
+			/// Restores the timer resolution, if it was raised.
+			/// </summary>
+			~TimerResolution();
+
+			TimerResolution(const TimerResolution&) = delete;
+			TimerResolution(TimerResolution&&) = delete;
+			TimerResolution& operator=(const TimerResolution&) = delete;
+			TimerResolution& operator=(TimerResolution&&) = delete;
+
+			/// <summary>
+			/// Time before a deadline at which waiting stops sleeping and yields instead.
+			/// At least one timer tick, so a sleep that overshoots by a tick still wakes before the deadline.
+			/// </summary>
+			/// <returns>Margin to yield through at the end of each wait.</returns>
+			Duration SpinMargin() const;
+
+		private:
+			/// <summary>
+			/// Whether the timer resolution was raised, and must be restored.
+			/// </summary>
+			bool mIsRaised{ false };
+		};
+#pragma endregion Type Definitions
+
 #pragma region Special Members
 	public:
 		/// <summary>
@@ -80,15 +164,54 @@ namespace Library
 		/// </summary>
 		/// <returns>Reference to the WorldState associated with the World.</returns>
 		ConstWorldState GetWorldState() const;
+
+		/// <summary>
+		/// Gets the data-oriented component storage of the World, whose Systems run after the Sectors on every Update.
+		/// </summary>
+		/// <returns>Reference to the ComponentStore of the World.</returns>
+		ComponentStore& GetComponentStore();
+
+		/// <summary>
+		/// Gets the data-oriented component storage of the World, whose Systems run after the Sectors on every Update.
+		/// </summary>
+		/// <returns>Reference to the ComponentStore of the World.</returns>
+		const ComponentStore& GetComponentStore() const;
+
+		/// <summary>
+		/// Opts in to parallel updates. Sectors then update as jobs of the JobSystem, as do Entities flagged as independent.
+		/// </summary>
+		/// <param name="jobSystem">JobSystem to run updates on, or null to update serially.</param>
+		void SetJobSystem(JobSystem* jobSystem);
+
+		/// <summary>
+		/// Adds an EventChannel to be flushed at the start of every Update, after the EventQueue.
+		/// Channels are flushed in the order they were added.
+		/// </summary>
+		/// <param name="eventChannel">EventChannel to be flushed, which must outlive the World or be removed first.</param>
+		/// <exception cref="std::runtime_error">EventChannel already added.</exception>
+		void AddEventChannel(IEventChannel& eventChannel);
+
+		/// <summary>
+		/// Removes an EventChannel so it is no longer flushed by Update.
+		/// </summary>
+		/// <param name="eventChannel">EventChannel to be removed.</param>
+		/// <returns>True if the EventChannel was removed, false if it was not added.</returns>
+		bool RemoveEventChannel(IEventChannel& eventChannel);
 #pragma endregion Accessors
 
 #pragma region Game Loop
 	public:
 		/// <summary>
-		/// Runs the game loop of the World until Stop is called.
+		/// Runs the game loop of the World until Stop is called, with one Update per frame, as fast as possible.
 		/// </summary>
 		void Run();
 
+		/// <summary>
+		/// Runs the game loop of the World until Stop is called, scheduled by the given settings.
+		/// </summary>
+		/// <param name="settings">Fixed timestep, frame cap, and catch-up limit of the loop.</param>
+		void Run(const RunSettings& settings);
+
 		/// <summary>
 		/// Stops the game loop.
 		/// </summary>
@@ -101,11 +224,23 @@ namespace Library
 	
 		/// <summary>
 		/// World update method to be called every frame, hides inherited Entity Update.
+		/// Resets the frame arena, so memory allocated from it during the previous frame is released.
+		/// Publishes expired Event instances from the EventQueue, then flushes each EventChannel, before updating the Sectors.
+		/// Runs the ComponentStore Systems once the Sectors are updated.
+		/// Sectors update in parallel when a JobSystem is set, with a barrier before pending children are updated.
 		/// </summary>
 		void Update();
+
+		/// <summary>
+		/// World update method advancing the GameTime by a fixed step instead of the real elapsed time, for deterministic simulation.
+		/// Otherwise identical to Update.
+		/// </summary>
+		/// <param name="step">Simulated time to advance by.</param>
+		void Update(const Duration& step);
 	
 		/// <summary>
 		/// World shutdown method to be called after running, hides inherited Entity Shutdown.
+		/// Discards the Event instances and messages still queued.
 		/// </summary>
 		void Shutdown();
 
@@ -124,6 +259,18 @@ namespace Library
 		/// Hides unused Entity Update method.
 		/// </summary>
 		using Entity::Shutdown;
+
+		/// <summary>
+		/// Updates everything but the GameTime: the frame arena, the EventQueue, each EventChannel, the Sectors, and the ComponentStore.
+		/// </summary>
+		void Simulate();
+
+		/// <summary>
+		/// Blocks the calling thread until the given time, sleeping for most of the wait then yielding, for precision.
+		/// </summary>
+		/// <param name="time">Time to wait until.</param>
+		/// <param name="spinMargin">Time before the deadline at which to stop sleeping, at least one timer tick.</param>
+		static void WaitUntil(const std::chrono::high_resolution_clock::time_point& time, const Duration& spinMargin);
 #pragma endregion Game Loop
 
 #pragma region RTTI Overrides
@@ -142,11 +289,27 @@ namespace Library
 		/// </summary>
 		GameClock mGameClock;
 
+		/// <summary>
+		/// Arena for memory that only lives for a single frame, reset at the start of every Update.
+		/// </summary>
+		FrameAllocator mFrameAllocator;
+
+		/// <summary>
+		/// Component storage for data-oriented entities, updated by its Systems after the Sectors.
+		/// Not copied along with the World, since Handles are only meaningful to the store that issued them.
+		/// </summary>
+		ComponentStore mComponentStore;
+
 		/// <summary>
 		/// Convenience struct for passing the WorldState data in cascaded Update calls.
 		/// </summary>
 		struct WorldState mWorldState;
 
+		/// <summary>
+		/// EventChannel instances flushed by Update, in order.
+		/// </summary>
+		Vector<IEventChannel*> mEventChannels;
+
 		/// <summary>
 		/// Represents whether the game loop is running.
 		/// </summary>
@@ -26,6 +26,21 @@ namespace Library
 		/// Handle to the current EventQueue. May be null.
 		/// </summary>
 		class EventQueue* EventQueue{ nullptr };
+
+		/// <summary>
+		/// Handle to the frame arena of the current World, reset at the start of every World update. May be null.
+		/// </summary>
+		class FrameAllocator* FrameAllocator{ nullptr };
+
+		/// <summary>
+		/// Handle to the component storage of the current World. May be null.
+		/// </summary>
+		class ComponentStore* ComponentStore{ nullptr };
+
+		/// <summary>
+		/// Handle to the JobSystem used for parallel updates. Updates run serially when null.
+		/// </summary>
+		class JobSystem* JobSystem{ nullptr };
 		
 		/// <summary>
 		/// Handle to the current World. May be null.
@@ -41,6 +56,12 @@ namespace Library
 		/// Handle to the current Entity. May be null.
 		/// </summary>
 		class Entity* Entity{ nullptr };
+
+		/// <summary>
+		/// Fraction of a fixed timestep accumulated but not yet simulated by World::Run, in [0, 1).
+		/// Used to interpolate between the two most recent simulation steps. Zero outside of fixed timestep runs.
+		/// </summary>
+		float InterpolationAlpha{ 0.0f };
 	};
 	
 	/// <summary>
@@ -67,6 +88,21 @@ namespace Library
 		/// Handle to the current EventQueue. May be null.
 		/// </summary>
 		const class EventQueue* EventQueue{ nullptr };
+
+		/// <summary>
+		/// Handle to the frame arena of the current World, reset at the start of every World update. May be null.
+		/// </summary>
+		class FrameAllocator* FrameAllocator{ nullptr };
+
+		/// <summary>
+		/// Handle to the component storage of the current World. May be null.
+		/// </summary>
+		const class ComponentStore* ComponentStore{ nullptr };
+
+		/// <summary>
+		/// Handle to the JobSystem used for parallel updates. Updates run serially when null.
+		/// </summary>
+		class JobSystem* JobSystem{ nullptr };
 		
 		/// <summary>
 		/// Handle to the current World. May be null.
@@ -82,6 +118,12 @@ namespace Library
 		/// Handle to the current Entity. May be null.
 		/// </summary>
 		const class Entity* Entity{ nullptr };
+
+		/// <summary>
+		/// Fraction of a fixed timestep accumulated but not yet simulated by World::Run, in [0, 1).
+		/// Used to interpolate between the two most recent simulation steps. Zero outside of fixed timestep runs.
+		/// </summary>
+		float InterpolationAlpha{ 0.0f };
 	};
 }
 
@@ -3,6 +3,7 @@
 #include "ToStringSpecialization.h"
 #include "ActionCreate.h"
 #include "Entity.h"
+#include "StopWatch.h"
 
 using namespace std::string_literals;
 
@@ -132,6 +133,53 @@ namespace EntitySystemTests::ActionTests
 			Assert::AreEqual(addedAction, *entity.FindChild("Added")->As<ActionCreate>());
 		}
 
+		TEST_METHOD(SpawnBenchmark)
+		{
+			const std::size_t partCount = 4;
+			const std::size_t spawnerCount = 100;
+			const std::size_t frames = 20;
+
+			Entity prototype("Spawned");
+			prototype.AppendAuxiliaryAttribute("Health") = 100;
+			prototype.AppendAuxiliaryAttribute("Position") = glm::vec4(0.0f);
+
+			for (std::size_t i = 0; i < partCount; ++i)
+			{
+				Entity& part = prototype.CreateChild("Entity", "Part" + std::to_string(i));
+				part.AppendAuxiliaryAttribute("Offset") = glm::vec4(static_cast<float>(i));
+			}
+
+			World world;
+			Entity& root = world.CreateChild("Entity", "Root");
+
+			for (std::size_t i = 0; i < spawnerCount; ++i)
+			{
+				Entity& create = root.CreateChild("ActionCreate"s, "Spawner"s);
+				*create.Find(ActionCreate::EntityPrototypeKey) = prototype.As<Scope>();
+			}
+
+			StopWatch stopWatch;
+			stopWatch.Start();
+
+			for (std::size_t frame = 0; frame < frames; ++frame)
+			{
+				world.Update();
+			}
+
+			stopWatch.Stop();
+
+			Assert::AreEqual(spawnerCount * frames, root.Find("Spawned")->Size());
+			Assert::AreEqual(prototype, *root.FindChild("Spawned"));
+
+			const double spawnedCount = static_cast<double>(spawnerCount * frames * (partCount + 1));
+			const double seconds = static_cast<double>(stopWatch.Elapsed().count()) / 1000000.0;
+
+			std::stringstream message;
+			message << "ActionCreate spawned " << (spawnerCount * frames) << " Entity trees of " << (partCount + 1) << ": "
+				<< (spawnedCount / seconds) << " entities/s";
+			Logger::WriteMessage(message.str().c_str());
+		}
+
 		TEST_METHOD(ToString)
 		{
 			const ActionCreate actionCreate("Create");
@@ -118,6 +118,14 @@ namespace EntitySystemTests::ActionTests
 			world.Update();
 
 			Assert::AreEqual(1_z, entity.ChildCount());
+
+			entity.AddChild(*new Entity("SecondEntityToDestroy"));
+			actionDestroyAction.As<ActionDestroy>()->SetTarget("SecondEntityToDestroy"s);
+			Assert::AreEqual("SecondEntityToDestroy"s, actionDestroyAction.As<ActionDestroy>()->GetTarget());
+
+			world.Update();
+
+			Assert::AreEqual(1_z, entity.ChildCount());
 		}
 
 		TEST_METHOD(ToString)
@@ -3,6 +3,7 @@
 #include "ToStringSpecialization.h"
 #include "ActionIncrement.h"
 #include "Entity.h"
+#include "StopWatch.h"
 
 using namespace std::string_literals;
 
@@ -136,6 +137,99 @@ namespace EntitySystemTests::ActionTests
 
 			Assert::AreEqual(0, integer1);
 			Assert::AreEqual(3, integer2);
+
+			ActionIncrement copy(castIncrement2);
+			copy.Update(worldState);
+
+			Assert::AreEqual(3, integer2);
+
+			int& shadow = (increment2.Append("Integer2") = 0).Get<int>();
+			castIncrement2.Update(worldState);
+
+			Assert::AreEqual(3, integer2);
+			Assert::AreEqual(1, shadow);
+
+			castIncrement2.SetOperand("Integer1"s);
+			Assert::AreEqual("Integer1"s, castIncrement2.GetOperand());
+			castIncrement2.Update(worldState);
+
+			Assert::AreEqual(1, integer1);
+			Assert::AreEqual(1, shadow);
+
+			*castIncrement2.Find(ActionIncrement::OperandKey) = "Integer2"s;
+			castIncrement2.Initialize(worldState);
+			castIncrement2.Update(worldState);
+
+			Assert::AreEqual(1, integer1);
+			Assert::AreEqual(2, shadow);
+		}
+
+		TEST_METHOD(Benchmark)
+		{
+			const std::size_t depth = 8;
+			const std::size_t frames = 100000;
+
+			Entity root("Root");
+			int& counter = (root.Append("Counter") = 0).Get<int>();
+
+			Entity* parent = &root;
+
+			for (std::size_t i = 0; i < depth; ++i)
+			{
+				parent = &parent->CreateChild("Entity", "Level" + std::to_string(i));
+				parent->Append("Unrelated") = static_cast<int>(i);
+			}
+
+			ActionIncrement& increment = static_cast<ActionIncrement&>(parent->CreateChild("ActionIncrement"s, "Increment"s));
+			*increment.Find(ActionIncrement::OperandKey) = "Counter"s;
+
+			WorldState worldState;
+			StopWatch stopWatch;
+
+			const NameId counterId("Counter");
+			stopWatch.Start();
+
+			for (std::size_t frame = 0; frame < frames; ++frame)
+			{
+				increment.Search(counterId)->Get<int>() += 1;
+			}
+
+			stopWatch.Stop();
+			const auto searchElapsed = stopWatch.Elapsed();
+
+			stopWatch.Start();
+
+			for (std::size_t frame = 0; frame < frames; ++frame)
+			{
+				increment.Update(worldState);
+			}
+
+			stopWatch.Stop();
+			const auto updateElapsed = stopWatch.Elapsed();
+
+			stopWatch.Start();
+
+			for (std::size_t frame = 0; frame < frames; ++frame)
+			{
+				Entity& spawned = root.CreateChild("Entity", "Spawned");
+				spawned.Append("Counter") = 0;
+
+				increment.Update(worldState);
+
+				root.DestroyChild(spawned);
+			}
+
+			stopWatch.Stop();
+			const auto churnElapsed = stopWatch.Elapsed();
+
+			Assert::AreEqual(static_cast<int>(3 * frames), counter);
+
+			std::stringstream message;
+			message << "ActionIncrement operand " << (depth + 1) << " levels up: Search "
+				<< (static_cast<double>(searchElapsed.count()) * 1000.0 / frames) << " ns, Update "
+				<< (static_cast<double>(updateElapsed.count()) * 1000.0 / frames) << " ns, Update while spawning and destroying an Entity "
+				<< (static_cast<double>(churnElapsed.count()) * 1000.0 / frames) << " ns";
+			Logger::WriteMessage(message.str().c_str());
 		}
 
 		TEST_METHOD(ToString)
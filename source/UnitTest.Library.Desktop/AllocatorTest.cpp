@@ -0,0 +1,246 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "HeapAllocator.h"
+#include "FrameAllocator.h"
+#include "StackAllocator.h"
+#include "Vector.h"
+#include "StopWatch.h"
+
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+using namespace Library;
+
+
+namespace UtilityTests
+{
+	TEST_CLASS(AllocatorTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(HeapAllocatorTest)
+		{
+			HeapAllocator& allocator = HeapAllocator::Instance();
+			Assert::IsTrue(&allocator == &HeapAllocator::Instance());
+
+			int* data = static_cast<int*>(allocator.Allocate(sizeof(int) * 4, alignof(int)));
+			data[3] = 10;
+
+			data = static_cast<int*>(allocator.Reallocate(data, sizeof(int) * 4, sizeof(int) * 64, alignof(int)));
+			Assert::AreEqual(10, data[3]);
+
+			Assert::IsNull(allocator.Reallocate(data, sizeof(int) * 64, 0, alignof(int)));
+			allocator.Deallocate(nullptr, 0);
+		}
+
+		TEST_METHOD(FrameAllocatorTest)
+		{
+			FrameAllocator allocator(256);
+			Assert::AreEqual(256_z, allocator.Capacity());
+			Assert::AreEqual(0_z, allocator.Size());
+
+			void* a = allocator.Allocate(10, 1);
+			void* b = allocator.Allocate(16, 16);
+			Assert::AreEqual(0_z, reinterpret_cast<std::uintptr_t>(b) % 16);
+			Assert::IsTrue(static_cast<std::byte*>(b) >= static_cast<std::byte*>(a) + 10);
+
+			const std::size_t size = allocator.Size();
+			void* grown = allocator.Reallocate(b, 16, 32, 16);
+			Assert::IsTrue(b == grown);
+			Assert::AreEqual(size + 16, allocator.Size());
+
+			allocator.Deallocate(grown, 32);
+			Assert::IsTrue(allocator.Size() < size);
+
+			static_cast<char*>(a)[9] = 'a';
+			void* copied = allocator.Reallocate(a, 10, 20, 1);
+			Assert::IsTrue(a != copied);
+			Assert::AreEqual('a', static_cast<char*>(copied)[9]);
+			Assert::IsTrue(a == allocator.Reallocate(a, 10, 5, 1));
+
+			allocator.Reset();
+			Assert::AreEqual(0_z, allocator.Size());
+			Assert::AreEqual(256_z, allocator.Capacity());
+
+			allocator.Allocate(200);
+			void* overflow = allocator.Allocate(200, 64);
+			Assert::IsNotNull(overflow);
+			Assert::AreEqual(0_z, reinterpret_cast<std::uintptr_t>(overflow) % 64);
+			Assert::IsTrue(allocator.Size() > 400);
+
+			allocator.Reset();
+			Assert::AreEqual(0_z, allocator.Size());
+			Assert::AreEqual(512_z, allocator.Capacity());
+
+			allocator.Allocate(200, 1);
+			allocator.Allocate(200, 1);
+			Assert::AreEqual(400_z, allocator.Size());
+		}
+
+		TEST_METHOD(StackAllocatorTest)
+		{
+			alignas(std::max_align_t) std::byte buffer[512];
+			StackAllocator allocator(buffer, sizeof(buffer));
+			Assert::AreEqual(512_z, allocator.Capacity());
+			Assert::AreEqual(0_z, allocator.Size());
+
+			void* a = allocator.Allocate(16);
+			void* b = allocator.Allocate(16, 32);
+			Assert::IsTrue(allocator.Owns(a));
+			Assert::IsTrue(allocator.Owns(b));
+			Assert::AreEqual(0_z, reinterpret_cast<std::uintptr_t>(b) % 32);
+
+			void* grown = allocator.Reallocate(b, 16, 64, 32);
+			Assert::IsTrue(b == grown);
+
+			const std::size_t size = allocator.Size();
+			allocator.Deallocate(a, 16);
+			Assert::AreEqual(size, allocator.Size());
+
+			allocator.Deallocate(grown, 64);
+			Assert::AreEqual(0_z, allocator.Size());
+
+			a = allocator.Allocate(16);
+			b = allocator.Allocate(16);
+			static_cast<char*>(a)[15] = 'a';
+
+			void* moved = allocator.Reallocate(a, 16, 32);
+			Assert::IsTrue(a != moved);
+			Assert::AreEqual('a', static_cast<char*>(moved)[15]);
+
+			allocator.Deallocate(b, 16);
+			Assert::IsTrue(allocator.Size() > 0);
+			allocator.Deallocate(moved, 32);
+			Assert::AreEqual(0_z, allocator.Size());
+
+			void* heap = allocator.Allocate(1024);
+			Assert::IsFalse(allocator.Owns(heap));
+			Assert::AreEqual(0_z, allocator.Size());
+
+			heap = allocator.Reallocate(heap, 1024, 2048);
+			Assert::IsFalse(allocator.Owns(heap));
+			allocator.Deallocate(heap, 2048);
+			allocator.Deallocate(nullptr, 0);
+		}
+
+		TEST_METHOD(ThreadLocalStackAllocator)
+		{
+			StackAllocator& allocator = StackAllocator::ThreadLocal();
+			Assert::IsTrue(&allocator == &StackAllocator::ThreadLocal());
+			Assert::AreEqual(StackAllocator::ThreadLocalCapacity, allocator.Capacity());
+
+			StackAllocator* otherAllocator = nullptr;
+			std::thread thread([&otherAllocator] { otherAllocator = &StackAllocator::ThreadLocal(); });
+			thread.join();
+
+			Assert::IsTrue(&allocator != otherAllocator);
+
+			const std::size_t size = allocator.Size();
+
+			{
+				Vector<int> scratch(allocator, 16);
+				for (int i = 0; i < 1000; ++i)
+				{
+					scratch.PushBack(i);
+				}
+
+				Assert::IsTrue(allocator.Owns(&scratch.Front()));
+				Assert::AreEqual(999, scratch.Back());
+			}
+
+			Assert::AreEqual(size, allocator.Size());
+		}
+
+		TEST_METHOD(Benchmark)
+		{
+			const std::size_t iterations = 100000;
+			const std::size_t elementCount = 64;
+
+			StopWatch stopWatch;
+			std::size_t sum = 0;
+
+			stopWatch.Start();
+			for (std::size_t i = 0; i < iterations; ++i)
+			{
+				Vector<std::size_t> scratch;
+				for (std::size_t j = 0; j < elementCount; ++j)
+				{
+					scratch.PushBack(j);
+				}
+				sum += scratch.Back();
+			}
+			stopWatch.Stop();
+			const auto heapTime = stopWatch.Elapsed();
+			stopWatch.Reset();
+
+			StackAllocator& stackAllocator = StackAllocator::ThreadLocal();
+
+			stopWatch.Start();
+			for (std::size_t i = 0; i < iterations; ++i)
+			{
+				Vector<std::size_t> scratch(stackAllocator);
+				for (std::size_t j = 0; j < elementCount; ++j)
+				{
+					scratch.PushBack(j);
+				}
+				sum -= scratch.Back();
+			}
+			stopWatch.Stop();
+			const auto stackTime = stopWatch.Elapsed();
+			stopWatch.Reset();
+
+			FrameAllocator frameAllocator;
+
+			stopWatch.Start();
+			for (std::size_t i = 0; i < iterations; ++i)
+			{
+				Vector<std::size_t> scratch(frameAllocator);
+				for (std::size_t j = 0; j < elementCount; ++j)
+				{
+					scratch.PushBack(j);
+				}
+				sum += scratch.Back();
+				frameAllocator.Reset();
+			}
+			stopWatch.Stop();
+			const auto frameTime = stopWatch.Elapsed();
+
+			Assert::AreEqual((elementCount - 1) * iterations, sum);
+
+			std::stringstream message;
+			message << "Scratch Vector " << elementCount << " elements: HeapAllocator " << (heapTime.count() * 1000.0 / iterations)
+				<< " ns/op, StackAllocator " << (stackTime.count() * 1000.0 / iterations)
+				<< " ns/op, FrameAllocator " << (frameTime.count() * 1000.0 / iterations) << " ns/op";
+			Logger::WriteMessage(message.str().c_str());
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState AllocatorTest::sStartMemState;
+}
\ No newline at end of file
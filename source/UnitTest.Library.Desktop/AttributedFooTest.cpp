@@ -3,6 +3,7 @@
 #include "ToStringSpecialization.h"
 #include "AttributedFoo.h"
 #include "DerivedAttributedFoo.h"
+#include "StopWatch.h"
 
 
 using namespace std::string_literals;
@@ -14,6 +15,41 @@ using namespace UnitTests;
 
 namespace ReflectionSystemTests
 {
+	struct AttributedWide final : public Attributed
+	{
+		RTTI_DECLARATIONS(AttributedWide, Attributed)
+
+	public:
+		static constexpr std::size_t AttributeCount{ 200 };
+
+		AttributedWide() : Attributed(TypeIdClass())
+		{
+		}
+
+		virtual gsl::owner<Library::Scope*> Clone() const override
+		{
+			return new AttributedWide(*this);
+		}
+
+		static const Library::SignatureList& Signatures()
+		{
+			static const Library::SignatureList signatures = []
+			{
+				Library::SignatureList list;
+				list.Reserve(AttributeCount);
+
+				for (std::size_t i = 0; i < AttributeCount; ++i)
+				{
+					list.EmplaceBack("Prescribed" + std::to_string(i), Types::Integer, true, 1);
+				}
+
+				return list;
+			}();
+
+			return signatures;
+		}
+	};
+
 	TEST_CLASS(AttributedFooTest)
 	{
 	public:
@@ -22,6 +58,7 @@ namespace ReflectionSystemTests
 			TypeManager::Create();
 			RegisterType<AttributedFoo>();
 			RegisterType<DerivedAttributedFoo>();
+			RegisterType<AttributedWide>();
 
 #if defined(DEBUG) || defined(_DEBUG)
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
@@ -321,7 +358,7 @@ namespace ReflectionSystemTests
 			const AttributedFoo constA(a);
 
 			count = 0;
-			auto constFunctor = [&constA, &count](const Attributed::Attribute& attribute)
+			auto constFunctor = [&constA, &count](const Attributed::ConstAttribute& attribute)
 			{
 				count++;
 				Assert::IsNotNull(constA.Find(attribute.first));
@@ -379,6 +416,138 @@ namespace ReflectionSystemTests
 			delete derived;
 		}
 
+		TEST_METHOD(SlotStorage)
+		{
+			AttributedFoo a(10);
+			const TypeLayout* layout = TypeManager::Instance()->FindLayout(a.TypeIdInstance());
+
+			Assert::AreEqual(layout->PrescribedCount(), a.SlotCount());
+			Assert::AreEqual(a.SlotCount(), a.Size());
+			Assert::AreEqual(0_z, a.AuxiliaryCount());
+			Assert::AreEqual("this"s, *a.FindName(0));
+			Assert::AreEqual("Integer"s, *a.FindName(TypeLayout::FirstIndex));
+			Assert::IsTrue(a.Find("Integer"s) == &a[TypeLayout::FirstIndex]);
+			Assert::IsTrue(a.Find(NameId("Integer")) == &a[TypeLayout::FirstIndex]);
+
+			a.AppendAuxiliaryAttribute("auxInteger") = 20;
+			a.AppendScope("auxScope");
+			Assert::AreEqual(a.SlotCount() + 2, a.Size());
+			Assert::AreEqual("auxInteger"s, *a.FindName(a.SlotCount()));
+			Assert::AreEqual(20, a[a.SlotCount()].Get<int>());
+			Assert::IsNull(a.FindName(a.Size()));
+
+			AttributedFoo b(a);
+			Assert::AreEqual(a.SlotCount(), b.SlotCount());
+			Assert::AreEqual(a.Size(), b.Size());
+			Assert::IsTrue(a.Find("Integer"s) != b.Find("Integer"s));
+			Assert::IsTrue(&a["auxScope"][0] != &b["auxScope"][0]);
+			Assert::IsTrue(a == b);
+
+			AttributedFoo c(std::move(b));
+			Assert::AreEqual(a.Size(), c.Size());
+			Assert::AreEqual(0_z, b.SlotCount());
+			Assert::IsTrue(c.Find("this"s)->Get<RTTI*>() == &c);
+
+			b = c;
+			Assert::AreEqual(c.SlotCount(), b.SlotCount());
+			Assert::IsTrue(b.Find("this"s)->Get<RTTI*>() == &b);
+
+			c.ShrinkToFit();
+			Assert::AreEqual(a.Size(), c.Size());
+			Assert::AreEqual(20, c["auxInteger"s].Get<int>());
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState startMemState, endMemState, diffMemState;
+
+			_CrtMemCheckpoint(&startMemState);
+			{
+				AttributedFoo foo(10);
+			}
+			_CrtMemCheckpoint(&endMemState);
+			_CrtMemDifference(&diffMemState, &startMemState, &endMemState);
+			const std::size_t slotBytes = diffMemState.lTotalCount;
+
+			_CrtMemCheckpoint(&startMemState);
+			{
+				Scope scope;
+				a.ForEachPrescribed([&scope](const Attributed::ConstAttribute& attribute)
+				{
+					scope.Append(attribute.first);
+				});
+			}
+			_CrtMemCheckpoint(&endMemState);
+			_CrtMemDifference(&diffMemState, &startMemState, &endMemState);
+			const std::size_t tableBytes = diffMemState.lTotalCount;
+
+			Assert::IsTrue(slotBytes * 4 < tableBytes);
+
+			std::stringstream message;
+			message << "AttributedFoo " << a.SlotCount() << " prescribed attributes: " << slotBytes
+				<< " bytes allocated per instance, Scope table: " << tableBytes << " bytes";
+			Logger::WriteMessage(message.str().c_str());
+#endif
+		}
+
+		TEST_METHOD(PrescribedLookupBenchmark)
+		{
+			const std::size_t iterations = 100;
+
+			Vector<std::string> prescribedKeys;
+			Vector<std::string> auxiliaryKeys;
+
+			for (std::size_t i = 0; i < AttributedWide::AttributeCount; ++i)
+			{
+				prescribedKeys.EmplaceBack("Prescribed" + std::to_string(i));
+				auxiliaryKeys.EmplaceBack("Auxiliary" + std::to_string(i));
+			}
+
+			AttributedWide wide;
+			Assert::AreEqual(AttributedWide::AttributeCount + 1, wide.SlotCount());
+			Assert::ExpectException<std::runtime_error>([&wide, &prescribedKeys] { wide.AppendAuxiliaryAttribute(prescribedKeys.Back()); });
+
+			StopWatch stopWatch;
+			std::size_t matchCount = 0;
+
+			stopWatch.Start();
+
+			for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				for (std::size_t i = 0; i < AttributedWide::AttributeCount; ++i)
+				{
+					if (wide.IsPrescribedAttribute(prescribedKeys[i]))	++matchCount;
+					if (wide.IsAuxiliaryAttribute(auxiliaryKeys[i]))	++matchCount;
+				}
+			}
+
+			stopWatch.Stop();
+			const auto queryElapsed = stopWatch.Elapsed();
+
+			Assert::AreEqual(2 * iterations * AttributedWide::AttributeCount, matchCount);
+
+			stopWatch.Start();
+
+			for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				AttributedWide instance;
+
+				for (std::size_t i = 0; i < AttributedWide::AttributeCount; ++i)
+				{
+					instance.AppendAuxiliaryAttribute(auxiliaryKeys[i]) = static_cast<int>(i);
+				}
+
+				Assert::AreEqual(AttributedWide::AttributeCount, instance.AuxiliaryCount());
+			}
+
+			stopWatch.Stop();
+			const auto appendElapsed = stopWatch.Elapsed();
+
+			std::stringstream message;
+			message << "AttributedWide " << AttributedWide::AttributeCount << " prescribed attributes: "
+				<< (static_cast<double>(queryElapsed.count()) * 1000.0 / (2 * iterations * AttributedWide::AttributeCount)) << " ns/query, "
+				<< (static_cast<double>(appendElapsed.count()) / iterations) << " us/instance with " << AttributedWide::AttributeCount << " auxiliary attributes";
+			Logger::WriteMessage(message.str().c_str());
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
@@ -0,0 +1,279 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "ComponentStore.h"
+#include "World.h"
+#include "StopWatch.h"
+
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+using namespace Library;
+
+
+namespace EntitySystemTests
+{
+	TEST_CLASS(ComponentStoreTest)
+	{
+		struct Position final
+		{
+			glm::vec3 Value;
+		};
+
+		struct Velocity final
+		{
+			glm::vec3 Value;
+		};
+
+		struct Health final
+		{
+			int Value;
+		};
+
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			TypeManager::Create();
+			RegisterType<Entity>();
+			RegisterType<World>();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			TypeManager::Destroy();
+		}
+
+		TEST_METHOD(CreateDestroy)
+		{
+			ComponentStore store;
+			Assert::AreEqual(0_z, store.Size());
+			Assert::IsFalse(store.IsAlive(ComponentStore::Handle()));
+
+			const auto a = store.Create(Position{ glm::vec3(1) }, Health{ 10 });
+			const auto b = store.Create(Position{ glm::vec3(2) }, Health{ 20 });
+			const auto c = store.Create(Health{ 30 }, Position{ glm::vec3(3) });
+			Assert::AreEqual(3_z, store.Size());
+			Assert::AreEqual(1_z, store.ArchetypeCount());
+			Assert::IsTrue(store.IsAlive(a) && store.IsAlive(b) && store.IsAlive(c));
+			Assert::AreEqual(20, store.Get<Health>(b).Value);
+			Assert::IsTrue(glm::vec3(3) == store.Get<Position>(c).Value);
+
+			Assert::IsTrue(store.Destroy(a));
+			Assert::IsFalse(store.Destroy(a));
+			Assert::IsFalse(store.IsAlive(a));
+			Assert::AreEqual(2_z, store.Size());
+			Assert::AreEqual(30, store.Get<Health>(c).Value);
+			Assert::IsTrue(glm::vec3(3) == store.Get<Position>(c).Value);
+			Assert::ExpectException<std::runtime_error>([&store, &a] { store.Get<Health>(a); });
+
+			const auto d = store.Create(Health{ 40 });
+			Assert::AreEqual(a.Index, d.Index);
+			Assert::IsTrue(a != d);
+			Assert::IsFalse(store.IsAlive(a));
+			Assert::AreEqual(2_z, store.ArchetypeCount());
+
+			const ComponentStore& constStore = store;
+			Assert::AreEqual(40, constStore.Get<Health>(d).Value);
+			Assert::ExpectException<std::runtime_error>([&constStore, &d] { constStore.Get<Position>(d); });
+
+			store.Clear();
+			Assert::AreEqual(0_z, store.Size());
+			Assert::IsFalse(store.IsAlive(b) || store.IsAlive(c) || store.IsAlive(d));
+
+			const auto e = store.Create(Velocity{ glm::vec3(5) });
+			Assert::IsTrue(store.IsAlive(e));
+			Assert::AreEqual(1_z, store.Size());
+		}
+
+		TEST_METHOD(AddRemove)
+		{
+			ComponentStore store;
+			const auto a = store.Create(Position{ glm::vec3(1) });
+			const auto b = store.Create(Position{ glm::vec3(2) });
+			Assert::IsTrue(store.Has<Position>(a));
+			Assert::IsFalse(store.Has<Velocity>(a));
+
+			store.Add(a, Velocity{ glm::vec3(10) });
+			Assert::IsTrue(store.Has<Velocity>(a));
+			Assert::IsTrue(glm::vec3(1) == store.Get<Position>(a).Value);
+			Assert::IsTrue(glm::vec3(10) == store.Get<Velocity>(a).Value);
+			Assert::IsTrue(glm::vec3(2) == store.Get<Position>(b).Value);
+			Assert::AreEqual(2_z, store.ArchetypeCount());
+
+			store.Add(a, Velocity{ glm::vec3(20) }).Value.x = 30;
+			Assert::IsTrue(glm::vec3(30, 20, 20) == store.Get<Velocity>(a).Value);
+			Assert::AreEqual(2_z, store.ArchetypeCount());
+
+			Assert::IsTrue(store.Remove<Position>(a));
+			Assert::IsFalse(store.Remove<Position>(a));
+			Assert::IsFalse(store.Has<Position>(a));
+			Assert::IsTrue(glm::vec3(30, 20, 20) == store.Get<Velocity>(a).Value);
+			Assert::AreEqual(3_z, store.ArchetypeCount());
+
+			Assert::IsTrue(store.Destroy(b));
+			Assert::ExpectException<std::runtime_error>([&store, &b] { store.Add(b, Health{ 0 }); });
+			Assert::ExpectException<std::runtime_error>([&store, &b] { store.Remove<Position>(b); });
+			Assert::IsFalse(store.Has<Position>(b));
+		}
+
+		TEST_METHOD(Query)
+		{
+			ComponentStore store;
+			const std::size_t count = 5000;
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const auto position = Position{ glm::vec3(static_cast<float>(i)) };
+				const auto velocity = Velocity{ glm::vec3(1) };
+
+				if (i % 2 == 0)
+				{
+					store.Create(position, velocity);
+				}
+				else
+				{
+					store.Create(position, velocity, Health{ static_cast<int>(i) });
+				}
+			}
+
+			store.Create(Position{ glm::vec3(0) });
+
+			std::size_t chunkCount = 0;
+			std::size_t rowCount = 0;
+			store.ForEachChunk<Position, Velocity>([&chunkCount, &rowCount](const std::size_t size, Position* positions, Velocity* velocities)
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					positions[i].Value += velocities[i].Value;
+				}
+
+				++chunkCount;
+				rowCount += size;
+			});
+
+			Assert::AreEqual(count, rowCount);
+			Assert::IsTrue(chunkCount > 2);
+
+			float sum = 0;
+			store.ForEach<Position>([&sum](const Position& position)
+			{
+				sum += position.Value.x;
+			});
+			Assert::AreEqual(static_cast<float>(count * (count + 1) / 2), sum);
+
+			std::size_t healthCount = 0;
+			store.ForEach<Health, Position>([&healthCount](Health& health, const Position& position)
+			{
+				Assert::AreEqual(static_cast<float>(health.Value + 1), position.Value.x);
+				++healthCount;
+			});
+			Assert::AreEqual(count / 2, healthCount);
+		}
+
+		TEST_METHOD(WorldSystems)
+		{
+			World world("World");
+			ComponentStore& store = world.GetComponentStore();
+			Assert::IsTrue(&store == world.GetWorldState().ComponentStore);
+
+			Entity& entity = world.CreateChild("Entity", "Entity");
+			Assert::IsFalse(entity.ComponentHandle().IsValid());
+			entity.SetComponentHandle(store.Create(Position{ glm::vec3(0) }, Velocity{ glm::vec3(1, 2, 3) }));
+
+			store.AddSystem([](ComponentStore& componentStore, WorldState& worldState)
+			{
+				Assert::IsNotNull(worldState.World);
+
+				componentStore.ForEach<Position, Velocity>([](Position& position, const Velocity& velocity)
+				{
+					position.Value += velocity.Value;
+				});
+			});
+			Assert::AreEqual(1_z, store.SystemCount());
+
+			world.Update();
+			world.Update();
+			Assert::IsTrue(glm::vec3(2, 4, 6) == store.Get<Position>(entity.ComponentHandle()).Value);
+
+			World copy(world);
+			Assert::AreEqual(0_z, copy.GetComponentStore().Size());
+			Assert::IsTrue(&copy.GetComponentStore() == copy.GetWorldState().ComponentStore);
+			Assert::IsFalse(copy.FindChild("Entity")->ComponentHandle().IsValid());
+
+			World moved(std::move(world));
+			Assert::AreEqual(1_z, moved.GetComponentStore().Size());
+			Assert::AreEqual(1_z, moved.GetComponentStore().SystemCount());
+			Assert::IsTrue(&moved.GetComponentStore() == moved.GetWorldState().ComponentStore);
+
+			moved.Update();
+			Assert::IsTrue(glm::vec3(3, 6, 9) == moved.GetComponentStore().Get<Position>(moved.FindChild("Entity")->ComponentHandle()).Value);
+		}
+
+		TEST_METHOD(Benchmark)
+		{
+			const std::size_t count = 1000000;
+			const std::size_t frames = 10;
+			const float deltaTime = 1.0f / 60.0f;
+
+			ComponentStore store;
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				store.Create(Position{ glm::vec3(0) }, Velocity{ glm::vec3(1) });
+			}
+
+			StopWatch stopWatch;
+			stopWatch.Start();
+
+			for (std::size_t frame = 0; frame < frames; ++frame)
+			{
+				store.ForEachChunk<Position, Velocity>([deltaTime](const std::size_t size, Position* positions, const Velocity* velocities)
+				{
+					for (std::size_t i = 0; i < size; ++i)
+					{
+						positions[i].Value += velocities[i].Value * deltaTime;
+					}
+				});
+			}
+
+			stopWatch.Stop();
+			const double microseconds = static_cast<double>(stopWatch.Elapsed().count());
+
+			float sum = 0;
+			store.ForEach<Position>([&sum](const Position& position) { sum += position.Value.x; });
+			Assert::AreEqual(count * frames * deltaTime, sum, count * 0.01f);
+
+			const double bytes = static_cast<double>(count * frames * (2 * sizeof(Position) + sizeof(Velocity)));
+
+			std::stringstream message;
+			message << "ComponentStore Position+Velocity " << count << " entities: " << (microseconds * 1000.0 / (count * frames))
+				<< " ns/entity, " << (bytes / microseconds / 1000.0) << " GB/s";
+			Logger::WriteMessage(message.str().c_str());
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+
+		EntityFactory entityFactory;
+	};
+
+	_CrtMemState ComponentStoreTest::sStartMemState;
+}
\ No newline at end of file
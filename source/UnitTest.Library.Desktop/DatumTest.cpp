@@ -4,6 +4,7 @@
 #include "Foo.h"
 #include "Bar.h"
 #include "Datum.h"
+#include "StopWatch.h"
 
 
 using namespace std::string_literals;
@@ -150,7 +151,7 @@ namespace UnitTests
 		Assert::AreEqual(10_z, datum.Capacity());
 
 		datum.Resize(10);
-		datum.SetReserveStrategy(Datum::DefaultReserveFunctor());
+		datum.SetReserveStrategy(Datum::ReserveStrategy::Default);
 		datum.PushBack(*data.begin());
 		Assert::AreEqual(15_z, datum.Capacity());
 	}
@@ -196,6 +197,14 @@ namespace UnitTests
 		Assert::AreEqual(0_z, datum.Capacity());
 	}
 
+	template<typename T>
+	bool IsInline(const Datum& datum)
+	{
+		const std::byte* data = reinterpret_cast<const std::byte*>(datum.Data<T>());
+		const std::byte* begin = reinterpret_cast<const std::byte*>(&datum);
+		return data >= begin && data < begin + sizeof(Datum);
+	}
+
 	template<typename T>
 	void TestElementAccessors(std::initializer_list<T> data, const T& notFoundData)
 	{
@@ -522,6 +531,32 @@ namespace ContainerTests
 			TestTypeSizeCapacity<Datum*>({ nullptr, nullptr, nullptr });
 		}
 
+		TEST_METHOD(ReserveStrategy)
+		{
+			Datum datum = 10;
+			Assert::AreEqual(1_z, datum.Capacity());
+
+			datum.SetReserveStrategy(Datum::ReserveStrategy::Double);
+			datum.PushBack(20);
+			Assert::AreEqual(2_z, datum.Capacity());
+			datum.PushBack(30);
+			Assert::AreEqual(4_z, datum.Capacity());
+
+			datum.Resize(4);
+			datum.SetReserveStrategy(Datum::ReserveStrategy::Increment);
+			datum.PushBack(40);
+			Assert::AreEqual(5_z, datum.Capacity());
+
+			datum.SetReserveStrategy(Datum::ReserveStrategy::Default);
+			datum.PushBack(50);
+			Assert::AreEqual(7_z, datum.Capacity());
+
+			Datum copy = datum;
+			copy.Resize(7);
+			copy.PushBack(60);
+			Assert::AreEqual(10_z, copy.Capacity());
+		}
+
 		TEST_METHOD(Resize)
 		{
 			TestResize<int>({ 10, 20, 30 });
@@ -556,6 +591,62 @@ namespace ContainerTests
 			TestShrinkToFit<Datum*>({ nullptr, nullptr, nullptr });
 		}
 
+		TEST_METHOD(InlineStorage)
+		{
+			Datum integer = 10;
+			Assert::IsTrue(IsInline<int>(integer));
+
+			Datum vector = glm::vec4(10);
+			Assert::IsTrue(IsInline<glm::vec4>(vector));
+
+			Foo a(10);
+			Datum pointer = &a;
+			Assert::IsTrue(IsInline<RTTI*>(pointer));
+
+			Datum matrix = glm::mat4(10);
+			Assert::IsFalse(IsInline<glm::mat4>(matrix));
+
+			Datum string = "10"s;
+			Assert::IsFalse(IsInline<std::string>(string));
+
+			Datum integers = { 10, 20, 30, 40 };
+			Assert::IsTrue(IsInline<int>(integers));
+
+			integers.PushBack(50);
+			Assert::IsFalse(IsInline<int>(integers));
+			Assert::AreEqual(5_z, integers.Size());
+			Assert::AreEqual(10, integers.Get<int>(0));
+			Assert::AreEqual(40, integers.Get<int>(3));
+			Assert::AreEqual(50, integers.Get<int>(4));
+
+			integers.Resize(2);
+			integers.ShrinkToFit();
+			Assert::IsTrue(IsInline<int>(integers));
+			Assert::AreEqual(2_z, integers.Capacity());
+			Assert::AreEqual(20, integers.Get<int>(1));
+
+			Datum copy = integers;
+			Assert::IsTrue(IsInline<int>(copy));
+			Assert::AreEqual(integers, copy);
+
+			Datum moved = std::move(copy);
+			Assert::IsTrue(IsInline<int>(moved));
+			Assert::AreEqual(integers, moved);
+			Assert::AreEqual(0_z, copy.Size());
+
+			Datum assigned = "10"s;
+			assigned = std::move(moved);
+			Assert::IsTrue(IsInline<int>(assigned));
+			Assert::AreEqual(integers, assigned);
+
+			Datum reserved;
+			reserved.SetType(Datum::Types::Pointer);
+			reserved.Reserve(2);
+			Assert::IsTrue(IsInline<RTTI*>(reserved));
+			reserved.Reserve(3);
+			Assert::IsFalse(IsInline<RTTI*>(reserved));
+		}
+
 		TEST_METHOD(ElementAccessors)
 		{
 			TestElementAccessors<int>({ 10, 20, 30 }, 40);
@@ -739,6 +830,86 @@ namespace ContainerTests
 			TestStringConversion<Datum*>({ nullptr, nullptr, nullptr });
 		}
 
+		TEST_METHOD(Benchmark)
+		{
+			const std::size_t count = 1000000;
+
+			StopWatch stopWatch;
+			std::size_t sum = 0;
+
+			stopWatch.Start();
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				Datum datum = static_cast<int>(i & 0xFF);
+				sum += static_cast<std::size_t>(datum.Get<int>());
+			}
+			stopWatch.Stop();
+			const auto datumTime = stopWatch.Elapsed();
+			stopWatch.Reset();
+
+			using ReserveFunctor = std::function<std::size_t(const std::size_t, const std::size_t)>;
+
+			stopWatch.Start();
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				Datum datum = static_cast<int>(i & 0xFF);
+				auto reserveFunctor = std::make_shared<ReserveFunctor>([](const std::size_t, const std::size_t capacity) { return capacity * 2; });
+				sum -= static_cast<std::size_t>(datum.Get<int>()) + (*reserveFunctor)(0, 0);
+			}
+			stopWatch.Stop();
+			const auto sharedFunctorTime = stopWatch.Elapsed();
+
+			Assert::AreEqual(0_z, sum);
+
+			std::stringstream message;
+			message << "Datum Construct " << count << " scalars: " << (datumTime.count() * 1000.0 / count)
+				<< " ns/op, with a shared reserve functor per Datum " << (sharedFunctorTime.count() * 1000.0 / count)
+				<< " ns/op, sizeof(Datum) " << sizeof(Datum);
+			Logger::WriteMessage(message.str().c_str());
+		}
+
+		TEST_METHOD(Visit)
+		{
+			Datum unknown;
+			Assert::ExpectException<std::runtime_error>([&unknown] { unknown.Visit([](auto) {}); });
+
+			Datum integers = { 10, 20, 30 };
+			integers.Visit([](auto data)
+			{
+				if constexpr (std::is_arithmetic_v<typename decltype(data)::element_type>)
+				{
+					for (auto& value : data)
+					{
+						value += value;
+					}
+				}
+			});
+
+			Assert::AreEqual(Datum({ 20, 40, 60 }), integers);
+
+			const Datum strings = { "10"s, "20"s, "30"s };
+			const std::size_t length = strings.Visit([](auto data)
+			{
+				using T = std::remove_const_t<typename decltype(data)::element_type>;
+
+				std::size_t total = 0;
+				if constexpr (std::is_same_v<T, std::string>)
+				{
+					for (const auto& value : data)
+					{
+						total += value.size();
+					}
+				}
+
+				return total;
+			});
+
+			Assert::AreEqual(6_z, length);
+
+			const Datum::Types type = strings.Visit([](auto data) { return Datum::TypeOf<std::remove_const_t<typename decltype(data)::element_type>>(); });
+			Assert::AreEqual(Datum::Types::String, type);
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
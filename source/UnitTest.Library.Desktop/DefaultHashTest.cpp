@@ -1,6 +1,11 @@
 #include "pch.h"
 
+#include <algorithm>
+#include <random>
+#include <sstream>
+
 #include "DefaultHash.h"
+#include "StopWatch.h"
 #include "Foo.h"
 #include "Bar.h"
 
@@ -19,17 +24,13 @@ namespace Library
 	template<>
 	inline std::size_t DefaultHash<Foo>::operator()(const Foo& key) const
 	{
-		int fooData = key.Data();
-		const uint8_t* data = reinterpret_cast<const uint8_t*>(&fooData);
-		return AdditiveHash(data, sizeof(int));
+		return static_cast<std::size_t>(IntegerHash(static_cast<std::uint64_t>(key.Data())));
 	}
 
 	template<>
 	inline std::size_t DefaultHash<Bar>::operator()(const Bar& key) const
 	{
-		int fooData = key.Data();
-		const uint8_t* data = reinterpret_cast<const uint8_t*>(&fooData);
-		return AdditiveHash(data, sizeof(int));
+		return static_cast<std::size_t>(IntegerHash(static_cast<std::uint64_t>(key.Data())));
 	}
 
 	template<typename T>
@@ -47,6 +48,58 @@ namespace Library
 	}
 }
 
+namespace UnitTests
+{
+	/// <summary>
+	/// Hash function previously used by DefaultHash, kept as a baseline for comparison.
+	/// </summary>
+	inline std::size_t AdditiveHash(const std::uint8_t* data, const std::size_t byteCount, const std::size_t hashPrime=31)
+	{
+		std::size_t hashValue = 0;
+
+		for (std::size_t i = 0; i < byteCount; ++i)
+		{
+			hashValue += hashPrime * data[i];
+		}
+
+		return hashValue;
+	}
+
+	/// <summary>
+	/// Counts the number of duplicate values in a list of hash codes.
+	/// </summary>
+	inline std::size_t CountCollisions(std::vector<std::size_t> hashCodes)
+	{
+		std::sort(hashCodes.begin(), hashCodes.end());
+		const auto last = std::unique(hashCodes.begin(), hashCodes.end());
+		return static_cast<std::size_t>(std::distance(last, hashCodes.end()));
+	}
+
+	/// <summary>
+	/// Computes the chi-squared statistic of hash codes reduced to a power of two bucket count by masking the low bits.
+	/// </summary>
+	inline double ChiSquared(const std::vector<std::size_t>& hashCodes, const std::size_t bucketCount)
+	{
+		std::vector<std::size_t> buckets(bucketCount, 0);
+
+		for (const std::size_t hashCode : hashCodes)
+		{
+			++buckets[hashCode & (bucketCount - 1)];
+		}
+
+		const double expected = static_cast<double>(hashCodes.size()) / bucketCount;
+		double chiSquared = 0.0;
+
+		for (const std::size_t count : buckets)
+		{
+			const double difference = count - expected;
+			chiSquared += difference * difference / expected;
+		}
+
+		return chiSquared;
+	}
+}
+
 
 namespace UtilityTests
 {
@@ -219,6 +272,183 @@ namespace UtilityTests
 			}
 		}
 
+		TEST_METHOD(PointerHash)
+		{
+			DefaultHash<Foo*> hash;
+
+			Foo a(10);
+			Foo b(10);
+			Foo* c = &a;
+
+			Assert::AreEqual(hash(&a), hash(&a));
+			Assert::IsTrue(hash(&a) != hash(&b));
+			Assert::AreEqual(hash(&a), hash(c));
+
+			DefaultHash<Foo* const> constHash;
+			Assert::AreEqual(hash(&a), constHash(&a));
+		}
+
+		TEST_METHOD(ReferenceHash)
+		{
+			DefaultHash<const std::string&> hash;
+			DefaultHash<std::string> valueHash;
+
+			const std::string a = "Hello"s;
+			const std::string b = "Hello"s;
+
+			Assert::AreEqual(valueHash(a), hash(a));
+			Assert::AreEqual(hash(a), hash(b));
+			Assert::IsTrue(hash(a) != hash("Goodbye"s));
+		}
+
+		TEST_METHOD(CompileTimeHash)
+		{
+			static_assert("Hello"_hash == Hash::StringHash("Hello"));
+			static_assert(""_hash != "Hello"_hash);
+
+			DefaultHash<std::string> hash;
+
+			Assert::AreEqual(hash(""s), ""_hash);
+			Assert::AreEqual(hash("Hello"s), "Hello"_hash);
+			Assert::AreEqual(hash("Attributed"s), "Attributed"_hash);
+			Assert::AreEqual(hash("A much longer string literal that spans several blocks of the hash function"s),
+				"A much longer string literal that spans several blocks of the hash function"_hash);
+
+			DefaultHash<const char*> characterHash;
+			Assert::AreEqual(characterHash("Hello"), Hash::StringHash("Hello"));
+
+			for (std::size_t length = 0; length < 128; ++length)
+			{
+				const std::string key(length, 'x');
+				Assert::AreEqual(static_cast<std::size_t>(ByteHash(key.c_str(), length)), hash(key));
+			}
+		}
+
+		TEST_METHOD(Permutations)
+		{
+			DefaultHash<std::string> hash;
+
+			Assert::IsTrue(hash("ab"s) != hash("ba"s));
+			Assert::IsTrue(hash("Health"s) != hash("Htlaeh"s));
+			Assert::IsTrue(hash("abc"s) != hash("abc\0"s));
+			Assert::IsTrue(hash(""s) != hash("\0"s));
+
+			const std::uint8_t forward[] = { 'a', 'b', 'c', 'd' };
+			const std::uint8_t reverse[] = { 'd', 'c', 'b', 'a' };
+
+			Assert::AreEqual(AdditiveHash(forward, 4), AdditiveHash(reverse, 4));
+			Assert::IsTrue(ByteHash(forward, 4) != ByteHash(reverse, 4));
+			Assert::IsTrue(ByteHash(forward, 4, 0) != ByteHash(forward, 4, 1));
+		}
+
+		TEST_METHOD(Collisions)
+		{
+			const std::size_t keyCount = 100000;
+
+			{
+				DefaultHash<std::string> hash;
+				std::vector<std::size_t> hashCodes;
+				hashCodes.reserve(keyCount);
+
+				for (std::size_t i = 0; i < keyCount; ++i)
+				{
+					hashCodes.push_back(hash("Attribute"s + std::to_string(i)));
+				}
+
+				Assert::AreEqual(0_z, CountCollisions(hashCodes));
+			}
+
+			{
+				DefaultHash<int> hash;
+				std::vector<std::size_t> hashCodes;
+				hashCodes.reserve(keyCount);
+
+				for (int i = 0; i < static_cast<int>(keyCount); ++i)
+				{
+					hashCodes.push_back(hash(i));
+				}
+
+				Assert::AreEqual(0_z, CountCollisions(hashCodes));
+			}
+		}
+
+		TEST_METHOD(Distribution)
+		{
+			const std::size_t keyCount = 100000;
+			const std::size_t bucketCount = 1024;
+
+			// Critical value of the chi-squared distribution with 1023 degrees of freedom at p = 0.001.
+			const double criticalValue = 1168.0;
+
+			std::vector<std::size_t> stringHashCodes;
+			std::vector<std::size_t> integerHashCodes;
+			std::vector<std::size_t> strideHashCodes;
+
+			DefaultHash<std::string> stringHash;
+			DefaultHash<int> integerHash;
+
+			for (std::size_t i = 0; i < keyCount; ++i)
+			{
+				stringHashCodes.push_back(stringHash("Entity"s + std::to_string(i)));
+				integerHashCodes.push_back(integerHash(static_cast<int>(i)));
+				strideHashCodes.push_back(integerHash(static_cast<int>(i * bucketCount)));
+			}
+
+			Assert::IsTrue(ChiSquared(stringHashCodes, bucketCount) < criticalValue);
+			Assert::IsTrue(ChiSquared(integerHashCodes, bucketCount) < criticalValue);
+			Assert::IsTrue(ChiSquared(strideHashCodes, bucketCount) < criticalValue);
+		}
+
+		TEST_METHOD(Benchmark)
+		{
+			const std::size_t keySizes[] = { 8, 32, 256, 4096 };
+			const std::size_t totalBytes = 1 << 24;
+
+			std::mt19937 generator(0);
+			std::uniform_int_distribution<int> distribution(0, 255);
+
+			std::vector<std::uint8_t> buffer(totalBytes);
+			for (std::uint8_t& byte : buffer)
+			{
+				byte = static_cast<std::uint8_t>(distribution(generator));
+			}
+
+			StopWatch stopWatch;
+			std::stringstream results;
+			results << "DefaultHash Benchmark (MB/s, " << (totalBytes >> 20) << " MB per key size)" << std::endl;
+
+			for (const std::size_t keySize : keySizes)
+			{
+				const std::size_t keyCount = totalBytes / keySize;
+				std::size_t sink = 0;
+
+				stopWatch.Start();
+				for (std::size_t i = 0; i < keyCount; ++i)
+				{
+					sink += AdditiveHash(&buffer[i * keySize], keySize);
+				}
+				stopWatch.Stop();
+				const auto additiveTime = std::max<long long>(stopWatch.Elapsed().count(), 1);
+				stopWatch.Reset();
+
+				stopWatch.Start();
+				for (std::size_t i = 0; i < keyCount; ++i)
+				{
+					sink += static_cast<std::size_t>(ByteHash(&buffer[i * keySize], keySize));
+				}
+				stopWatch.Stop();
+				const auto byteTime = std::max<long long>(stopWatch.Elapsed().count(), 1);
+				stopWatch.Reset();
+
+				Assert::IsTrue(sink != 0);
+
+				results << "  " << keySize << " byte keys: AdditiveHash " << totalBytes / additiveTime
+					<< ", ByteHash " << totalBytes / byteTime << std::endl;
+			}
+
+			Logger::WriteMessage(results.str().c_str());
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
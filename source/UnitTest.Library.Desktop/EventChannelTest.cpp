@@ -0,0 +1,370 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "EventChannel.h"
+#include "Event.h"
+#include "IEventSubscriber.h"
+#include "EventQueue.h"
+#include "GameTime.h"
+#include "StopWatch.h"
+
+using namespace std::string_literals;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+
+namespace EventTests
+{
+	struct TestHitMessage final
+	{
+		int Target{ 0 };
+		float Damage{ 0.0f };
+	};
+
+	class TestHitSubscriber final : public IEventChannelSubscriber<TestHitMessage>
+	{
+	public:
+		virtual void Notify(gsl::span<const TestHitMessage> messages) override
+		{
+			++batchCount;
+
+			for (const auto& message : messages)
+			{
+				targets.PushBack(message.Target);
+				totalDamage += message.Damage;
+			}
+
+			if (channel)
+			{
+				channel->Publish(TestHitMessage{ -1, 0.0f });
+				channel = nullptr;
+			}
+
+			if (isThrowing)
+			{
+				throw std::runtime_error("Test exception.");
+			}
+		}
+
+	public:
+		std::size_t batchCount{ 0 };
+		Vector<int> targets;
+		float totalDamage{ 0.0f };
+		EventChannel<TestHitMessage>* channel{ nullptr };
+		bool isThrowing{ false };
+	};
+
+	class TestHitCounter final : public IEventChannelSubscriber<TestHitMessage>
+	{
+	public:
+		virtual void Notify(gsl::span<const TestHitMessage> messages) override
+		{
+			count += messages.size();
+		}
+
+	public:
+		std::size_t count{ 0 };
+	};
+
+	class TestHitEventSubscriber final : public IEventSubscriber
+	{
+	public:
+		virtual void Notify(EventPublisher& eventPublisher) override
+		{
+			damage += static_cast<Event<TestHitMessage>&>(eventPublisher).Message.Damage;
+			++count;
+		}
+
+	public:
+		float damage{ 0.0f };
+		std::size_t count{ 0 };
+	};
+
+	TEST_CLASS(EventChannelTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			Event<TestHitMessage>::UnsubscribeAll();
+			Event<TestHitMessage>::SubscriberShrinkToFit();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(PublishAndFlush)
+		{
+			EventChannel<TestHitMessage> channel;
+			Assert::IsTrue(channel.IsEmpty());
+			Assert::AreEqual(0_z, channel.SubscriberCount());
+
+			TestHitSubscriber subscriber1;
+			TestHitSubscriber subscriber2;
+			channel.Subscribe(subscriber1);
+			channel.Subscribe(subscriber2);
+			Assert::AreEqual(2_z, channel.SubscriberCount());
+
+			Assert::ExpectException<std::runtime_error>([&channel, &subscriber1]
+			{
+				channel.Subscribe(subscriber1);
+			});
+
+			const TestHitMessage hit{ 1, 10.0f };
+			channel.Publish(hit);
+			channel.Publish(TestHitMessage{ 2, 20.0f });
+			channel.Emplace(TestHitMessage{ 3, 30.0f });
+
+			const TestHitMessage hits[] = { { 4, 40.0f }, { 5, 50.0f } };
+			channel.Publish(gsl::span<const TestHitMessage>(hits));
+
+			Assert::AreEqual(5_z, channel.Size());
+			Assert::IsFalse(channel.IsEmpty());
+			Assert::AreEqual(0_z, subscriber1.batchCount);
+
+			channel.Flush();
+			Assert::IsTrue(channel.IsEmpty());
+
+			for (const auto* subscriber : { &subscriber1, &subscriber2 })
+			{
+				Assert::AreEqual(1_z, subscriber->batchCount);
+				Assert::AreEqual(5_z, subscriber->targets.Size());
+				Assert::AreEqual(150.0f, subscriber->totalDamage);
+
+				for (int i = 0; i < 5; ++i)
+				{
+					Assert::AreEqual(i + 1, subscriber->targets[i]);
+				}
+			}
+
+			channel.Flush();
+			Assert::AreEqual(1_z, subscriber1.batchCount);
+
+			channel.Unsubscribe(subscriber2);
+			Assert::AreEqual(1_z, channel.SubscriberCount());
+
+			channel.Publish(hit);
+			channel.Flush();
+			Assert::AreEqual(2_z, subscriber1.batchCount);
+			Assert::AreEqual(1_z, subscriber2.batchCount);
+
+			channel.Publish(hit);
+			channel.Clear();
+			channel.Flush();
+			Assert::AreEqual(2_z, subscriber1.batchCount);
+
+			channel.UnsubscribeAll();
+			Assert::AreEqual(0_z, channel.SubscriberCount());
+
+			channel.ShrinkToFit();
+			Assert::AreEqual(0_z, channel.Capacity());
+		}
+
+		TEST_METHOD(PublishInFlush)
+		{
+			EventChannel<TestHitMessage> channel;
+
+			TestHitSubscriber subscriber;
+			subscriber.channel = &channel;
+			channel.Subscribe(subscriber);
+
+			channel.Publish(TestHitMessage{ 1, 10.0f });
+			channel.Flush();
+
+			Assert::AreEqual(1_z, subscriber.targets.Size());
+			Assert::AreEqual(1_z, channel.Size());
+
+			channel.Flush();
+			Assert::AreEqual(2_z, subscriber.targets.Size());
+			Assert::AreEqual(-1, subscriber.targets.Back());
+			Assert::IsTrue(channel.IsEmpty());
+		}
+
+		TEST_METHOD(ExceptionInFlush)
+		{
+			EventChannel<TestHitMessage> channel;
+
+			TestHitSubscriber subscriber;
+			subscriber.isThrowing = true;
+			channel.Subscribe(subscriber);
+
+			channel.Publish(TestHitMessage{ 1, 10.0f });
+
+			Assert::ExpectException<std::runtime_error>([&channel]
+			{
+				channel.Flush();
+			});
+
+			subscriber.isThrowing = false;
+			channel.Publish(TestHitMessage{ 2, 20.0f });
+			channel.Flush();
+
+			Assert::AreEqual(2_z, subscriber.batchCount);
+			Assert::AreEqual(2, subscriber.targets.Back());
+			Assert::AreEqual(30.0f, subscriber.totalDamage);
+		}
+
+		TEST_METHOD(ConcurrentPublish)
+		{
+			const std::size_t producerCount = 8;
+			const std::size_t messagesPerProducer = 10000;
+
+			EventChannel<TestHitMessage> channel;
+
+			TestHitCounter subscriber;
+			channel.Subscribe(subscriber);
+
+			std::atomic<std::size_t> finishedCount{ 0 };
+
+			Vector<std::thread> producers{ Vector<std::thread>::EqualityFunctor() };
+			producers.Reserve(producerCount);
+
+			for (std::size_t i = 0; i < producerCount; ++i)
+			{
+				producers.EmplaceBack([&channel, &finishedCount, i, messagesPerProducer]
+				{
+					for (std::size_t j = 0; j < messagesPerProducer; ++j)
+					{
+						channel.Emplace(TestHitMessage{ static_cast<int>(i), 1.0f });
+					}
+
+					++finishedCount;
+				});
+			}
+
+			while (finishedCount < producerCount)
+			{
+				channel.Flush();
+			}
+
+			for (auto& producer : producers)
+			{
+				producer.join();
+			}
+
+			channel.Flush();
+
+			Assert::AreEqual(producerCount * messagesPerProducer, subscriber.count);
+			Assert::IsTrue(channel.IsEmpty());
+		}
+
+		TEST_METHOD(SteadyStateAllocations)
+		{
+			EventChannel<TestHitMessage> channel;
+
+			TestHitCounter subscriber;
+			channel.Subscribe(subscriber);
+
+			const std::size_t messagesPerFrame = 1000;
+
+			for (std::size_t frame = 0; frame < 2; ++frame)
+			{
+				for (std::size_t i = 0; i < messagesPerFrame; ++i)
+				{
+					channel.Emplace(TestHitMessage{ static_cast<int>(i), 1.0f });
+				}
+
+				channel.Flush();
+			}
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState startMemState, endMemState, diffMemState;
+			_CrtMemCheckpoint(&startMemState);
+#endif
+
+			for (std::size_t frame = 0; frame < 100; ++frame)
+			{
+				for (std::size_t i = 0; i < messagesPerFrame; ++i)
+				{
+					channel.Emplace(TestHitMessage{ static_cast<int>(i), 1.0f });
+				}
+
+				channel.Flush();
+			}
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemCheckpoint(&endMemState);
+			_CrtMemDifference(&diffMemState, &startMemState, &endMemState);
+			Assert::AreEqual(0_z, diffMemState.lTotalCount);
+#endif
+
+			Assert::AreEqual(102 * messagesPerFrame, subscriber.count);
+		}
+
+		TEST_METHOD(Benchmark)
+		{
+			const std::size_t messagesPerFrame = 10000;
+			const std::size_t frames = 20;
+
+			const GameTime gameTime;
+			StopWatch stopWatch;
+
+			EventQueue eventQueue;
+			TestHitEventSubscriber eventSubscriber;
+			Event<TestHitMessage>::Subscribe(eventSubscriber);
+
+			stopWatch.Start();
+
+			for (std::size_t frame = 0; frame < frames; ++frame)
+			{
+				for (std::size_t i = 0; i < messagesPerFrame; ++i)
+				{
+					eventQueue.Enqueue(std::make_shared<Event<TestHitMessage>>(TestHitMessage{ static_cast<int>(i), 1.0f }));
+				}
+
+				eventQueue.Update(gameTime);
+			}
+
+			stopWatch.Stop();
+			const auto queueElapsed = stopWatch.Elapsed();
+
+			eventQueue.ShrinkToFit();
+
+			EventChannel<TestHitMessage> channel;
+			TestHitCounter channelSubscriber;
+			channel.Subscribe(channelSubscriber);
+
+			stopWatch.Start();
+
+			for (std::size_t frame = 0; frame < frames; ++frame)
+			{
+				for (std::size_t i = 0; i < messagesPerFrame; ++i)
+				{
+					channel.Emplace(TestHitMessage{ static_cast<int>(i), 1.0f });
+				}
+
+				channel.Flush();
+			}
+
+			stopWatch.Stop();
+			const auto channelElapsed = stopWatch.Elapsed();
+
+			Assert::AreEqual(frames * messagesPerFrame, eventSubscriber.count);
+			Assert::AreEqual(frames * messagesPerFrame, channelSubscriber.count);
+
+			std::stringstream message;
+			message << "EventQueue " << messagesPerFrame << " messages: "
+				<< (static_cast<double>(queueElapsed.count()) / frames) << " us/frame, EventChannel: "
+				<< (static_cast<double>(channelElapsed.count()) / frames) << " us/frame";
+			Logger::WriteMessage(message.str().c_str());
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState EventChannelTest::sStartMemState;
+}
\ No newline at end of file
@@ -0,0 +1,301 @@
+#include "pch.h"
+
+#include <json/json.h>
+
+#include "ToStringSpecialization.h"
+#include "Event.h"
+#include "IEventSubscriber.h"
+#include "EventQueue.h"
+#include "EventInstrumentation.h"
+#include "JobSystem.h"
+
+using namespace std::string_literals;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+
+namespace EventTests
+{
+	class InstrumentationCountingSubscriber final : public IEventSubscriber
+	{
+	public:
+		virtual void Notify(EventPublisher&) override
+		{
+			count.fetch_add(1, std::memory_order_relaxed);
+		}
+
+	public:
+		std::atomic<std::size_t> count{ 0 };
+	};
+
+	class InstrumentationExceptionSubscriber final : public IEventSubscriber
+	{
+	public:
+		virtual void Notify(EventPublisher&) override
+		{
+			throw std::runtime_error("Test exception.");
+		}
+	};
+
+	TEST_CLASS(EventInstrumentationTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			EventInstrumentation::SetEnabled(false);
+			EventInstrumentation::SetTracing(false);
+			EventInstrumentation::Reset();
+
+			Event<Foo>::UnsubscribeAll();
+			Event<Foo>::SubscriberShrinkToFit();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(HistogramBuckets)
+		{
+			using Histogram = EventInstrumentation::Histogram;
+
+			for (std::uint64_t value = 0; value < Histogram::SubBucketCount; ++value)
+			{
+				Assert::AreEqual(static_cast<std::size_t>(value), Histogram::BucketIndex(value));
+				Assert::AreEqual(value, Histogram::BucketValue(Histogram::BucketIndex(value)));
+			}
+
+			std::size_t previousIndex = 0;
+
+			for (std::uint64_t value = Histogram::SubBucketCount; value < 100000; value += value / 16 + 1)
+			{
+				const std::size_t index = Histogram::BucketIndex(value);
+				const std::uint64_t bucketValue = Histogram::BucketValue(index);
+
+				Assert::IsTrue(index >= previousIndex);
+				Assert::IsTrue(bucketValue >= value);
+				Assert::IsTrue(bucketValue - value <= value / Histogram::SubBucketCount);
+				Assert::AreEqual(index, Histogram::BucketIndex(bucketValue));
+				Assert::AreEqual(index + 1, Histogram::BucketIndex(bucketValue + 1));
+
+				previousIndex = index;
+			}
+
+			Assert::AreEqual(Histogram::BucketCount - 1, Histogram::BucketIndex(std::numeric_limits<std::uint64_t>::max()));
+			Assert::AreEqual(std::numeric_limits<std::uint64_t>::max(), Histogram::BucketValue(Histogram::BucketCount - 1));
+		}
+
+		TEST_METHOD(HistogramStatistics)
+		{
+			EventInstrumentation::Histogram histogram;
+			Assert::AreEqual(std::uint64_t(0), histogram.TotalCount());
+			Assert::AreEqual(std::uint64_t(0), histogram.Min());
+			Assert::AreEqual(std::uint64_t(0), histogram.ValueAtPercentile(50.0));
+			Assert::AreEqual(0.0, histogram.Mean());
+
+			for (std::uint64_t value = 1; value <= 1000; ++value)
+			{
+				histogram.Record(value);
+			}
+
+			Assert::AreEqual(std::uint64_t(1000), histogram.TotalCount());
+			Assert::AreEqual(std::uint64_t(500500), histogram.Sum());
+			Assert::AreEqual(std::uint64_t(1), histogram.Min());
+			Assert::AreEqual(std::uint64_t(1000), histogram.Max());
+			Assert::AreEqual(500.5, histogram.Mean());
+			Assert::AreEqual(std::uint64_t(1), histogram.ValueAtPercentile(0.0));
+			Assert::AreEqual(std::uint64_t(1000), histogram.ValueAtPercentile(100.0));
+
+			const std::uint64_t median = histogram.ValueAtPercentile(50.0);
+			Assert::IsTrue(median >= 500 && median <= 500 + 500 / EventInstrumentation::Histogram::SubBucketCount);
+
+			EventInstrumentation::Histogram other;
+			other.Record(5000);
+			histogram.Merge(other);
+
+			Assert::AreEqual(std::uint64_t(1001), histogram.TotalCount());
+			Assert::AreEqual(std::uint64_t(505500), histogram.Sum());
+			Assert::AreEqual(std::uint64_t(5000), histogram.Max());
+			Assert::AreEqual(std::uint64_t(5000), histogram.ValueAtPercentile(100.0));
+		}
+
+#ifdef EVENT_INSTRUMENTATION
+		TEST_METHOD(Counts)
+		{
+			InstrumentationCountingSubscriber subscriber1;
+			InstrumentationCountingSubscriber subscriber2;
+			Event<Foo>::Subscribe(subscriber1);
+			Event<Foo>::Subscribe(subscriber2);
+
+			EventQueue queue;
+			const GameTime gameTime;
+
+			queue.Enqueue(std::make_shared<Event<Foo>>(Foo(10)));
+			queue.Update(gameTime);
+			Assert::IsTrue(EventInstrumentation::Report().IsEmpty());
+
+			EventInstrumentation::SetEnabled(true);
+			Assert::IsTrue(EventInstrumentation::IsEnabled());
+
+			for (int i = 0; i < 10; ++i)
+			{
+				queue.Enqueue(std::make_shared<Event<Foo>>(Foo(i)));
+			}
+
+			queue.Update(gameTime);
+
+			Event<Foo> event(Foo(20));
+			EventQueue::Publish(event);
+
+			const auto reports = EventInstrumentation::Report();
+			Assert::AreEqual(1_z, reports.Size());
+
+			const auto& report = reports.Front();
+			Assert::AreEqual(Event<Foo>::TypeIdClass(), report.TypeId);
+			Assert::AreEqual(std::uint64_t(10), report.EnqueueCount);
+			Assert::AreEqual(std::uint64_t(11), report.PublishCount);
+			Assert::AreEqual(std::uint64_t(22), report.NotifyCount);
+			Assert::AreEqual(std::uint64_t(10), report.DwellTime.TotalCount());
+			Assert::AreEqual(std::uint64_t(22), report.HandlerTime.TotalCount());
+			Assert::AreEqual(12_z, subscriber1.count.load());
+
+			Assert::AreEqual("Event "s + std::to_string(Event<Foo>::TypeIdClass()), report.Name);
+			EventInstrumentation::SetTypeName<Event<Foo>>("Foo"s);
+			Assert::AreEqual("Foo"s, EventInstrumentation::Report().Front().Name);
+
+			EventInstrumentation::Reset();
+			Assert::IsTrue(EventInstrumentation::Report().IsEmpty());
+		}
+
+		TEST_METHOD(ParallelCounts)
+		{
+			JobSystem jobSystem(4);
+
+			EventQueue queue;
+			queue.SetJobSystem(&jobSystem);
+
+			Vector<InstrumentationCountingSubscriber> subscribers{ Vector<InstrumentationCountingSubscriber>::EqualityFunctor() };
+			subscribers.Resize(500);
+
+			for (auto& subscriber : subscribers)
+			{
+				Event<Foo>::Subscribe(subscriber);
+			}
+
+			InstrumentationExceptionSubscriber exceptionSubscriber;
+			Event<Foo>::Subscribe(exceptionSubscriber);
+
+			EventInstrumentation::SetEnabled(true);
+
+			const GameTime gameTime;
+
+			for (int i = 0; i < 4; ++i)
+			{
+				queue.Enqueue(std::make_shared<Event<Foo>>(Foo(i)));
+			}
+
+			Assert::ExpectException<Exception::AggregateException>([&queue, &gameTime]
+			{
+				queue.Update(gameTime);
+			});
+
+			const auto reports = EventInstrumentation::Report();
+			Assert::AreEqual(1_z, reports.Size());
+			Assert::AreEqual(std::uint64_t(4), reports.Front().PublishCount);
+			Assert::AreEqual(std::uint64_t(4 * 501), reports.Front().NotifyCount);
+			Assert::AreEqual(std::uint64_t(4 * 501), reports.Front().HandlerTime.TotalCount());
+
+			queue.SetJobSystem(nullptr);
+		}
+
+		TEST_METHOD(ChromeTrace)
+		{
+			InstrumentationCountingSubscriber subscriber;
+			Event<Foo>::Subscribe(subscriber);
+
+			EventInstrumentation::SetEnabled(true);
+			EventInstrumentation::SetTracing(true);
+			EventInstrumentation::SetTypeName<Event<Foo>>("Foo \"Event\"\n"s);
+
+			EventQueue queue;
+			const GameTime gameTime;
+
+			for (int i = 0; i < 3; ++i)
+			{
+				queue.Enqueue(std::make_shared<Event<Foo>>(Foo(i)));
+			}
+
+			queue.Update(gameTime);
+
+			std::stringstream stream;
+			EventInstrumentation::WriteChromeTrace(stream);
+
+			Json::Value root;
+			stream >> root;
+
+			const Json::Value& traceEvents = root["traceEvents"];
+			Assert::IsTrue(traceEvents.isArray());
+			Assert::AreEqual(6u, traceEvents.size());
+
+			std::size_t queuedCount = 0;
+			std::size_t notifyCount = 0;
+
+			for (const auto& traceEvent : traceEvents)
+			{
+				Assert::IsTrue(traceEvent["name"] == "Foo \"Event\"\n");
+				Assert::IsTrue(traceEvent["ph"] == "X");
+				Assert::IsTrue(traceEvent["ts"].asDouble() >= 0.0);
+				Assert::IsTrue(traceEvent["dur"].asDouble() >= 0.0);
+
+				if (traceEvent["cat"] == "Queued") ++queuedCount;
+				if (traceEvent["cat"] == "Notify") ++notifyCount;
+			}
+
+			Assert::AreEqual(3_z, queuedCount);
+			Assert::AreEqual(3_z, notifyCount);
+			Assert::AreEqual(0_z, EventInstrumentation::DroppedTraceCount());
+
+			Assert::ExpectException<std::runtime_error>([]
+			{
+				EventInstrumentation::SaveChromeTrace("");
+			});
+		}
+
+		TEST_METHOD(TraceCapacity)
+		{
+			InstrumentationCountingSubscriber subscriber;
+			Event<Foo>::Subscribe(subscriber);
+
+			EventInstrumentation::SetEnabled(true);
+			EventInstrumentation::SetTracing(true);
+
+			Event<Foo> event(Foo(10));
+
+			for (std::size_t i = 0; i < EventInstrumentation::TraceCapacity + 10; ++i)
+			{
+				EventQueue::Publish(event);
+			}
+
+			Assert::AreEqual(10_z, EventInstrumentation::DroppedTraceCount());
+			Assert::AreEqual(std::uint64_t(EventInstrumentation::TraceCapacity + 10), EventInstrumentation::Report().Front().NotifyCount);
+		}
+#endif
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState EventInstrumentationTest::sStartMemState;
+}
\ No newline at end of file
@@ -0,0 +1,349 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "EventJournal.h"
+#include "EventReplay.h"
+#include "EventQueue.h"
+#include "IEventSubscriber.h"
+#include "GameTime.h"
+#include "StreamHelper.h"
+
+using namespace std::string_literals;
+using namespace std::chrono_literals;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+
+namespace EventTests
+{
+	struct TestDamageMessage final
+	{
+		std::int32_t Target{ 0 };
+		float Damage{ 0.0f };
+		std::string Source;
+	};
+
+	struct TestUnjournaledMessage final
+	{
+		std::int32_t Value{ 0 };
+	};
+
+	void WriteDamage(OutputStreamHelper& helper, const TestDamageMessage& message)
+	{
+		helper << message.Target << message.Damage << message.Source;
+	}
+
+	TestDamageMessage ReadDamage(InputStreamHelper& helper)
+	{
+		TestDamageMessage message;
+		helper >> message.Target >> message.Damage >> message.Source;
+		return message;
+	}
+
+	class TestDamageRecorder final : public IEventSubscriber
+	{
+	public:
+		virtual void Notify(EventPublisher& eventPublisher) override
+		{
+			const TestDamageMessage& message = static_cast<Event<TestDamageMessage>&>(eventPublisher).Message;
+
+			std::stringstream entry;
+			entry << frame << ":" << message.Target << ":" << message.Damage << ":" << message.Source;
+			deliveries.PushBack(entry.str());
+		}
+
+	public:
+		std::size_t frame{ 0 };
+		Vector<std::string> deliveries;
+	};
+
+	TEST_CLASS(EventJournalTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			Event<TestDamageMessage>::UnsubscribeAll();
+			Event<TestDamageMessage>::SubscriberShrinkToFit();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(RecordAndReplay)
+		{
+			std::stringstream stream;
+			TestDamageRecorder recorder;
+			Event<TestDamageMessage>::Subscribe(recorder);
+
+			Vector<std::chrono::milliseconds> frameTimes;
+
+			{
+				EventJournal journal(stream);
+				journal.Register<TestDamageMessage>("Damage"s, WriteDamage);
+
+				Assert::ExpectException<std::runtime_error>([&journal]
+				{
+					journal.Register<TestDamageMessage>("Damage"s, WriteDamage);
+				});
+
+				EventQueue eventQueue;
+				eventQueue.SetJournal(&journal);
+				Assert::IsTrue(eventQueue.GetJournal() == &journal);
+
+				GameTime gameTime;
+				gameTime.SetCurrentTime(std::chrono::high_resolution_clock::time_point(1000ms));
+				RecordFrames(eventQueue, gameTime, recorder, frameTimes);
+
+				journal.Flush();
+				Assert::AreEqual(10_z, journal.EnqueueCount());
+				Assert::AreEqual(1_z, journal.UnregisteredCount());
+				Assert::AreEqual(0_z, journal.OverflowCount());
+			}
+
+			Vector<std::string> recorded(std::move(recorder.deliveries));
+			Assert::AreEqual(10_z, recorded.Size());
+
+			EventReplay replay(stream);
+			replay.Register<TestDamageMessage>("Damage"s, ReadDamage);
+
+			Assert::ExpectException<std::runtime_error>([&replay]
+			{
+				replay.Register<TestDamageMessage>("Damage"s, ReadDamage);
+			});
+
+			EventQueue eventQueue;
+			GameTime gameTime;
+			std::size_t frame = 0;
+			recorder.frame = 0;
+
+			while (replay.Step(eventQueue, gameTime))
+			{
+				Assert::AreEqual(frameTimes[frame].count(), gameTime.TotalGameTime().count());
+				recorder.frame = ++frame;
+			}
+
+			Assert::AreEqual(frameTimes.Size(), replay.FrameCount());
+			Assert::AreEqual(10_z, replay.EventCount());
+			Assert::AreEqual(0_z, replay.SkippedCount());
+			Assert::IsTrue(eventQueue.IsEmpty());
+
+			Assert::AreEqual(recorded.Size(), recorder.deliveries.Size());
+
+			for (std::size_t i = 0; i < recorded.Size(); ++i)
+			{
+				Assert::AreEqual(recorded[i], recorder.deliveries[i]);
+			}
+
+			Assert::IsFalse(replay.Step(eventQueue, gameTime));
+		}
+
+		TEST_METHOD(RingOverflow)
+		{
+			std::stringstream stream;
+			TestDamageRecorder recorder;
+			Event<TestDamageMessage>::Subscribe(recorder);
+
+			Vector<std::chrono::milliseconds> frameTimes;
+
+			{
+				EventJournal journal(stream, 64);
+				journal.Register<TestDamageMessage>("Damage"s, WriteDamage);
+
+				EventQueue eventQueue;
+				eventQueue.SetJournal(&journal);
+
+				eventQueue.Enqueue(std::make_shared<Event<TestDamageMessage>>(TestDamageMessage{ -1, 0.0f, std::string(128, 'x') }));
+
+				GameTime gameTime;
+				RecordFrames(eventQueue, gameTime, recorder, frameTimes);
+
+				Assert::AreEqual(11_z, journal.EnqueueCount());
+				Assert::IsTrue(journal.OverflowCount() > 0);
+			}
+
+			Vector<std::string> recorded(std::move(recorder.deliveries));
+
+			EventReplay replay(stream);
+			replay.Register<TestDamageMessage>("Damage"s, ReadDamage);
+
+			EventQueue eventQueue;
+			GameTime gameTime;
+			recorder.frame = 0;
+
+			while (replay.Step(eventQueue, gameTime))
+			{
+				++recorder.frame;
+			}
+
+			Assert::AreEqual(frameTimes.Size(), replay.FrameCount());
+			Assert::AreEqual(recorded.Size(), recorder.deliveries.Size());
+
+			for (std::size_t i = 0; i < recorded.Size(); ++i)
+			{
+				Assert::AreEqual(recorded[i], recorder.deliveries[i]);
+			}
+		}
+
+		TEST_METHOD(ConcurrentRecording)
+		{
+			const std::size_t producerCount = 4;
+			const std::size_t eventsPerProducer = 2000;
+
+			std::stringstream stream;
+
+			{
+				EventJournal journal(stream, 256);
+				journal.Register<TestDamageMessage>("Damage"s, WriteDamage);
+
+				EventQueue eventQueue;
+				eventQueue.SetJournal(&journal);
+
+				Vector<std::thread> producers{ Vector<std::thread>::EqualityFunctor() };
+				producers.Reserve(producerCount);
+
+				for (std::size_t i = 0; i < producerCount; ++i)
+				{
+					producers.EmplaceBack([&eventQueue, i, eventsPerProducer]
+					{
+						for (std::size_t j = 0; j < eventsPerProducer; ++j)
+						{
+							eventQueue.Enqueue(std::make_shared<Event<TestDamageMessage>>(TestDamageMessage{ static_cast<std::int32_t>(i), 1.0f, "Producer"s }));
+						}
+					});
+				}
+
+				for (auto& producer : producers)
+				{
+					producer.join();
+				}
+
+				eventQueue.Update(GameTime());
+				journal.Flush();
+
+				Assert::AreEqual(producerCount * eventsPerProducer, journal.EnqueueCount());
+			}
+
+			EventReplay replay(stream);
+			replay.Register<TestDamageMessage>("Damage"s, ReadDamage);
+
+			EventQueue eventQueue;
+			GameTime gameTime;
+
+			Assert::AreEqual(1_z, replay.Run(eventQueue, gameTime));
+			Assert::AreEqual(producerCount * eventsPerProducer, replay.EventCount());
+		}
+
+		TEST_METHOD(UnregisteredReplay)
+		{
+			std::stringstream stream;
+
+			{
+				EventJournal journal(stream);
+				journal.Register<TestDamageMessage>("Damage"s, WriteDamage);
+
+				EventQueue eventQueue;
+				eventQueue.SetJournal(&journal);
+				eventQueue.Enqueue(std::make_shared<Event<TestDamageMessage>>(TestDamageMessage{ 1, 1.0f, "Skipped"s }));
+				eventQueue.Update(GameTime());
+			}
+
+			EventReplay replay(stream);
+			EventQueue eventQueue;
+			GameTime gameTime;
+
+			Assert::AreEqual(1_z, replay.Run(eventQueue, gameTime));
+			Assert::AreEqual(0_z, replay.EventCount());
+			Assert::AreEqual(1_z, replay.SkippedCount());
+		}
+
+		TEST_METHOD(InvalidJournal)
+		{
+			std::stringstream empty;
+
+			Assert::ExpectException<std::runtime_error>([&empty]
+			{
+				EventReplay replay(empty);
+			});
+
+			std::stringstream badMagic;
+			OutputStreamHelper badMagicHelper(badMagic);
+			badMagicHelper << std::uint32_t(0) << EventJournal::Version;
+
+			Assert::ExpectException<std::runtime_error>([&badMagic]
+			{
+				EventReplay replay(badMagic);
+			});
+
+			std::stringstream badVersion;
+			OutputStreamHelper badVersionHelper(badVersion);
+			badVersionHelper << EventJournal::Magic << (EventJournal::Version + 1);
+
+			Assert::ExpectException<std::runtime_error>([&badVersion]
+			{
+				EventReplay replay(badVersion);
+			});
+
+			std::stringstream truncated;
+			OutputStreamHelper truncatedHelper(truncated);
+			truncatedHelper << EventJournal::Magic << EventJournal::Version << static_cast<std::uint32_t>(EventJournal::RecordType::Update) << std::int64_t(0);
+
+			EventReplay replay(truncated);
+			EventQueue eventQueue;
+			GameTime gameTime;
+
+			Assert::ExpectException<std::runtime_error>([&replay, &eventQueue, &gameTime]
+			{
+				replay.Step(eventQueue, gameTime);
+			});
+		}
+
+	private:
+		/// <summary>
+		/// Enqueues Event instances with different delays over several frames, advancing the GameTime by a fixed step.
+		/// </summary>
+		static void RecordFrames(EventQueue& eventQueue, GameTime& gameTime, TestDamageRecorder& recorder, Vector<std::chrono::milliseconds>& frameTimes)
+		{
+			for (std::size_t frame = 0; frame < 6; ++frame)
+			{
+				recorder.frame = frame;
+
+				if (frame < 5)
+				{
+					const std::int32_t target = static_cast<std::int32_t>(frame);
+					eventQueue.Enqueue(std::make_shared<Event<TestDamageMessage>>(TestDamageMessage{ target, 10.0f, "Immediate"s }), gameTime.CurrentTime());
+					eventQueue.Enqueue(std::make_shared<Event<TestDamageMessage>>(TestDamageMessage{ target, 2.5f, "Delayed"s }), gameTime.CurrentTime() + 32ms);
+				}
+
+				if (frame == 0)
+				{
+					eventQueue.Enqueue(std::make_shared<Event<TestUnjournaledMessage>>(TestUnjournaledMessage{ 1 }));
+				}
+
+				gameTime.SetElapsedGameTime(16ms);
+				gameTime.SetTotalGameTime(gameTime.TotalGameTime() + 16ms);
+				gameTime.SetCurrentTime(gameTime.CurrentTime() + 16ms);
+
+				eventQueue.Update(gameTime);
+				frameTimes.PushBack(gameTime.TotalGameTime());
+			}
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState EventJournalTest::sStartMemState;
+}
\ No newline at end of file
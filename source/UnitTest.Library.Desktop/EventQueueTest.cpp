@@ -4,6 +4,8 @@
 #include "Event.h"
 #include "IEventSubscriber.h"
 #include "EventQueue.h"
+#include "JobSystem.h"
+#include "StopWatch.h"
 
 using namespace std::string_literals;
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -62,6 +64,30 @@ namespace EventTests
 		EventQueue* queue{ nullptr };
 	};
 
+	class TestCountingSubscriber final : public IEventSubscriber
+	{
+	public:
+		virtual void Notify(EventPublisher&) override
+		{
+			++count;
+		}
+
+	public:
+		std::size_t count{ 0 };
+	};
+
+	class TestThreadSubscriber final : public IEventSubscriber
+	{
+	public:
+		virtual void Notify(EventPublisher&) override
+		{
+			threadId = std::this_thread::get_id();
+		}
+
+	public:
+		std::thread::id threadId;
+	};
+
 	class TestUpdateException final : public IEventSubscriber
 	{
 	public:
@@ -93,6 +119,7 @@ namespace EventTests
 
 			Event<Foo>::UnsubscribeAll();
 			Event<Foo>::SubscriberShrinkToFit();
+			Event<Foo>::SetOrderedDelivery(false);
 
 #if defined(DEBUG) || defined(_DEBUG)
 			_CrtMemState endMemState, diffMemState;
@@ -121,9 +148,10 @@ namespace EventTests
 			
 			Assert::AreEqual(1_z, queue.Size());
 			Assert::IsFalse(queue.IsEmpty());
-			Assert::AreEqual(1_z, queue.Capacity());
+			Assert::AreEqual(0_z, queue.Capacity());
 
 			queue.Update(gameTime);
+			Assert::AreEqual(1_z, queue.Capacity());
 		}
 
 		TEST_METHOD(Enqueue)
@@ -293,6 +321,231 @@ namespace EventTests
 			Assert::ExpectException<std::runtime_error>([this, &gameTime] { queue.Update(gameTime); });
 		}
 
+		TEST_METHOD(ExpireOrder)
+		{
+			GameTime gameTime;
+			gameTime.SetCurrentTime(std::chrono::high_resolution_clock::now());
+
+			const auto fooEvent1 = std::make_shared<Event<Foo>>(Foo(10));
+			const auto fooEvent2 = std::make_shared<Event<Foo>>(Foo(20));
+			const auto fooEvent3 = std::make_shared<Event<Foo>>(Foo(30));
+			queue.Enqueue(fooEvent3, gameTime.CurrentTime() + 30ms);
+			queue.Enqueue(fooEvent1, gameTime.CurrentTime() + 10ms);
+			queue.Enqueue(fooEvent2, gameTime.CurrentTime() + 20ms);
+
+			TestEventSubscriber subscriber;
+			Event<Foo>::Subscribe(subscriber);
+
+			gameTime.SetCurrentTime(gameTime.CurrentTime() + 20ms);
+			queue.Update(gameTime);
+			Assert::AreEqual(20, subscriber.Data());
+			Assert::AreEqual(1_z, queue.Size());
+
+			gameTime.SetCurrentTime(gameTime.CurrentTime() + 10ms);
+			queue.Update(gameTime);
+			Assert::AreEqual(30, subscriber.Data());
+			Assert::IsTrue(queue.IsEmpty());
+		}
+
+		TEST_METHOD(StagingOverflow)
+		{
+			EventQueue smallQueue(4);
+
+			GameTime gameTime;
+			gameTime.SetCurrentTime(std::chrono::high_resolution_clock::now());
+
+			TestEventSubscriber subscriber;
+			Event<Foo>::Subscribe(subscriber);
+
+			for (int i = 10; i > 0; --i)
+			{
+				smallQueue.Enqueue(std::make_shared<Event<Foo>>(Foo(i)), gameTime.CurrentTime() + std::chrono::milliseconds(i));
+			}
+
+			Assert::AreEqual(10_z, smallQueue.Size());
+
+			for (int i = 1; i <= 10; ++i)
+			{
+				gameTime.SetCurrentTime(gameTime.CurrentTime() + 1ms);
+				smallQueue.Update(gameTime);
+				Assert::AreEqual(i, subscriber.Data());
+				Assert::AreEqual(static_cast<std::size_t>(10 - i), smallQueue.Size());
+			}
+
+			smallQueue.Enqueue(std::make_shared<Event<Foo>>(Foo(20)));
+			smallQueue.Update(gameTime);
+			Assert::AreEqual(20, subscriber.Data());
+			Assert::IsTrue(smallQueue.IsEmpty());
+		}
+
+		TEST_METHOD(ConcurrentEnqueue)
+		{
+			const std::size_t producerCount = 16;
+			const std::size_t eventsPerProducer = 10000;
+
+			TestCountingSubscriber subscriber;
+			Event<Foo>::Subscribe(subscriber);
+
+			const auto fooEvent = std::make_shared<Event<Foo>>(Foo(10));
+			std::atomic<std::size_t> finishedCount{ 0 };
+
+			Vector<std::thread> producers{ Vector<std::thread>::EqualityFunctor() };
+			producers.Reserve(producerCount);
+
+			for (std::size_t i = 0; i < producerCount; ++i)
+			{
+				producers.EmplaceBack([this, &fooEvent, &finishedCount, eventsPerProducer]
+				{
+					for (std::size_t j = 0; j < eventsPerProducer; ++j)
+					{
+						queue.Enqueue(fooEvent);
+					}
+
+					++finishedCount;
+				});
+			}
+
+			const GameTime gameTime;
+
+			while (finishedCount < producerCount)
+			{
+				queue.Update(gameTime);
+			}
+
+			for (auto& producer : producers)
+			{
+				producer.join();
+			}
+
+			queue.Update(gameTime);
+
+			Assert::AreEqual(producerCount * eventsPerProducer, subscriber.count);
+			Assert::IsTrue(queue.IsEmpty());
+		}
+
+		TEST_METHOD(ParallelUpdate)
+		{
+			JobSystem jobSystem(4);
+			queue.SetJobSystem(&jobSystem);
+			Assert::IsTrue(queue.GetJobSystem() == &jobSystem);
+
+			const GameTime gameTime;
+
+			Vector<TestEventSubscriber> subscribers;
+			subscribers.Resize(1000);
+
+			for (auto& subscriber : subscribers)
+			{
+				Event<Foo>::Subscribe(subscriber);
+			}
+
+			queue.Enqueue(std::make_shared<Event<Foo>>(Foo(10)));
+			queue.Update(gameTime);
+
+			for (auto& subscriber : subscribers)
+			{
+				Assert::AreEqual(10, subscriber.Data());
+			}
+
+			TestUpdateException exceptionSubscriber1;
+			TestUpdateException exceptionSubscriber2;
+			Event<Foo>::Subscribe(exceptionSubscriber1);
+			Event<Foo>::Subscribe(exceptionSubscriber2);
+
+			queue.Enqueue(std::make_shared<Event<Foo>>(Foo(20)));
+
+			std::size_t exceptionCount = 0;
+
+			try
+			{
+				queue.Update(gameTime);
+			}
+			catch (const Exception::AggregateException& exception)
+			{
+				exceptionCount = exception.Exceptions.Size();
+			}
+
+			Assert::AreEqual(2_z, exceptionCount);
+
+			for (auto& subscriber : subscribers)
+			{
+				Assert::AreEqual(20, subscriber.Data());
+			}
+
+			queue.SetJobSystem(nullptr);
+		}
+
+		TEST_METHOD(OrderedDelivery)
+		{
+			JobSystem jobSystem(4);
+			queue.SetJobSystem(&jobSystem);
+
+			Assert::IsFalse(Event<Foo>::OrderedDelivery());
+			Event<Foo>::SetOrderedDelivery(true);
+			Assert::IsTrue(Event<Foo>::OrderedDelivery());
+
+			Vector<TestThreadSubscriber> subscribers{ Vector<TestThreadSubscriber>::EqualityFunctor() };
+			subscribers.Resize(1000);
+
+			for (auto& subscriber : subscribers)
+			{
+				Event<Foo>::Subscribe(subscriber);
+			}
+
+			const GameTime gameTime;
+			queue.Enqueue(std::make_shared<Event<Foo>>(Foo(10)));
+			queue.Update(gameTime);
+
+			for (auto& subscriber : subscribers)
+			{
+				Assert::IsTrue(subscriber.threadId == std::this_thread::get_id());
+			}
+
+			queue.SetJobSystem(nullptr);
+		}
+
+		TEST_METHOD(Benchmark)
+		{
+			const std::size_t pending = 100000;
+			const std::size_t firing = 1000;
+			const std::size_t frames = 100;
+
+			GameTime gameTime;
+			gameTime.SetCurrentTime(std::chrono::high_resolution_clock::now());
+
+			const auto fooEvent = std::make_shared<Event<Foo>>(Foo(10));
+
+			for (std::size_t i = 0; i < pending; ++i)
+			{
+				queue.Enqueue(fooEvent, gameTime.CurrentTime() + 1h);
+			}
+
+			StopWatch stopWatch;
+			std::chrono::microseconds elapsed{ 0 };
+
+			for (std::size_t frame = 0; frame < frames; ++frame)
+			{
+				for (std::size_t i = 0; i < firing; ++i)
+				{
+					queue.Enqueue(fooEvent, gameTime.CurrentTime());
+				}
+
+				stopWatch.Start();
+				queue.Update(gameTime);
+				stopWatch.Stop();
+				elapsed += stopWatch.Elapsed();
+
+				gameTime.SetCurrentTime(gameTime.CurrentTime() + 16ms);
+			}
+
+			Assert::AreEqual(pending, queue.Size());
+
+			std::stringstream message;
+			message << "EventQueue Update " << pending << " pending, " << firing << " firing: "
+				<< (static_cast<double>(elapsed.count()) / frames) << " us/frame";
+			Logger::WriteMessage(message.str().c_str());
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 
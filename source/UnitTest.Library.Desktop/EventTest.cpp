@@ -2,8 +2,10 @@
 
 #include "ToStringSpecialization.h"
 #include "Event.h"
+#include "EventPool.h"
 #include "IEventSubscriber.h"
 #include "EventQueue.h"
+#include "StopWatch.h"
 
 using namespace std::string_literals;
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -32,6 +34,16 @@ namespace EventTests
 		EventQueue* queue{ nullptr };
 	};
 
+	class TestUnsubscribeSubscriber final : public Foo, public IEventSubscriber
+	{
+	public:
+		virtual void Notify(EventPublisher& eventPublisher) override
+		{
+			Data() = static_cast<Event<Foo>&>(eventPublisher).Message.Data();
+			Event<Foo>::Unsubscribe(*this);
+		}
+	};
+
 	TEST_CLASS(EventTest)
 	{
 	public:
@@ -152,6 +164,103 @@ namespace EventTests
 			Assert::ExpectException<std::runtime_error>([&fooEvent]{ EventQueue::Publish(fooEvent); });
 		}
 
+		TEST_METHOD(UnsubscribeInPublish)
+		{
+			Event<Foo> fooEvent(Foo(10));
+			Vector<TestUnsubscribeSubscriber> subscribers;
+			subscribers.Resize(100);
+
+			for (auto& subscriber : subscribers)
+			{
+				Event<Foo>::Subscribe(subscriber);
+			}
+
+			EventQueue::Publish(fooEvent);
+
+			for (auto& subscriber : subscribers)
+			{
+				Assert::AreEqual(10, subscriber.Data());
+			}
+
+			Assert::AreEqual(0_z, Event<Foo>::SubscriberCount());
+
+			Event<Foo>::Subscribe(subscribers.Front());
+			Assert::AreEqual(1_z, Event<Foo>::SubscriberCount());
+		}
+
+		TEST_METHOD(Pool)
+		{
+			EventPool<Foo> pool;
+			Assert::AreEqual(0_z, pool.IdleCount());
+
+			TestEventSubscriber subscriber;
+			Event<Foo>::Subscribe(subscriber);
+
+			const Event<Foo>* firstEvent = nullptr;
+
+			{
+				const auto fooEvent = pool.Acquire([](Foo& message) { message.Data() = 10; });
+				firstEvent = fooEvent.get();
+
+				EventQueue::Publish(*fooEvent);
+				Assert::AreEqual(10, subscriber.Data());
+				Assert::AreEqual(0_z, pool.IdleCount());
+			}
+
+			Assert::AreEqual(1_z, pool.IdleCount());
+
+			auto fooEvent = pool.Acquire([](Foo& message)
+			{
+				Assert::AreEqual(10, message.Data());
+				message.Data() = 20;
+			});
+
+			Assert::IsTrue(firstEvent == fooEvent.get());
+			Assert::AreEqual(0_z, pool.IdleCount());
+
+			EventQueue::Publish(*fooEvent);
+			Assert::AreEqual(20, subscriber.Data());
+
+			Assert::ExpectException<std::runtime_error>([&pool] { pool.Acquire([](Foo&) { throw std::runtime_error("Test exception."); }); });
+			Assert::AreEqual(1_z, pool.IdleCount());
+
+			fooEvent.reset();
+			Assert::AreEqual(2_z, pool.IdleCount());
+
+			pool.Clear();
+			Assert::AreEqual(0_z, pool.IdleCount());
+		}
+
+		TEST_METHOD(Benchmark)
+		{
+			const std::size_t subscriberCount = 500;
+			const std::size_t publishCount = 10000;
+
+			Event<Foo> fooEvent(Foo(10));
+			Vector<TestEventSubscriber> subscribers;
+			subscribers.Resize(subscriberCount);
+
+			for (auto& subscriber : subscribers)
+			{
+				Event<Foo>::Subscribe(subscriber);
+			}
+
+			StopWatch stopWatch;
+			stopWatch.Start();
+
+			for (std::size_t i = 0; i < publishCount; ++i)
+			{
+				EventQueue::Publish(fooEvent);
+			}
+
+			stopWatch.Stop();
+
+			std::stringstream message;
+			message << "Event Publish " << subscriberCount << " subscribers: "
+				<< (static_cast<double>(stopWatch.Elapsed().count()) * 1000.0 / publishCount) << " ns/publish";
+			Logger::WriteMessage(message.str().c_str());
+		}
+
 		TEST_METHOD(RTTITest)
 		{
 			const Event<Foo> a;
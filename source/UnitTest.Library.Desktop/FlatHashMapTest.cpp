@@ -0,0 +1,412 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "Foo.h"
+#include "HashMap.h"
+#include "FlatHashMap.h"
+#include "StopWatch.h"
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+using namespace Library;
+
+namespace UnitTests
+{
+	int BenchmarkKey(const std::size_t i)
+	{
+		// Odd multiplier makes this a bijection over 32 bits, so keys are unique but not in sequential bucket order.
+		return static_cast<int>(static_cast<std::uint32_t>(i) * 2654435761u);
+	}
+
+	template<typename TMap>
+	std::chrono::microseconds BenchmarkInsert(TMap& map, const std::size_t count)
+	{
+		StopWatch stopWatch;
+		stopWatch.Start();
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			map.TryEmplace(BenchmarkKey(i), static_cast<int>(i));
+		}
+
+		stopWatch.Stop();
+		return stopWatch.Elapsed();
+	}
+
+	template<typename TMap>
+	std::chrono::microseconds BenchmarkFind(const TMap& map, const std::size_t count, const std::size_t offset, std::size_t& hitsOut)
+	{
+		StopWatch stopWatch;
+		stopWatch.Start();
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			hitsOut += map.Find(BenchmarkKey(i + offset)) != map.end();
+		}
+
+		stopWatch.Stop();
+		return stopWatch.Elapsed();
+	}
+
+	void LogBenchmark(const char* name, const std::size_t count, const std::chrono::microseconds& elapsed)
+	{
+		std::stringstream message;
+		message << name << " " << count << " keys: " << (static_cast<double>(elapsed.count()) * 1000.0 / count) << " ns/op";
+		Logger::WriteMessage(message.str().c_str());
+	}
+}
+
+namespace ContainerTests
+{
+	TEST_CLASS(FlatHashMapTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(IteratorDereference)
+		{
+			Assert::ExpectException<std::runtime_error>([] { *FlatHashMap<int, Foo>::Iterator(); });
+			Assert::ExpectException<std::runtime_error>([] { *FlatHashMap<int, Foo>::ConstIterator(); });
+
+			FlatHashMap<int, Foo> hashMap;
+			Assert::ExpectException<std::out_of_range>([&hashMap] { *hashMap.begin(); });
+			Assert::ExpectException<std::out_of_range>([&hashMap] { *hashMap.cbegin(); });
+			Assert::ExpectException<std::out_of_range>([&hashMap] { ++hashMap.end(); });
+
+			auto it = hashMap.Insert({ 10, Foo(10) }).first;
+			Assert::AreEqual(*it, *hashMap.begin());
+			Assert::AreEqual(Foo(10), it->second);
+			Assert::AreEqual(Foo(10), hashMap.cbegin()->second);
+		}
+
+		TEST_METHOD(IteratorArithmetic)
+		{
+			FlatHashMap<int, Foo> hashMap;
+
+			for (int i = 0; i < 100; ++i)
+			{
+				hashMap.Insert({ i, Foo(i) });
+			}
+
+			std::size_t count = 0;
+			int sum = 0;
+
+			for (auto it = hashMap.begin(); it != hashMap.end(); ++it)
+			{
+				sum += it->second.Data();
+				++count;
+			}
+
+			Assert::AreEqual(100_z, count);
+			Assert::AreEqual(4950, sum);
+
+			const FlatHashMap<int, Foo>& constHashMap = hashMap;
+			count = 0;
+
+			for (const auto& pair : constHashMap)
+			{
+				Assert::AreEqual(pair.first, pair.second.Data());
+				++count;
+			}
+
+			Assert::AreEqual(100_z, count);
+
+			auto it = hashMap.begin();
+			auto previous = it++;
+			Assert::AreNotEqual(previous, it);
+			Assert::AreEqual(FlatHashMap<int, Foo>::ConstIterator(hashMap.end()), hashMap.cend());
+		}
+
+		TEST_METHOD(Initialization)
+		{
+			FlatHashMap<int, Foo> hashMap;
+			Assert::AreEqual(0_z, hashMap.Size());
+			Assert::IsTrue(hashMap.IsEmpty());
+			Assert::AreEqual(FlatHashMap<int, Foo>::DefaultBucketCount, hashMap.BucketCount());
+			Assert::AreEqual(hashMap.begin(), hashMap.end());
+
+			FlatHashMap<int, Foo> roundedHashMap(20);
+			Assert::AreEqual(32_z, roundedHashMap.BucketCount());
+
+			FlatHashMap<int, Foo> minimumHashMap(1);
+			Assert::AreEqual(FlatHashMap<int, Foo>::GroupWidth, minimumHashMap.BucketCount());
+
+			FlatHashMap<int, Foo> listHashMap = { { 1, Foo(1) }, { 2, Foo(2) }, { 3, Foo(3) } };
+			Assert::AreEqual(3_z, listHashMap.Size());
+			Assert::AreEqual(Foo(2), listHashMap.At(2));
+
+			listHashMap = { { 4, Foo(4) } };
+			Assert::AreEqual(1_z, listHashMap.Size());
+			Assert::IsFalse(listHashMap.ContainsKey(1));
+			Assert::AreEqual(Foo(4), listHashMap.At(4));
+		}
+
+		TEST_METHOD(CopyMove)
+		{
+			FlatHashMap<std::string, Foo> hashMap;
+
+			for (int i = 0; i < 50; ++i)
+			{
+				hashMap.TryEmplace(std::to_string(i), i);
+			}
+
+			FlatHashMap<std::string, Foo> copy = hashMap;
+			Assert::AreEqual(hashMap.Size(), copy.Size());
+			Assert::AreEqual(hashMap.BucketCount(), copy.BucketCount());
+
+			for (int i = 0; i < 50; ++i)
+			{
+				Assert::AreEqual(Foo(i), copy.At(std::to_string(i)));
+				Assert::AreNotSame(hashMap.At(std::to_string(i)), copy.At(std::to_string(i)));
+			}
+
+			FlatHashMap<std::string, Foo> assigned;
+			assigned = copy;
+			Assert::AreEqual(50_z, assigned.Size());
+
+			FlatHashMap<std::string, Foo> moved = std::move(copy);
+			Assert::AreEqual(50_z, moved.Size());
+			Assert::AreEqual(0_z, copy.Size());
+			Assert::AreEqual(copy.begin(), copy.end());
+			Assert::IsFalse(copy.ContainsKey("0"s));
+
+			copy["reused"s] = Foo(1);
+			Assert::AreEqual(1_z, copy.Size());
+
+			assigned = std::move(moved);
+			Assert::AreEqual(50_z, assigned.Size());
+			Assert::AreEqual(Foo(49), assigned["49"s]);
+		}
+
+		TEST_METHOD(Rehash)
+		{
+			FlatHashMap<int, Foo> hashMap(16);
+
+			for (int i = 0; i < 1000; ++i)
+			{
+				Assert::IsTrue(hashMap.Insert({ i, Foo(i) }).second);
+			}
+
+			Assert::AreEqual(1000_z, hashMap.Size());
+			Assert::IsTrue(hashMap.LoadFactor() <= 0.875f);
+
+			hashMap.Rehash(16);
+			Assert::AreEqual(2048_z, hashMap.BucketCount());
+
+			hashMap.Rehash(10000);
+			Assert::AreEqual(16384_z, hashMap.BucketCount());
+
+			for (int i = 0; i < 1000; ++i)
+			{
+				Assert::AreEqual(Foo(i), hashMap.At(i));
+			}
+		}
+
+		TEST_METHOD(Find)
+		{
+			FlatHashMap<std::string, Foo> hashMap;
+			const FlatHashMap<std::string, Foo>& constHashMap = hashMap;
+
+			Assert::AreEqual(hashMap.end(), hashMap.Find("missing"s));
+			Assert::AreEqual(constHashMap.end(), constHashMap.Find("missing"s));
+
+			hashMap.TryEmplace("a"s, 1);
+			hashMap.TryEmplace("b"s, 2);
+
+			Assert::AreEqual(Foo(1), hashMap.Find("a"s)->second);
+			Assert::AreEqual(Foo(2), constHashMap.Find("b"s)->second);
+			Assert::AreEqual(hashMap.end(), hashMap.Find("c"s));
+
+			FlatHashMap<std::string, Foo> nullHash(16, DefaultEquality<std::string>(), nullptr);
+			Assert::ExpectException<std::runtime_error>([&nullHash] { nullHash.Find("a"s); });
+
+			FlatHashMap<std::string, Foo> nullEquality(16, nullptr);
+			Assert::ExpectException<std::runtime_error>([&nullEquality] { nullEquality.Find("a"s); });
+		}
+
+		TEST_METHOD(ElementAccess)
+		{
+			FlatHashMap<int, Foo> hashMap;
+			const FlatHashMap<int, Foo>& constHashMap = hashMap;
+
+			Assert::ExpectException<std::out_of_range>([&hashMap] { hashMap.At(1); });
+			Assert::ExpectException<std::out_of_range>([&constHashMap] { constHashMap.At(1); });
+			Assert::ExpectException<std::out_of_range>([&constHashMap] { constHashMap[1]; });
+
+			hashMap[1] = Foo(10);
+			Assert::AreEqual(Foo(10), hashMap.At(1));
+			Assert::AreEqual(Foo(10), constHashMap[1]);
+			Assert::AreEqual(Foo(0), hashMap[2]);
+			Assert::AreEqual(2_z, hashMap.Size());
+
+			Foo data;
+			Assert::IsTrue(hashMap.ContainsKey(1, data));
+			Assert::AreEqual(Foo(10), data);
+			Assert::IsFalse(hashMap.ContainsKey(3, data));
+			Assert::IsTrue(constHashMap.ContainsKey(2));
+		}
+
+		TEST_METHOD(Insert)
+		{
+			FlatHashMap<std::string, Foo> hashMap;
+
+			auto [it, isNew] = hashMap.Insert({ "a"s, Foo(1) });
+			Assert::IsTrue(isNew);
+			Assert::AreEqual(Foo(1), it->second);
+
+			Assert::IsFalse(hashMap.Insert({ "a"s, Foo(2) }).second);
+			Assert::AreEqual(Foo(1), hashMap.At("a"s));
+
+			const std::string key = "b"s;
+			Assert::IsTrue(hashMap.TryEmplace(key, 2).second);
+			Assert::IsFalse(hashMap.TryEmplace(key, 3).second);
+			Assert::IsTrue(hashMap.TryEmplace("c"s, 3).second);
+			Assert::IsTrue(hashMap.Emplace("d"s, Foo(4)).second);
+			Assert::IsFalse(hashMap.Emplace("d"s, Foo(5)).second);
+
+			Assert::AreEqual(4_z, hashMap.Size());
+			Assert::AreEqual(Foo(4), hashMap.At("d"s));
+		}
+
+		TEST_METHOD(Remove)
+		{
+			FlatHashMap<int, Foo> hashMap;
+
+			Assert::IsFalse(hashMap.Remove(1));
+			Assert::IsFalse(hashMap.Remove(hashMap.end()));
+			Assert::IsFalse(hashMap.Remove(FlatHashMap<int, Foo>::Iterator()));
+
+			for (int i = 0; i < 1000; ++i)
+			{
+				hashMap.Insert({ i, Foo(i) });
+			}
+
+			for (int i = 0; i < 1000; i += 2)
+			{
+				Assert::IsTrue(hashMap.Remove(i));
+				Assert::IsFalse(hashMap.Remove(i));
+			}
+
+			Assert::AreEqual(500_z, hashMap.Size());
+
+			for (int i = 0; i < 1000; ++i)
+			{
+				Assert::AreEqual(i % 2 == 1, hashMap.ContainsKey(i));
+			}
+
+			Assert::IsTrue(hashMap.Remove(hashMap.Find(1)));
+			Assert::AreEqual(499_z, hashMap.Size());
+
+			const std::size_t bucketCount = hashMap.BucketCount();
+
+			for (int i = 0; i < 100000; ++i)
+			{
+				hashMap.Insert({ 1000 + i, Foo(i) });
+				hashMap.Remove(1000 + i);
+			}
+
+			Assert::AreEqual(499_z, hashMap.Size());
+			Assert::AreEqual(bucketCount, hashMap.BucketCount());
+		}
+
+		TEST_METHOD(Clear)
+		{
+			FlatHashMap<std::string, Foo> hashMap;
+
+			for (int i = 0; i < 100; ++i)
+			{
+				hashMap.TryEmplace(std::to_string(i), i);
+			}
+
+			const std::size_t bucketCount = hashMap.BucketCount();
+			hashMap.Clear();
+
+			Assert::AreEqual(0_z, hashMap.Size());
+			Assert::AreEqual(bucketCount, hashMap.BucketCount());
+			Assert::AreEqual(hashMap.begin(), hashMap.end());
+			Assert::IsFalse(hashMap.ContainsKey("1"s));
+
+			hashMap.TryEmplace("1"s, 1);
+			Assert::AreEqual(1_z, hashMap.Size());
+		}
+
+		TEST_METHOD(ReferenceTypes)
+		{
+			const std::string keys[] = { "Foo"s, "Bar"s, "Baz"s };
+			const Foo values[] = { Foo(1), Foo(2), Foo(3) };
+
+			FlatHashMap<const std::string&, const Foo&> hashMap(16, DefaultEquality<const std::string>(), DefaultHash<const std::string>());
+
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				Assert::IsTrue(hashMap.Insert({ keys[i], values[i] }).second);
+			}
+
+			hashMap.Rehash(64);
+
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				Assert::AreSame(values[i], hashMap.At(std::string(keys[i])));
+			}
+		}
+
+		TEST_METHOD(Benchmark)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			const std::size_t counts[] = { 1000, 100000 };
+#else
+			const std::size_t counts[] = { 1000, 100000, 10000000 };
+#endif
+
+			for (const std::size_t count : counts)
+			{
+				std::size_t hashMapHits = 0;
+				std::size_t flatHashMapHits = 0;
+
+				{
+					HashMap<int, int> hashMap(count);
+					LogBenchmark("HashMap Insert", count, BenchmarkInsert(hashMap, count));
+					LogBenchmark("HashMap Find Hit", count, BenchmarkFind(hashMap, count, 0, hashMapHits));
+					LogBenchmark("HashMap Find Miss", count, BenchmarkFind(hashMap, count, count, hashMapHits));
+				}
+
+				{
+					FlatHashMap<int, int> flatHashMap(count);
+					LogBenchmark("FlatHashMap Insert", count, BenchmarkInsert(flatHashMap, count));
+					LogBenchmark("FlatHashMap Find Hit", count, BenchmarkFind(flatHashMap, count, 0, flatHashMapHits));
+					LogBenchmark("FlatHashMap Find Miss", count, BenchmarkFind(flatHashMap, count, count, flatHashMapHits));
+				}
+
+				Assert::AreEqual(count, hashMapHits);
+				Assert::AreEqual(count, flatHashMapHits);
+			}
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState FlatHashMapTest::sStartMemState;
+}
\ No newline at end of file
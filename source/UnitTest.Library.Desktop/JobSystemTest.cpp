@@ -0,0 +1,132 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "JobSystem.h"
+
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+using namespace Library;
+
+
+namespace UtilityTests
+{
+	TEST_CLASS(JobSystemTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(ScheduleWait)
+		{
+			JobSystem jobSystem(4);
+			Assert::AreEqual(4_z, jobSystem.WorkerCount());
+
+			std::atomic<std::size_t> count{ 0 };
+			JobSystem::Counter counter;
+			Assert::IsTrue(counter.IsDone());
+
+			for (std::size_t i = 0; i < 1000; ++i)
+			{
+				jobSystem.Schedule([&count] { ++count; }, counter);
+			}
+
+			jobSystem.Wait(counter);
+			Assert::IsTrue(counter.IsDone());
+			Assert::AreEqual(1000_z, count.load());
+		}
+
+		TEST_METHOD(NestedWait)
+		{
+			JobSystem jobSystem(4);
+
+			std::atomic<std::size_t> count{ 0 };
+			JobSystem::Counter counter;
+
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				jobSystem.Schedule([&jobSystem, &count]
+				{
+					JobSystem::Counter innerCounter;
+
+					for (std::size_t j = 0; j < 16; ++j)
+					{
+						jobSystem.Schedule([&count] { ++count; }, innerCounter);
+					}
+
+					jobSystem.Wait(innerCounter);
+				}, counter);
+			}
+
+			jobSystem.Wait(counter);
+			Assert::AreEqual(256_z, count.load());
+		}
+
+		TEST_METHOD(Exceptions)
+		{
+			JobSystem jobSystem(2);
+
+			std::atomic<std::size_t> count{ 0 };
+			JobSystem::Counter counter;
+
+			for (std::size_t i = 0; i < 10; ++i)
+			{
+				jobSystem.Schedule([&count, i]
+				{
+					if (i == 5) throw std::runtime_error("Job failed.");
+					++count;
+				}, counter);
+			}
+
+			Assert::ExpectException<std::runtime_error>([&jobSystem, &counter] { jobSystem.Wait(counter); });
+			Assert::IsTrue(counter.IsDone());
+			Assert::AreEqual(9_z, count.load());
+
+			jobSystem.Schedule([&count] { ++count; }, counter);
+			jobSystem.Wait(counter);
+			Assert::AreEqual(10_z, count.load());
+		}
+
+		TEST_METHOD(NoWorkers)
+		{
+			JobSystem jobSystem(0);
+			Assert::AreEqual(0_z, jobSystem.WorkerCount());
+
+			const std::thread::id threadId = std::this_thread::get_id();
+			bool isSameThread = false;
+
+			JobSystem::Counter counter;
+			jobSystem.Schedule([&isSameThread, threadId] { isSameThread = std::this_thread::get_id() == threadId; }, counter);
+			Assert::IsFalse(counter.IsDone());
+
+			jobSystem.Wait(counter);
+			Assert::IsTrue(isSameThread);
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState JobSystemTest::sStartMemState;
+}
\ No newline at end of file
@@ -0,0 +1,171 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "NameId.h"
+#include "Scope.h"
+#include "StopWatch.h"
+
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+using namespace Library;
+
+
+namespace UtilityTests
+{
+	TEST_CLASS(NameIdTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Constructor)
+		{
+			const NameId null;
+			Assert::IsTrue(null.IsNull());
+			Assert::AreEqual(NameId::NullId, null.Id());
+			Assert::IsTrue(null.Name().empty());
+			Assert::AreEqual(Hash::DefaultHash<std::string>()(""s), null.Hash());
+			Assert::IsTrue(null == NameId(""));
+
+			const NameId a("Health");
+			const NameId b("Health"s);
+			const NameId c(std::string_view("Health"));
+
+			Assert::IsFalse(a.IsNull());
+			Assert::IsTrue(a == b);
+			Assert::IsTrue(a == c);
+			Assert::AreEqual(a.Id(), b.Id());
+			Assert::IsTrue(a.Name() == "Health");
+			Assert::IsTrue(a.Name().data() == b.Name().data());
+
+			const NameId d("Mana");
+			Assert::IsTrue(a != d);
+			Assert::AreNotEqual(a.Id(), d.Id());
+		}
+
+		TEST_METHOD(Find)
+		{
+			Assert::IsTrue(NameId::Find("NameIdTest.Find.NotInterned").IsNull());
+			Assert::IsTrue(NameId::Find("").IsNull());
+
+			const NameId interned("NameIdTest.Find.Interned");
+			Assert::IsTrue(interned == NameId::Find("NameIdTest.Find.Interned"));
+			Assert::IsTrue(NameId::Find("NameIdTest.Find.NotInterned").IsNull());
+		}
+
+		TEST_METHOD(HashCode)
+		{
+			const Hash::DefaultHash<std::string> stringHash;
+			const Hash::DefaultHash<NameId> nameHash;
+
+			const NameId a("Position");
+			const NameId b("A name long enough to take the long path through the byte hash function");
+
+			Assert::AreEqual(stringHash("Position"s), a.Hash());
+			Assert::AreEqual(stringHash(std::string(b.Name())), b.Hash());
+			Assert::AreEqual(a.Hash(), nameHash(a));
+			Assert::AreEqual("Position"_hash, a.Hash());
+		}
+
+		TEST_METHOD(ScopeLookup)
+		{
+			const NameId integer("Integer");
+			const NameId missing("NameIdTest.ScopeLookup.Missing");
+
+			Scope parent;
+			parent["Integer"] = 10;
+			Scope& child = parent.AppendScope("Child");
+
+			Assert::IsTrue(parent.Find("Integer"s) == parent.Find(integer));
+			Assert::IsNull(parent.Find(missing));
+			Assert::IsNull(parent.Find(NameId()));
+
+			const Scope& constParent = parent;
+			Assert::IsTrue(constParent.Find("Integer"s) == constParent.Find(integer));
+
+			Scope* owner = nullptr;
+			Assert::IsTrue(parent.Find("Integer"s) == child.Search(integer, &owner));
+			Assert::IsTrue(&parent == owner);
+			Assert::IsNull(child.Search(missing, &owner));
+			Assert::IsNull(owner);
+
+			Scope::Data& appended = child.Append(integer);
+			Assert::IsTrue(child.Find("Integer"s) == &appended);
+			Assert::IsTrue(&child.Append(integer) == &appended);
+			Assert::AreEqual(1_z, child.Size());
+
+			Assert::ExpectException<std::runtime_error>([&child] { child.Append(NameId()); });
+		}
+
+		TEST_METHOD(Benchmark)
+		{
+			const std::size_t attributeCount = 32;
+			const std::size_t lookupCount = 1000000;
+
+			Scope scope;
+			Vector<std::string> keys(attributeCount);
+			Vector<NameId> nameIds(attributeCount);
+
+			for (std::size_t i = 0; i < attributeCount; ++i)
+			{
+				keys.EmplaceBack("NameIdTest.Benchmark.Attribute"s + std::to_string(i));
+				nameIds.EmplaceBack(keys.Back());
+				scope.Append(keys.Back()) = static_cast<int>(i);
+			}
+
+			StopWatch stopWatch;
+			int sum = 0;
+
+			stopWatch.Start();
+			for (std::size_t i = 0; i < lookupCount; ++i)
+			{
+				sum += scope.Find(keys[i % attributeCount])->Get<int>();
+			}
+			stopWatch.Stop();
+			const auto stringTime = stopWatch.Elapsed();
+			stopWatch.Reset();
+
+			stopWatch.Start();
+			for (std::size_t i = 0; i < lookupCount; ++i)
+			{
+				sum -= scope.Find(nameIds[i % attributeCount])->Get<int>();
+			}
+			stopWatch.Stop();
+			const auto nameIdTime = stopWatch.Elapsed();
+
+			Assert::AreEqual(0, sum);
+
+			std::stringstream message;
+			message << "Scope Find " << lookupCount << " lookups: std::string " << (stringTime.count() * 1000.0 / lookupCount)
+				<< " ns/op, NameId " << (nameIdTime.count() * 1000.0 / lookupCount) << " ns/op";
+			Logger::WriteMessage(message.str().c_str());
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState NameIdTest::sStartMemState;
+}
\ No newline at end of file
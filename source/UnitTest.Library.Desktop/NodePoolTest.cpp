@@ -0,0 +1,119 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "Foo.h"
+#include "NodePool.h"
+
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+using namespace Library;
+
+
+namespace ContainerTests
+{
+	TEST_CLASS(NodePoolTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(CreateDestroy)
+		{
+			NodePool<Foo> pool;
+			Assert::AreEqual(0_z, pool.Size());
+			Assert::AreEqual(0_z, pool.ChunkCount());
+
+			Foo* a = pool.Create(10);
+			Assert::AreEqual(Foo(10), *a);
+			Assert::AreEqual(1_z, pool.Size());
+			Assert::AreEqual(1_z, pool.ChunkCount());
+
+			Foo* b = pool.Create(20);
+			Foo* c = pool.Create(30);
+			Assert::AreEqual(3_z, pool.Size());
+			Assert::AreEqual(2_z, pool.ChunkCount());
+			Assert::AreEqual(Foo(20), *b);
+			Assert::AreEqual(Foo(30), *c);
+
+			pool.Destroy(b);
+			Assert::AreEqual(2_z, pool.Size());
+
+			Foo* d = pool.Create(40);
+			Assert::IsTrue(b == d);
+			Assert::AreEqual(Foo(40), *d);
+			Assert::AreEqual(2_z, pool.ChunkCount());
+
+			pool.Destroy(nullptr);
+			Assert::AreEqual(3_z, pool.Size());
+
+			pool.Destroy(a);
+			pool.Destroy(c);
+			pool.Destroy(d);
+			Assert::AreEqual(0_z, pool.Size());
+
+			pool.Clear();
+			Assert::AreEqual(0_z, pool.ChunkCount());
+		}
+
+		TEST_METHOD(ChunkGrowth)
+		{
+			NodePool<int> pool;
+			const std::size_t count = NodePool<int>::MaxChunkCapacity * 4;
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				pool.Create(static_cast<int>(i));
+			}
+
+			// Chunks of 1, 2, 4 ... 128 slots hold 255 values, then each chunk holds MaxChunkCapacity.
+			Assert::AreEqual(count, pool.Size());
+			Assert::AreEqual(12_z, pool.ChunkCount());
+		}
+
+		TEST_METHOD(MoveSemantics)
+		{
+			NodePool<Foo> pool;
+			Foo* a = pool.Create(10);
+
+			NodePool<Foo> moved(std::move(pool));
+			Assert::AreEqual(0_z, pool.Size());
+			Assert::AreEqual(0_z, pool.ChunkCount());
+			Assert::AreEqual(1_z, moved.Size());
+			Assert::AreEqual(Foo(10), *a);
+
+			NodePool<Foo> assigned;
+			assigned = std::move(moved);
+			Assert::AreEqual(1_z, assigned.Size());
+			Assert::AreEqual(Foo(10), *a);
+
+			assigned.Destroy(a);
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState NodePoolTest::sStartMemState;
+}
\ No newline at end of file
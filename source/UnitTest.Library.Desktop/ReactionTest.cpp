@@ -44,6 +44,24 @@ namespace EntitySystemTests::ActionTests
 
 	ConcreteFactory(ActionTestReaction, Entity)
 
+	struct ActionTestSubscriber final : public IEventSubscriber
+	{
+	public:
+		virtual void Notify(EventPublisher& eventPublisher) override
+		{
+			const auto& message = static_cast<Event<EventMessageAttributed>&>(eventPublisher).Message;
+			Parameter = message.Find(ParameterKey)->Get<int>();
+			++Count;
+		}
+
+	public:
+		inline static const std::string ParameterKey{ "Parameter" };
+
+
+		std::size_t Count{ 0 };
+		int Parameter{ 0 };
+	};
+
 
 	TEST_CLASS(ReactionTest)
 	{
@@ -183,9 +201,11 @@ namespace EntitySystemTests::ActionTests
 			Assert::AreEqual(0_z, Event<EventMessageAttributed>::SubscriberCount());
 
 			{
-				const auto reaction = ReactionAttributed();
+				const auto reaction = ReactionAttributed("Reaction", "Subtype");
 				auto copy = ReactionAttributed(reaction);
-				Assert::AreEqual(2_z, Event<EventMessageAttributed>::SubscriberCount());
+				Assert::AreEqual(1_z, Event<EventMessageAttributed>::SubscriberCount());
+				Assert::AreEqual(2_z, ReactionAttributed::ReactionCount());
+				Assert::AreEqual("Subtype"s, copy.GetSubtype());
 			}
 
 			const auto event = std::make_shared<Event<EventMessageAttributed>>();
@@ -207,9 +227,11 @@ namespace EntitySystemTests::ActionTests
 			Assert::AreEqual(0_z, Event<EventMessageAttributed>::SubscriberCount());
 
 			{
-				auto reaction = ReactionAttributed();
+				auto reaction = ReactionAttributed("Reaction", "Subtype");
 				auto move = ReactionAttributed(std::move(reaction));
-				Assert::AreEqual(2_z, Event<EventMessageAttributed>::SubscriberCount());
+				Assert::AreEqual(1_z, Event<EventMessageAttributed>::SubscriberCount());
+				Assert::AreEqual(2_z, ReactionAttributed::ReactionCount());
+				Assert::AreEqual("Subtype"s, move.GetSubtype());
 			}
 
 			const auto event = std::make_shared<Event<EventMessageAttributed>>();
@@ -305,6 +327,104 @@ namespace EntitySystemTests::ActionTests
 			world.GetWorldState().EventQueue->ShrinkToFit();
 		}
 
+		TEST_METHOD(ActionEventAllocations)
+		{
+			const std::size_t warmUpCount = 10;
+			const std::size_t updateCount = 1000;
+
+			const auto gameTime = std::make_shared<GameTime>();
+			const auto eventQueue = std::make_shared<EventQueue>();
+
+			World world("World", gameTime.get(), eventQueue.get());
+			Entity& entity = world.CreateChild("Entity", "Sector").CreateChild("Entity", "Entity");
+
+			ActionTestSubscriber subscriber;
+			Event<EventMessageAttributed>::Subscribe(subscriber);
+
+			ActionEvent& actionEvent = *entity.CreateChild("ActionEvent"s, "CreateEvent"s).As<ActionEvent>();
+			Datum& parameter = actionEvent.AppendAuxiliaryAttribute(ActionTestSubscriber::ParameterKey) = 0;
+
+			for (std::size_t i = 0; i < warmUpCount; ++i)
+			{
+				world.Update();
+			}
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState startMemState, endMemState, diffMemState;
+			_CrtMemCheckpoint(&startMemState);
+#endif
+
+			for (int i = 1; i <= static_cast<int>(updateCount); ++i)
+			{
+				parameter = i;
+				world.Update();
+			}
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemCheckpoint(&endMemState);
+			_CrtMemDifference(&diffMemState, &startMemState, &endMemState);
+			Assert::AreEqual(0_z, diffMemState.lTotalCount);
+#endif
+
+			Assert::AreEqual(warmUpCount + updateCount - 1, subscriber.Count);
+			Assert::AreEqual(static_cast<int>(updateCount) - 1, subscriber.Parameter);
+
+			eventQueue->Clear();
+			eventQueue->ShrinkToFit();
+		}
+
+		TEST_METHOD(SubtypeIndex)
+		{
+			const auto gameTime = std::make_shared<GameTime>();
+			const auto eventQueue = std::make_shared<EventQueue>();
+
+			World world("World", gameTime.get(), eventQueue.get());
+
+			ReactionAttributed reactionA("ReactionA", "A");
+			ReactionAttributed reactionB("ReactionB", "B");
+			Assert::AreEqual(2_z, ReactionAttributed::ReactionCount());
+
+			auto& testReactionA = *reactionA.CreateChild("ActionTestReaction"s, "TestReaction"s).As<ActionTestReaction>();
+			auto& testReactionB = *reactionB.CreateChild("ActionTestReaction"s, "TestReaction"s).As<ActionTestReaction>();
+
+			EventMessageAttributed message(&world, "A");
+			message.AppendAuxiliaryAttribute("Parameter") = 1;
+
+			eventQueue->Enqueue(std::make_shared<Event<EventMessageAttributed>>(message));
+			eventQueue->Update(*gameTime);
+			Assert::AreEqual(1, testReactionA.Parameter);
+			Assert::AreEqual(0, testReactionB.Parameter);
+
+			reactionB.SetSubtype("A");
+			eventQueue->Enqueue(std::make_shared<Event<EventMessageAttributed>>(message));
+			eventQueue->Update(*gameTime);
+			Assert::AreEqual(2, testReactionA.Parameter);
+			Assert::AreEqual(1, testReactionB.Parameter);
+
+			*reactionA.Find(ReactionAttributed::SubtypeKey) = "C"s;
+			reactionA.Update(world.GetWorldState());
+			eventQueue->Enqueue(std::make_shared<Event<EventMessageAttributed>>(message));
+			eventQueue->Update(*gameTime);
+			Assert::AreEqual(2, testReactionA.Parameter);
+			Assert::AreEqual(2, testReactionB.Parameter);
+
+			message.SetSubtype("Unknown");
+			eventQueue->Enqueue(std::make_shared<Event<EventMessageAttributed>>(message));
+			eventQueue->Update(*gameTime);
+			Assert::AreEqual(2, testReactionA.Parameter);
+			Assert::AreEqual(2, testReactionB.Parameter);
+
+			ReactionAttributed reactionD("ReactionD");
+			auto& testReactionD = *reactionD.CreateChild("ActionTestReaction"s, "TestReaction"s).As<ActionTestReaction>();
+			*reactionD.Find(ReactionAttributed::SubtypeKey) = "D"s;
+			reactionD.Initialize(world.GetWorldState());
+
+			message.SetSubtype("D");
+			eventQueue->Enqueue(std::make_shared<Event<EventMessageAttributed>>(message));
+			eventQueue->Update(*gameTime);
+			Assert::AreEqual(1, testReactionD.Parameter);
+		}
+
 		TEST_METHOD(ToString)
 		{
 			/* ActionEvent */
@@ -4,6 +4,7 @@
 #include "Foo.h"
 #include "Bar.h"
 #include "SList.h"
+#include "StopWatch.h"
 
 
 using namespace std::string_literals;
@@ -14,6 +15,60 @@ using namespace UnitTests;
 using namespace Library;
 
 
+namespace UnitTests
+{
+	/// <summary>
+	/// Allocator that counts the allocations it makes, used to measure the shared_ptr node baseline.
+	/// </summary>
+	template<typename T>
+	struct CountingAllocator
+	{
+		using value_type = T;
+
+		explicit CountingAllocator(std::size_t& count) : Count(&count) {}
+
+		template<typename U>
+		CountingAllocator(const CountingAllocator<U>& other) : Count(other.Count) {}
+
+		T* allocate(const std::size_t n)
+		{
+			++*Count;
+			return std::allocator<T>().allocate(n);
+		}
+
+		void deallocate(T* p, const std::size_t n)
+		{
+			std::allocator<T>().deallocate(p, n);
+		}
+
+		template<typename U>
+		bool operator==(const CountingAllocator<U>& rhs) const { return Count == rhs.Count; }
+
+		template<typename U>
+		bool operator!=(const CountingAllocator<U>& rhs) const { return Count != rhs.Count; }
+
+		std::size_t* Count;
+	};
+
+	/// <summary>
+	/// Node layout used by SList before it was backed by a NodePool.
+	/// </summary>
+	struct SharedNode
+	{
+		SharedNode(const std::shared_ptr<SharedNode>& next, const int data) : Next(next), Data(data) {}
+
+		std::shared_ptr<SharedNode> Next;
+		int Data;
+	};
+
+	void LogSListBenchmark(const char* name, const std::size_t count, const std::chrono::microseconds& elapsed)
+	{
+		std::stringstream message;
+		message << name << " " << count << " elements: " << (static_cast<double>(elapsed.count()) * 1000.0 / count) << " ns/op";
+		Logger::WriteMessage(message.str().c_str());
+	}
+}
+
 namespace ContainerTests
 {
 	TEST_CLASS(SListTest)
@@ -1113,6 +1168,18 @@ namespace ContainerTests
 			Assert::AreEqual(*intIterator, 10);
 			Assert::AreEqual(*doubleIterator, 10.0);
 			Assert::AreEqual(*fooIterator, Foo(10));
+
+			Assert::AreEqual(3_z, intList.Size());
+			Assert::AreEqual(3_z, doubleList.Size());
+			Assert::AreEqual(3_z, fooList.Size());
+
+			Assert::AreEqual(intList.Back(), 20);
+			Assert::AreEqual(doubleList.Back(), 20.0);
+			Assert::AreEqual(fooList.Back(), Foo(20));
+
+			intList.InsertAfter(intList.Find(20), 40);
+			Assert::AreEqual(4_z, intList.Size());
+			Assert::AreEqual(intList.Back(), 40);
 		}
 
 		TEST_METHOD(Remove)
@@ -1254,7 +1321,107 @@ namespace ContainerTests
 			Assert::AreEqual(fooList.Size(), 0_z);
 		}
 
-	
+		TEST_METHOD(Benchmark)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			const std::size_t count = 100000;
+#else
+			const std::size_t count = 1000000;
+#endif
+			StopWatch stopWatch;
+			long long sum = 0;
+
+			{
+				std::size_t allocationCount = 0;
+				CountingAllocator<SharedNode> allocator(allocationCount);
+				std::shared_ptr<SharedNode> front;
+
+				stopWatch.Start();
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					front = std::allocate_shared<SharedNode>(allocator, front, static_cast<int>(i));
+				}
+				stopWatch.Stop();
+				LogSListBenchmark("shared_ptr nodes Push", count, stopWatch.Elapsed());
+				stopWatch.Reset();
+
+				stopWatch.Start();
+				for (SharedNode* node = front.get(); node != nullptr; node = node->Next.get())
+				{
+					sum += node->Data;
+				}
+				stopWatch.Stop();
+				LogSListBenchmark("shared_ptr nodes Iterate", count, stopWatch.Elapsed());
+				stopWatch.Reset();
+
+				stopWatch.Start();
+				while (front != nullptr)
+				{
+					front = std::shared_ptr<SharedNode>(front->Next);
+				}
+				stopWatch.Stop();
+				LogSListBenchmark("shared_ptr nodes Pop", count, stopWatch.Elapsed());
+				stopWatch.Reset();
+
+				Assert::AreEqual(count, allocationCount);
+				std::stringstream message;
+				message << "shared_ptr nodes " << count << " elements: " << allocationCount << " allocations";
+				Logger::WriteMessage(message.str().c_str());
+			}
+
+			{
+				SList<int> list;
+
+				for (std::size_t round = 0; round < 2; ++round)
+				{
+					stopWatch.Start();
+					for (std::size_t i = 0; i < count; ++i)
+					{
+						list.PushFront(static_cast<int>(i));
+					}
+					stopWatch.Stop();
+					LogSListBenchmark(round == 0 ? "SList Push" : "SList Push Reused", count, stopWatch.Elapsed());
+					stopWatch.Reset();
+
+					stopWatch.Start();
+					for (const int value : list)
+					{
+						sum -= value;
+					}
+					stopWatch.Stop();
+					LogSListBenchmark("SList Iterate", count, stopWatch.Elapsed());
+					stopWatch.Reset();
+
+					stopWatch.Start();
+					while (!list.IsEmpty())
+					{
+						list.PopFront();
+					}
+					stopWatch.Stop();
+					LogSListBenchmark("SList Pop", count, stopWatch.Elapsed());
+					stopWatch.Reset();
+				}
+			}
+
+			Assert::AreEqual(static_cast<long long>(count) * (static_cast<long long>(count) - 1) / 2, -sum);
+
+			{
+				struct Node { Node* Next; int Data; };
+				NodePool<Node> pool;
+
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					pool.Create(Node{ nullptr, static_cast<int>(i) });
+				}
+
+				std::stringstream message;
+				message << "SList nodes " << count << " elements: " << pool.ChunkCount() << " allocations";
+				Logger::WriteMessage(message.str().c_str());
+
+				Assert::IsTrue(pool.ChunkCount() < count / NodePool<Node>::MaxChunkCapacity + 16);
+			}
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
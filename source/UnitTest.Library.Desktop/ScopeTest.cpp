@@ -548,6 +548,115 @@ namespace ReflectionSystemTests
 			Assert::IsNull(constTmp);
 		}
 
+		TEST_METHOD(Resolve)
+		{
+			Scope scope;
+			scope["integer"] = 10;
+
+			Scope& child = scope.AppendScope("child");
+			Scope& grandchild = child.AppendScope("grandchild");
+
+			Scope::AttributeRef unresolved;
+			Assert::IsNull(unresolved.Get());
+			Assert::IsNull(unresolved.Owner());
+			Assert::IsNull(unresolved.Origin());
+
+			Scope::AttributeRef ref = grandchild.Resolve("integer");
+			Assert::AreEqual(&grandchild, ref.Origin());
+			Assert::IsTrue(NameId("integer") == ref.Name());
+			Assert::AreEqual(scope.Find("integer"), ref.Get());
+			Assert::AreEqual(&scope, ref.Owner());
+
+			Scope::AttributeRef missing = grandchild.Resolve(NameId("missing"));
+			Assert::IsNull(missing.Get());
+			Assert::IsNull(missing.Owner());
+
+			/* Shadowing attributes are found once appended */
+
+			child["integer"] = 20;
+			Assert::AreEqual(child.Find("integer"), ref.Get());
+			Assert::AreEqual(&child, ref.Owner());
+			Assert::AreEqual(20, ref.Get()->Get<int>());
+
+			grandchild["missing"] = 30;
+			Assert::AreEqual(grandchild.Find("missing"), missing.Get());
+
+			/* Rehashing moves table entries */
+
+			child.Reserve(100);
+			Assert::AreEqual(child.Find("integer"), ref.Get());
+
+			/* Reparenting changes the ancestors searched */
+
+			Scope* orphan = child.Orphan(grandchild);
+			Assert::IsNull(ref.Get());
+			Assert::AreEqual(orphan->Find("missing"), missing.Get());
+
+			scope.Adopt(grandchild, "grandchild");
+			Assert::AreEqual(scope.Find("integer"), ref.Get());
+			Assert::AreEqual(10, ref.Get()->Get<int>());
+
+			/* Clearing removes attributes */
+
+			grandchild.Clear();
+			Assert::IsNull(missing.Get());
+			Assert::AreEqual(scope.Find("integer"), ref.Get());
+
+			Scope other;
+			other["integer"] = 50;
+
+			Scope::AttributeRef otherRef = other.Resolve("integer");
+			Assert::AreEqual(50, otherRef.Get()->Get<int>());
+
+			/* Moving changes the owner */
+
+			Scope moved(std::move(other));
+			Assert::IsNull(otherRef.Get());
+			Assert::AreEqual(50, moved.Resolve("integer").Get()->Get<int>());
+		}
+
+		TEST_METHOD(ResolveUnrelatedChanges)
+		{
+			Scope scope;
+			scope["integer"] = 10;
+
+			Scope& child = scope.AppendScope("child");
+			Scope& grandchild = child.AppendScope("grandchild");
+
+			Scope::AttributeRef ref = grandchild.Resolve("integer");
+			Assert::IsFalse(ref.IsCurrent());
+			Assert::AreEqual(scope.Find("integer"), ref.Get());
+			Assert::IsTrue(ref.IsCurrent());
+
+			/* New entries in the searched Scopes may shadow the Attribute */
+
+			scope.AppendScope("spawned");
+			child.AppendScope("sibling");
+			Assert::IsFalse(ref.IsCurrent());
+			Assert::AreEqual(scope.Find("integer"), ref.Get());
+
+			for (int frame = 0; frame < 10; ++frame)
+			{
+				Scope& spawned = scope.AppendScope("spawned");
+				spawned["integer"] = frame;
+				spawned.AppendScope("part")["integer"] = frame;
+
+				Scope& sibling = child.AppendScope("sibling");
+				sibling["integer"] = frame;
+
+				delete scope.Orphan(spawned);
+				delete child.Orphan(sibling);
+
+				{
+					Scope temporary;
+					temporary["integer"] = frame;
+				}
+
+				Assert::IsTrue(ref.IsCurrent());
+				Assert::AreEqual(10, ref.Get()->Get<int>());
+			}
+		}
+
 		TEST_METHOD(ForEachAttribute)
 		{
 			Datum datumInt = { 10, 20, 30 };
@@ -586,7 +695,7 @@ namespace ReflectionSystemTests
 			Assert::IsTrue(isFound);
 
 			isFound = false;
-			constScope.ForEachAttribute([&](const Scope::Attribute& attribute)
+			constScope.ForEachAttribute([&](const Scope::ConstAttribute& attribute)
 				{
 					if (attribute.first == "child0")
 					{
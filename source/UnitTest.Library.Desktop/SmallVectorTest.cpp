@@ -0,0 +1,169 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "Foo.h"
+#include "SmallVector.h"
+
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+using namespace Library;
+
+
+namespace ContainerTests
+{
+	TEST_CLASS(SmallVectorTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(InlineToHeap)
+		{
+			SmallVector<Foo, 2> vector;
+			Assert::IsTrue(vector.IsEmpty());
+			Assert::IsTrue(vector.IsInline());
+			Assert::AreEqual(0_z, vector.Capacity());
+			Assert::ExpectException<std::runtime_error>([&vector] { vector.Front(); });
+			Assert::ExpectException<std::runtime_error>([&vector] { vector.Back(); });
+
+			vector.EmplaceBack(10);
+			vector.PushBack(Foo(20));
+			Assert::IsTrue(vector.IsInline());
+			Assert::AreEqual(2_z, vector.Size());
+			Assert::AreEqual(2_z, vector.Capacity());
+			Assert::AreEqual(Foo(10), vector.Front());
+			Assert::AreEqual(Foo(20), vector.Back());
+
+			vector.PushBack(Foo(30));
+			Assert::IsFalse(vector.IsInline());
+			Assert::AreEqual(3_z, vector.Size());
+			Assert::AreEqual(3_z, vector.Capacity());
+			Assert::AreEqual(Foo(10), vector[0]);
+			Assert::AreEqual(Foo(20), vector[1]);
+			Assert::AreEqual(Foo(30), vector.At(2));
+			Assert::ExpectException<std::out_of_range>([&vector] { vector.At(3); });
+
+			vector.PopBack();
+			vector.ShrinkToFit();
+			Assert::IsTrue(vector.IsInline());
+			Assert::AreEqual(2_z, vector.Capacity());
+			Assert::AreEqual(Foo(20), vector.Back());
+
+			vector.Reserve(10);
+			Assert::IsFalse(vector.IsInline());
+			Assert::AreEqual(10_z, vector.Capacity());
+			Assert::AreEqual(Foo(10), vector.Front());
+
+			vector.Clear();
+			vector.ShrinkToFit();
+			Assert::IsTrue(vector.IsInline());
+			Assert::AreEqual(0_z, vector.Capacity());
+		}
+
+		TEST_METHOD(FindRemove)
+		{
+			SmallVector<Foo, 4> vector = { Foo(10), Foo(20), Foo(30) };
+
+			Assert::IsTrue(vector.Find(Foo(20)) == vector.begin() + 1);
+			Assert::IsTrue(vector.Find(Foo(40)) == vector.end());
+
+			const auto& constVector = vector;
+			Assert::IsTrue(constVector.Find(Foo(30)) == constVector.cbegin() + 2);
+
+			Assert::IsTrue(vector.Remove(Foo(20)));
+			Assert::IsFalse(vector.Remove(Foo(20)));
+			Assert::AreEqual(2_z, vector.Size());
+			Assert::AreEqual(Foo(30), vector[1]);
+
+			Assert::IsTrue(vector.Remove(vector.begin()));
+			Assert::IsFalse(vector.Remove(vector.end()));
+			Assert::ExpectException<std::runtime_error>([&vector] { vector.Remove(vector.end() + 1); });
+			Assert::AreEqual(1_z, vector.Size());
+			Assert::AreEqual(Foo(30), vector.Front());
+
+			int sum = 0;
+			for (const auto& foo : vector)
+			{
+				sum += foo.Data();
+			}
+			Assert::AreEqual(30, sum);
+		}
+
+		TEST_METHOD(CopySemantics)
+		{
+			SmallVector<Foo, 2> inlineVector = { Foo(10), Foo(20) };
+			SmallVector<Foo, 2> heapVector = { Foo(10), Foo(20), Foo(30) };
+
+			SmallVector<Foo, 2> inlineCopy(inlineVector);
+			Assert::IsTrue(inlineCopy.IsInline());
+			Assert::IsTrue(inlineVector == inlineCopy);
+
+			SmallVector<Foo, 2> heapCopy(heapVector);
+			Assert::IsFalse(heapCopy.IsInline());
+			Assert::IsTrue(heapVector == heapCopy);
+
+			heapCopy = inlineVector;
+			Assert::IsTrue(inlineVector == heapCopy);
+
+			inlineCopy = heapVector;
+			Assert::IsFalse(inlineCopy.IsInline());
+			Assert::IsTrue(heapVector == inlineCopy);
+			Assert::IsTrue(inlineVector != inlineCopy);
+		}
+
+		TEST_METHOD(MoveSemantics)
+		{
+			SmallVector<Foo, 2> inlineVector = { Foo(10), Foo(20) };
+			SmallVector<Foo, 2> heapVector = { Foo(10), Foo(20), Foo(30) };
+			const Foo* heapData = &heapVector.Front();
+
+			SmallVector<Foo, 2> inlineMoved(std::move(inlineVector));
+			Assert::IsTrue(inlineMoved.IsInline());
+			Assert::AreEqual(2_z, inlineMoved.Size());
+			Assert::AreEqual(Foo(20), inlineMoved.Back());
+			Assert::IsTrue(inlineVector.IsEmpty());
+			Assert::AreEqual(0_z, inlineVector.Capacity());
+
+			SmallVector<Foo, 2> heapMoved(std::move(heapVector));
+			Assert::IsTrue(heapData == &heapMoved.Front());
+			Assert::AreEqual(3_z, heapMoved.Size());
+			Assert::IsTrue(heapVector.IsInline());
+			Assert::IsTrue(heapVector.IsEmpty());
+
+			heapMoved = std::move(inlineMoved);
+			Assert::IsTrue(heapMoved.IsInline());
+			Assert::AreEqual(2_z, heapMoved.Size());
+			Assert::AreEqual(Foo(10), heapMoved.Front());
+
+			heapVector.PushBack(Foo(40));
+			Assert::AreEqual(Foo(40), heapVector.Front());
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState SmallVectorTest::sStartMemState;
+}
\ No newline at end of file
@@ -15,6 +15,7 @@
 #include "SList.h"
 #include "Vector.h"
 #include "HashMap.h"
+#include "FlatHashMap.h"
 #include "Datum.h"
 #include "Scope.h"
 #include "TypeManager.h"
@@ -1231,6 +1232,126 @@ namespace Microsoft::VisualStudio::CppUnitTestFramework
 	}
 #pragma endregion HashMap Iterator
 
+#pragma region FlatHashMap
+	template<>
+	inline std::wstring ToString<FlatHashMap<std::string, Foo>::Pair>(const FlatHashMap<std::string, Foo>::Pair& t)
+	{
+		RETURN_WIDE_STRING(t.first.c_str());
+	}
+
+	template<>
+	inline std::wstring ToString<FlatHashMap<std::string, Foo>::Pair>(const FlatHashMap<std::string, Foo>::Pair* t)
+	{
+		RETURN_WIDE_STRING(t);
+	}
+
+	template<>
+	inline std::wstring ToString<FlatHashMap<std::string, Foo>::Pair>(FlatHashMap<std::string, Foo>::Pair* t)
+	{
+		RETURN_WIDE_STRING(t);
+	}
+
+	template<>
+	inline std::wstring ToString<FlatHashMap<int, Foo>::Iterator>(const FlatHashMap<int, Foo>::Iterator& t)
+	{
+		try
+		{
+			return ToString(*t);
+		}
+		catch (const std::exception&)
+		{
+			return L"end()"s;
+		}
+	}
+
+	template<>
+	inline std::wstring ToString<FlatHashMap<int, Foo>::Iterator>(const FlatHashMap<int, Foo>::Iterator* t)
+	{
+		RETURN_WIDE_STRING(t);
+	}
+
+	template<>
+	inline std::wstring ToString<FlatHashMap<int, Foo>::Iterator>(FlatHashMap<int, Foo>::Iterator* t)
+	{
+		RETURN_WIDE_STRING(t);
+	}
+
+	template<>
+	inline std::wstring ToString<FlatHashMap<int, Foo>::ConstIterator>(const FlatHashMap<int, Foo>::ConstIterator& t)
+	{
+		try
+		{
+			return ToString(*t);
+		}
+		catch (const std::exception&)
+		{
+			return L"end()"s;
+		}
+	}
+
+	template<>
+	inline std::wstring ToString<FlatHashMap<int, Foo>::ConstIterator>(const FlatHashMap<int, Foo>::ConstIterator* t)
+	{
+		RETURN_WIDE_STRING(t);
+	}
+
+	template<>
+	inline std::wstring ToString<FlatHashMap<int, Foo>::ConstIterator>(FlatHashMap<int, Foo>::ConstIterator* t)
+	{
+		RETURN_WIDE_STRING(t);
+	}
+
+	template<>
+	inline std::wstring ToString<FlatHashMap<std::string, Foo>::Iterator>(const FlatHashMap<std::string, Foo>::Iterator& t)
+	{
+		try
+		{
+			return ToString(*t);
+		}
+		catch (const std::exception&)
+		{
+			return L"end()"s;
+		}
+	}
+
+	template<>
+	inline std::wstring ToString<FlatHashMap<std::string, Foo>::Iterator>(const FlatHashMap<std::string, Foo>::Iterator* t)
+	{
+		RETURN_WIDE_STRING(t);
+	}
+
+	template<>
+	inline std::wstring ToString<FlatHashMap<std::string, Foo>::Iterator>(FlatHashMap<std::string, Foo>::Iterator* t)
+	{
+		RETURN_WIDE_STRING(t);
+	}
+
+	template<>
+	inline std::wstring ToString<FlatHashMap<std::string, Foo>::ConstIterator>(const FlatHashMap<std::string, Foo>::ConstIterator& t)
+	{
+		try
+		{
+			return ToString(*t);
+		}
+		catch (const std::exception&)
+		{
+			return L"end()"s;
+		}
+	}
+
+	template<>
+	inline std::wstring ToString<FlatHashMap<std::string, Foo>::ConstIterator>(const FlatHashMap<std::string, Foo>::ConstIterator* t)
+	{
+		RETURN_WIDE_STRING(t);
+	}
+
+	template<>
+	inline std::wstring ToString<FlatHashMap<std::string, Foo>::ConstIterator>(FlatHashMap<std::string, Foo>::ConstIterator* t)
+	{
+		RETURN_WIDE_STRING(t);
+	}
+#pragma endregion FlatHashMap
+
 #pragma region Datum
 	template<>
 	inline std::wstring ToString<RTTI>(const RTTI& t)
@@ -1402,7 +1523,7 @@ namespace Microsoft::VisualStudio::CppUnitTestFramework
 	template<>
 	inline std::wstring ToString<Signature>(const Signature& t)
 	{
-		RETURN_WIDE_STRING(t.Key.c_str());
+		RETURN_WIDE_STRING(std::string(t.Key.Name()).c_str());
 	}
 
 	template<>
@@ -1410,7 +1531,7 @@ namespace Microsoft::VisualStudio::CppUnitTestFramework
 	{
 		try
 		{
-			RETURN_WIDE_STRING(t->Key.c_str());
+			RETURN_WIDE_STRING(std::string(t->Key.Name()).c_str());
 		}
 		catch (...)
 		{
@@ -1423,7 +1544,7 @@ namespace Microsoft::VisualStudio::CppUnitTestFramework
 	{
 		try
 		{
-			RETURN_WIDE_STRING(t->Key.c_str());
+			RETURN_WIDE_STRING(std::string(t->Key.Name()).c_str());
 		}
 		catch (...)
 		{
@@ -87,6 +87,55 @@ namespace ReflectionSystemTests
 			Assert::IsFalse(TypeManager::Instance()->IsRegistered(AttributedBar::TypeIdClass()));
 		}
 
+		TEST_METHOD(Layout)
+		{
+			TypeManager::Create();
+			TypeManager* instance = TypeManager::Instance();
+
+			Assert::IsNull(instance->FindLayout(AttributedFoo::TypeIdClass()));
+
+			instance->Register<AttributedFoo>();
+			instance->Register<DerivedAttributedFoo>();
+
+			const TypeLayout* fooLayout = instance->FindLayout(AttributedFoo::TypeIdClass());
+			const TypeLayout* derivedLayout = instance->FindLayout(DerivedAttributedFoo::TypeIdClass());
+			Assert::IsNotNull(fooLayout);
+			Assert::IsNotNull(derivedLayout);
+			Assert::IsTrue(fooLayout == instance->Find(AttributedFoo::TypeIdClass())->Layout.get());
+
+			const SignatureList& signatures = AttributedFoo::Signatures();
+			Assert::AreEqual(signatures.Size() + 1, fooLayout->PrescribedCount());
+			Assert::AreEqual(fooLayout->PrescribedCount(), derivedLayout->PrescribedCount());
+			Assert::AreEqual(signatures.Size() - 2, fooLayout->External.Size());
+
+			for (std::size_t i = 0; i < signatures.Size(); ++i)
+			{
+				Assert::IsTrue(signatures[i] == derivedLayout->Signatures[i]);
+				Assert::AreEqual(TypeLayout::FirstIndex + i, derivedLayout->IndexOf(signatures[i].Key));
+				Assert::AreEqual(TypeLayout::FirstIndex + i, derivedLayout->IndexOf(std::string(signatures[i].Key.Name())));
+			}
+
+			Assert::AreEqual(0_z, fooLayout->IndexOf("this"s));
+			Assert::AreEqual(TypeLayout::NotFound, fooLayout->IndexOf("NotAnAttribute"s));
+
+			const DerivedAttributedFoo foo(10);
+			std::size_t index = 0;
+
+			foo.ForEachPrescribed([&index, derivedLayout](const Scope::ConstAttribute& attribute)
+			{
+				Assert::AreEqual(index, derivedLayout->IndexOf(attribute.first));
+				++index;
+			});
+
+			Assert::AreEqual(derivedLayout->PrescribedCount(), index);
+			Assert::AreEqual(derivedLayout->PrescribedCount(), foo.SlotCount());
+
+			instance->Deregister(DerivedAttributedFoo::TypeIdClass());
+			Assert::IsNull(instance->FindLayout(DerivedAttributedFoo::TypeIdClass()));
+
+			Assert::ExpectException<std::runtime_error>([] { DerivedAttributedFoo unregistered; });
+		}
+
 		TEST_METHOD(RehashRegistry)
 		{
 			TypeManager::Create();
@@ -6,6 +6,7 @@
 #include "Vector.h"
 #include "SList.h"
 #include "Event.h"
+#include "StackAllocator.h"
 
 
 using namespace std::string_literals;
@@ -1432,6 +1433,52 @@ namespace ContainerTests
 			Assert::AreEqual(fooVector.Size(), 0_z);
 		}
 
+		TEST_METHOD(Allocator)
+		{
+			alignas(std::max_align_t) std::byte buffer[1024];
+			StackAllocator stackAllocator(buffer, sizeof(buffer));
+
+			{
+				Vector<Foo> defaultVector;
+				Assert::IsTrue(&HeapAllocator::Instance() == &defaultVector.GetAllocator());
+
+				Vector<Foo> fooVector(stackAllocator, 4);
+				Assert::IsTrue(&stackAllocator == &fooVector.GetAllocator());
+				Assert::AreEqual(4_z, fooVector.Capacity());
+
+				for (int i = 0; i < 10; ++i)
+				{
+					fooVector.EmplaceBack(i);
+				}
+
+				Assert::AreEqual(10_z, fooVector.Size());
+				Assert::IsTrue(stackAllocator.Owns(&fooVector.Front()));
+				Assert::AreEqual(Foo(9), fooVector.Back());
+
+				Vector<Foo> copy = fooVector;
+				Assert::IsTrue(&HeapAllocator::Instance() == &copy.GetAllocator());
+				Assert::IsFalse(stackAllocator.Owns(&copy.Front()));
+				Assert::IsTrue(fooVector == copy);
+
+				Vector<Foo> moved = std::move(fooVector);
+				Assert::IsTrue(&stackAllocator == &moved.GetAllocator());
+				Assert::IsTrue(stackAllocator.Owns(&moved.Front()));
+
+				copy = std::move(moved);
+				Assert::IsTrue(&stackAllocator == &copy.GetAllocator());
+				Assert::AreEqual(Foo(9), copy.Back());
+
+				copy.Clear();
+				copy.ShrinkToFit();
+				Assert::AreEqual(0_z, stackAllocator.Size());
+
+				Vector<int> intVector(stackAllocator, 0, Vector<int>::EqualityFunctor{});
+				Assert::ExpectException<std::runtime_error>([&intVector] { intVector.Find(10); });
+			}
+
+			Assert::AreEqual(0_z, stackAllocator.Size());
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
@@ -4,7 +4,12 @@
 #include "World.h"
 #include "GameTime.h"
 #include "EventQueue.h"
+#include "EventChannel.h"
+#include "Event.h"
+#include "IEventSubscriber.h"
 #include "FooEntity.h"
+#include "ActionCreate.h"
+#include "JobSystem.h"
 
 using namespace std::string_literals;
 
@@ -15,6 +20,38 @@ using namespace UnitTests;
 
 namespace EntitySystemTests
 {
+	class WorldOrderChannelSubscriber final : public IEventChannelSubscriber<int>
+	{
+	public:
+		explicit WorldOrderChannelSubscriber(Vector<std::string>& orderList) : order(orderList)
+		{
+		}
+
+		virtual void Notify(gsl::span<const int> messages) override
+		{
+			order.PushBack("Channel"s + std::to_string(messages.size()));
+		}
+
+	public:
+		Vector<std::string>& order;
+	};
+
+	class WorldOrderEventSubscriber final : public IEventSubscriber
+	{
+	public:
+		explicit WorldOrderEventSubscriber(Vector<std::string>& orderList) : order(orderList)
+		{
+		}
+
+		virtual void Notify(EventPublisher&) override
+		{
+			order.PushBack("Queue"s);
+		}
+
+	public:
+		Vector<std::string>& order;
+	};
+
 	TEST_CLASS(WorldTest)
 	{
 	public:
@@ -24,6 +61,7 @@ namespace EntitySystemTests
 			RegisterType<Entity>();
 			RegisterType<FooEntity>();
 			RegisterType<World>();
+			RegisterType<ActionCreate>();
 
 #if defined(DEBUG) || defined(_DEBUG)
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
@@ -156,6 +194,7 @@ namespace EntitySystemTests
 			Assert::AreEqual("World"s, world.Name());
 			
 			Assert::AreEqual(&world, world.GetWorldState().World);
+			Assert::IsNotNull(world.GetWorldState().FrameAllocator);
 
 			Entity& sector1 = world.CreateChild("Entity"s, "Sector1"s);
 			Entity& sector2 = world.CreateChild("Entity"s, "Sector2"s);
@@ -175,6 +214,8 @@ namespace EntitySystemTests
 			Assert::IsNull(copy.GetWorldState().GameTime);
 			Assert::IsNull(copy.GetWorldState().EventQueue);
 			Assert::AreEqual(&copy, copy.GetWorldState().World);
+			Assert::IsNotNull(copy.GetWorldState().FrameAllocator);
+			Assert::IsTrue(copy.GetWorldState().FrameAllocator != world.GetWorldState().FrameAllocator);
 			Assert::IsNull(copy.GetWorldState().Entity);
 			Assert::IsNull(copy.GetWorldState().Entity);
 			
@@ -195,10 +236,234 @@ namespace EntitySystemTests
 			Entity& fooEntity1 = sector1.CreateChild("FooEntity", "Foo1");
 			Entity& fooEntity2 = sector2.CreateChild("FooEntity", "Foo2");
 
+			FrameAllocator& frameAllocator = *world.GetWorldState().FrameAllocator;
+			frameAllocator.Allocate(64);
+			Assert::AreEqual(64_z, frameAllocator.Size());
+
 			world.Update();
 
 			Assert::IsTrue(fooEntity1.As<FooEntity>()->IsUpdated());
 			Assert::IsTrue(fooEntity2.As<FooEntity>()->IsUpdated());
+			Assert::AreEqual(0_z, frameAllocator.Size());
+		}
+
+		TEST_METHOD(ParallelUpdate)
+		{
+			const std::size_t sectorCount = 8;
+			const std::size_t fooCount = 16;
+			const std::size_t createCount = 4;
+
+			Entity prototype("Spawned");
+			JobSystem jobSystem(4);
+
+			World world("World");
+			world.SetJobSystem(&jobSystem);
+			Assert::IsTrue(&jobSystem == world.GetWorldState().JobSystem);
+
+			for (std::size_t i = 0; i < sectorCount; ++i)
+			{
+				Entity& sector = world.CreateChild("Entity", "Sector" + std::to_string(i));
+
+				for (std::size_t j = 0; j < fooCount; ++j)
+				{
+					sector.CreateChild("FooEntity", "Foo" + std::to_string(j)).SetIndependent(j % 2 == 0);
+				}
+
+				for (std::size_t j = 0; j < createCount; ++j)
+				{
+					Entity& create = sector.CreateChild("ActionCreate", "Create" + std::to_string(j));
+					create.SetIndependent(true);
+					*create.As<ActionCreate>()->Find(ActionCreate::EntityPrototypeKey) = prototype.As<Scope>();
+				}
+			}
+
+			world.Update();
+			world.Update();
+
+			std::size_t updatedCount = 0;
+			world.ForEachChild([&updatedCount, fooCount, createCount](Entity& sector)
+			{
+				Assert::AreEqual(fooCount + 3 * createCount, sector.ChildCount());
+				Assert::AreEqual(2 * createCount, sector.Find("Spawned")->Size());
+
+				sector.ForEachChild([&updatedCount](Entity& child)
+				{
+					if (child.Is(FooEntity::TypeIdClass()) && child.As<FooEntity>()->IsUpdated()) ++updatedCount;
+				});
+			});
+
+			Assert::AreEqual(sectorCount * fooCount, updatedCount);
+
+			const World copy = world;
+			Assert::IsTrue(&jobSystem == copy.GetWorldState().JobSystem);
+
+			world.SetJobSystem(nullptr);
+			world.Update();
+			Assert::AreEqual(fooCount + 4 * createCount, world.FindChild("Sector0")->ChildCount());
+		}
+
+		TEST_METHOD(EventChannels)
+		{
+			GameTime gameTime;
+			EventQueue eventQueue;
+			World world("World", &gameTime, &eventQueue);
+
+			EventChannel<int> channel;
+			world.AddEventChannel(channel);
+
+			Assert::ExpectException<std::runtime_error>([&world, &channel]
+			{
+				world.AddEventChannel(channel);
+			});
+
+			Vector<std::string> order;
+
+			WorldOrderChannelSubscriber channelSubscriber(order);
+			channel.Subscribe(channelSubscriber);
+
+			WorldOrderEventSubscriber eventSubscriber(order);
+			Event<int>::Subscribe(eventSubscriber);
+
+			world.Initialize();
+
+			channel.Publish(10);
+			channel.Publish(20);
+			eventQueue.Enqueue(std::make_shared<Event<int>>(30));
+			world.Update();
+
+			Assert::AreEqual(2_z, order.Size());
+			Assert::AreEqual("Queue"s, order[0]);
+			Assert::AreEqual("Channel2"s, order[1]);
+
+			World copy(world);
+			channel.Publish(40);
+			copy.Update();
+			Assert::AreEqual("Channel1"s, order.Back());
+
+			Assert::IsTrue(world.RemoveEventChannel(channel));
+			Assert::IsFalse(world.RemoveEventChannel(channel));
+
+			channel.Publish(50);
+			world.Update();
+			Assert::AreEqual(3_z, order.Size());
+
+			copy.Shutdown();
+			Assert::IsTrue(channel.IsEmpty());
+
+			world.Shutdown();
+
+			Event<int>::UnsubscribeAll();
+			Event<int>::SubscriberShrinkToFit();
+		}
+
+		TEST_METHOD(FixedTimestepUpdate)
+		{
+			using namespace std::chrono_literals;
+
+			GameTime gameTime;
+			EventQueue eventQueue;
+			World world("World", &gameTime, &eventQueue);
+
+			Vector<std::string> order;
+			WorldOrderEventSubscriber eventSubscriber(order);
+			Event<int>::Subscribe(eventSubscriber);
+
+			world.Initialize();
+			world.Update(16ms);
+
+			const auto startTime = gameTime.CurrentTime();
+			eventQueue.Enqueue(std::make_shared<Event<int>>(10), startTime + 32ms);
+
+			world.Update(16ms);
+			Assert::AreEqual(16ms, gameTime.ElapsedGameTime());
+			Assert::AreEqual(32ms, gameTime.TotalGameTime());
+			Assert::IsTrue(order.IsEmpty());
+
+			world.Update(16ms);
+			Assert::IsTrue(startTime + 32ms == gameTime.CurrentTime());
+			Assert::AreEqual(1_z, order.Size());
+
+			world.Shutdown();
+
+			Event<int>::UnsubscribeAll();
+			Event<int>::SubscriberShrinkToFit();
+		}
+
+		TEST_METHOD(RunFixedTimestep)
+		{
+			using namespace std::chrono_literals;
+
+			GameTime gameTime;
+			World world("World", &gameTime);
+			world.Initialize();
+
+			Vector<std::chrono::milliseconds> frameTimes;
+			bool isAlphaInRange = true;
+
+			World::RunSettings settings;
+			settings.FixedTimestep = 4ms;
+			settings.MaxStepsPerFrame = 2;
+			settings.FrameCallback = [&world, &gameTime, &frameTimes, &isAlphaInRange](WorldState& worldState)
+			{
+				isAlphaInRange = isAlphaInRange && worldState.InterpolationAlpha >= 0.0f && worldState.InterpolationAlpha < 1.0f;
+				frameTimes.PushBack(gameTime.TotalGameTime());
+
+				if (frameTimes.Size() == 2)
+				{
+					std::this_thread::sleep_for(40ms);
+				}
+
+				if (gameTime.TotalGameTime() >= 60ms)
+				{
+					world.Stop();
+				}
+			};
+
+			world.Run(settings);
+
+			Assert::IsTrue(isAlphaInRange);
+			Assert::AreEqual(0.0f, world.GetWorldState().InterpolationAlpha);
+			Assert::AreEqual(4ms, gameTime.ElapsedGameTime());
+			Assert::IsTrue(frameTimes.Size() >= 8);
+
+			for (std::size_t i = 1; i < frameTimes.Size(); ++i)
+			{
+				const auto step = frameTimes[i] - frameTimes[i - 1];
+				Assert::IsTrue(step.count() % 4 == 0);
+				Assert::IsTrue(step <= 8ms);
+			}
+
+			world.Shutdown();
+		}
+
+		TEST_METHOD(RunFrameCap)
+		{
+			using namespace std::chrono_literals;
+
+			GameTime gameTime;
+			World world("World", &gameTime);
+			world.Initialize();
+
+			std::size_t frameCount = 0;
+
+			World::RunSettings settings;
+			settings.MinFrameTime = 5ms;
+			settings.FrameCallback = [&world, &frameCount](WorldState&)
+			{
+				if (++frameCount == 5)
+				{
+					world.Stop();
+				}
+			};
+
+			const auto startTime = std::chrono::high_resolution_clock::now();
+			world.Run(settings);
+			const auto elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+
+			Assert::AreEqual(5_z, frameCount);
+			Assert::IsTrue(elapsedTime >= 25ms);
+
+			world.Shutdown();
 		}
 
 		TEST_METHOD(Clone)
@@ -228,6 +493,7 @@ namespace EntitySystemTests
 
 		EntityFactory entityFactory;
 		FooEntityFactory fooEntityFactory;
+		ActionCreateFactory actionCreateFactory;
 	};
 
 	_CrtMemState WorldTest::sStartMemState;